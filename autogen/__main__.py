@@ -12,6 +12,18 @@ import argparse
 import jinja2
 from pathlib import Path
 
+def c_float(value):
+    """
+    @brief Formats a number as a C float literal that round-trips to the same float32
+    
+    @param value Number to be formatted
+    @return Literal such as 118.57708f or 20000.0f
+    """
+    literal = "%.9g" % value
+    if not any(c in literal for c in ".en"):
+        literal += ".0"
+    return literal + "f"
+
 def main():
     """
     @brief Processes the Jinja template and destination and creates autogenerated file
@@ -35,6 +47,7 @@ def main():
     template_loader = jinja2.FileSystemLoader(searchpath=template_dir)
     env = jinja2.Environment(loader=template_loader)
     env.tests["contains"] = (lambda list, var: (var in list))
+    env.filters["c_float"] = c_float
 
     for template in template_dir.glob("**/*.jinja"):
         template_path = str(template.relative_to(template_dir))
@@ -10,10 +10,40 @@
 #  @ingroup autogen
 
 import re
+import struct
 import yaml
 from pathlib    import Path
 from datetime   import datetime
 
+# Period in milliseconds of each named cycle group
+CYCLE_PERIODS_MS = {
+    "fast": 1,
+    "medium": 100,
+    "slow": 1000,
+}
+
+def get_cycle_group(cycle):
+    """
+    @brief Maps a message cycle to its named cycle group
+    
+    @param cycle Cycle from the YAML file, either a cycle group name or the period of a cycle group in milliseconds
+    @return The cycle group name. The firmware transmits and watches the message at the period of this group,
+            other periods are only available at run-time through CanScheduler::setMessagePeriod()
+    """
+    if cycle in CYCLE_PERIODS_MS:
+        return cycle
+
+    return next(group for group, period_ms in CYCLE_PERIODS_MS.items() if period_ms == cycle)
+
+def to_float32(value):
+    """
+    @brief Rounds a number to the nearest single precision float
+    
+    @param value Number to be rounded
+    @return The float32 value as a Python float, so generated C, C++ and Python constants are identical
+    """
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
 def check_yaml_file(data):
     """
     @brief Validates the content of CAN message YAML data
@@ -27,6 +57,8 @@ def check_yaml_file(data):
         - Illegal characters in message/signal names
         - Too many signals in a message (max 8)
         - Invalid signal lengths (must be multiple of 8)
+        - Float signals longer than 24 bits or signed non-standard signals
+        - Invalid cycle (must be a cycle group name or the period of a cycle group in milliseconds)
         - Total message length exceeding 64 bits
     """
     # These are all the illegal characters
@@ -83,8 +115,16 @@ def check_yaml_file(data):
                     raise Exception(f"Float signal '{signal_name}': min must be less than max")
                 if not isinstance(signal["min"], (int, float)) or not isinstance(signal["max"], (int, float)):
                     raise Exception(f"Float signal '{signal_name}': min and max must be numbers")
-                
-                
+                # Raw values must be exact in a float32, which has a 24 bit significand, for the decoders to agree bit-for-bit
+                if signal["length"] > 24:
+                    raise Exception(f"Float signal '{signal_name}' must be 24 bits or less")
+
+            if "signed" in signal:
+                if not isinstance(signal["signed"], bool):
+                    raise Exception(f"Signed must be a boolean value for signal '{signal_name}'")
+                if signal.get("type") in ("bitfield", "float"):
+                    raise Exception(f"Only standard signals can be signed, '{signal_name}' is a {signal['type']}")
+
             # All signals within a message are the same length
             if signal["length"] % 8 != 0:
                 raise Exception("Signal length must be a multiple of 8")
@@ -100,8 +140,9 @@ def check_yaml_file(data):
 
         if "cycle" not in message:
             raise Exception("Cycle speed is not defined for message " + message_name)
-        if message["cycle"] not in ["medium", "fast", "slow"]:
-            raise Exception("Cycle must be one of ['medium', 'fast', 'slow'] for message " + message_name)
+        cycle = message["cycle"]
+        if isinstance(cycle, bool) or not (cycle in CYCLE_PERIODS_MS or (isinstance(cycle, int) and cycle in CYCLE_PERIODS_MS.values())):
+            raise Exception(f"Cycle must be one of {list(CYCLE_PERIODS_MS)} or one of their periods in milliseconds {list(CYCLE_PERIODS_MS.values())} for message " + message_name)
 
 def get_data(args):
     """
@@ -143,6 +184,8 @@ def get_data(args):
                 signal_data ={
                     "name": signal_name,
                     "start_bit": start_bit,
+                    "mask": (1 << signal["length"]) - 1,
+                    "signed": False,
                     "scale": 1,
                     "offset": 0,
                     "receiver": message["target"],
@@ -181,12 +224,22 @@ def get_data(args):
                     signal_data["length"] = signal["length"]
                     signal_data["min"] = float(signal["min"])
                     signal_data["max"] = float(signal["max"])
-                
+
+                    # Raw 1 maps to min and raw (mask - 1) maps to max, raw 0 and raw mask flag
+                    # an out of range value. Decoding is float(raw) * scale + offset
+                    signal_data["scale"] = to_float32((signal_data["max"] - signal_data["min"]) / (signal_data["mask"] - 2))
+                    signal_data["offset"] = to_float32(signal_data["min"] - signal_data["scale"])
+
                 else:
                     signal_data["type"] = "standard"
                     signal_data["length"] = signal["length"]
-                    signal_data["min"] = 0
-                    signal_data["max"] = (2 ** signal["length"]) - 1
+                    signal_data["signed"] = signal.get("signed", False)
+                    if signal_data["signed"]:
+                        signal_data["min"] = -(2 ** (signal["length"] - 1))
+                        signal_data["max"] = (2 ** (signal["length"] - 1)) - 1
+                    else:
+                        signal_data["min"] = 0
+                        signal_data["max"] = (2 ** signal["length"]) - 1
                         
                 signals.append(signal_data)
                 start_bit += signal_data["length"]
@@ -195,10 +248,15 @@ def get_data(args):
             # Packet structure:
             # | PRIORITY (1 bit) | MESSAGE ID (6 bits) | SOURCE (4 bits) |
 
+            # Numeric periods name a cycle group, which is the period the firmware transmits at
+            cycle = get_cycle_group(message["cycle"])
+            period_ms = CYCLE_PERIODS_MS[cycle]
+
             messages.append({
                 "id": message["id"],
                 "critical": message["critical"],
-                "cycle": message["cycle"],
+                "cycle": cycle,
+                "period_ms": period_ms,
                 "name": message_name,
                 "signals": signals,
                 "sender": sender,
@@ -206,11 +264,11 @@ def get_data(args):
             })
 
             # Update message counter
-            if message["cycle"] == "fast":
+            if cycle == "fast":
                 message_count["fast_cycle"] += 1
-            elif message["cycle"] == "medium":
+            elif cycle == "medium":
                 message_count["medium_cycle"] += 1
-            elif message["cycle"] == "slow":
+            elif cycle == "slow":
                 message_count["slow_cycle"] += 1
 
             message_count["total"] +=1
@@ -102,6 +102,16 @@ StatusCode can_receive(CanMessage *msg) {
     return STATUS_CODE_UNINITIALIZED;
   }
 
+#ifdef MS_PLATFORM_X86
+  /* The SocketCAN thread is not a FreeRTOS task and cannot use the queue API.
+   * Frames it received are moved into the RX queue here, from task context */
+  CanMessage rx_msg = { 0 };
+  while (can_queue_size(&s_can_storage->rx_queue) < CAN_QUEUE_SIZE &&
+         can_hw_receive(&rx_msg.id.raw, &rx_msg.extended, &rx_msg.data, &rx_msg.dlc) == STATUS_CODE_OK) {
+    can_queue_push(&s_can_storage->rx_queue, &rx_msg);
+  }
+#endif
+
   StatusCode ret = can_queue_pop(&s_can_storage->rx_queue, msg);
 
   return ret;
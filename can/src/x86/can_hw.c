@@ -8,30 +8,351 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 /* Inter-component Headers */
+#include "FreeRTOS.h"
 #include "log.h"
+#include "task.h"
 
 /* Intra-component Headers */
 #include "can_hw.h"
 
-StatusCode can_hw_init(const CanQueue* rx_queue, const CanSettings *settings) {
-    return STATUS_CODE_UNIMPLEMENTED;
+/** @brief  Number of frames held by the RX and TX rings. Must be a power of 2 */
+#define CAN_HW_RING_SIZE 256U
+
+/** @brief  Maximum number of frames read or written per recvmmsg()/sendmmsg() call */
+#define CAN_HW_BATCH_SIZE 32U
+
+/** @brief  Maximum number of kernel-side CAN_RAW_FILTER entries */
+#define CAN_HW_MAX_FILTERS 64U
+
+/**
+ * @brief   Single producer, single consumer ring of CAN frames
+ * @details The head is only written by the producer and the tail only by the consumer,
+ *          so no lock is needed between the SocketCAN thread and FreeRTOS tasks
+ */
+typedef struct CanHwRing {
+  struct can_frame frames[CAN_HW_RING_SIZE]; /**< Frame storage */
+  atomic_uint head;                          /**< Index of the next frame to be written */
+  atomic_uint tail;                          /**< Index of the next frame to be read */
+} CanHwRing;
+
+static int s_can_socket = -1;
+static int s_tx_event_fd = -1;
+static pthread_t s_io_thread;
+static bool s_silent = false;
+
+static CanHwRing s_rx_ring;
+static CanHwRing s_tx_ring;
+
+static struct can_filter s_filters[CAN_HW_MAX_FILTERS];
+static uint8_t s_num_filters = 0U;
+
+static atomic_bool s_bus_error = false;
+
+static bool s_ring_push(CanHwRing *ring, const struct can_frame *frame) {
+  unsigned int head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+  if (head - tail >= CAN_HW_RING_SIZE) {
+    return false;
+  }
+
+  ring->frames[head & (CAN_HW_RING_SIZE - 1U)] = *frame;
+  atomic_store_explicit(&ring->head, head + 1U, memory_order_release);
+  return true;
+}
+
+static bool s_ring_pop(CanHwRing *ring, struct can_frame *frame) {
+  unsigned int tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  unsigned int head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+  if (head == tail) {
+    return false;
+  }
+
+  *frame = ring->frames[tail & (CAN_HW_RING_SIZE - 1U)];
+  atomic_store_explicit(&ring->tail, tail + 1U, memory_order_release);
+  return true;
+}
+
+static void s_receive_batch(void) {
+  struct can_frame frames[CAN_HW_BATCH_SIZE];
+  struct iovec iovecs[CAN_HW_BATCH_SIZE];
+  struct mmsghdr msgs[CAN_HW_BATCH_SIZE];
+
+  memset(msgs, 0, sizeof(msgs));
+  for (uint32_t i = 0U; i < CAN_HW_BATCH_SIZE; i++) {
+    iovecs[i].iov_base = &frames[i];
+    iovecs[i].iov_len = sizeof(struct can_frame);
+    msgs[i].msg_hdr.msg_iov = &iovecs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1U;
+  }
+
+  int num_frames = recvmmsg(s_can_socket, msgs, CAN_HW_BATCH_SIZE, MSG_DONTWAIT, NULL);
+
+  for (int i = 0; i < num_frames; i++) {
+    if (msgs[i].msg_len < sizeof(struct can_frame) || (frames[i].can_id & CAN_ERR_FLAG)) {
+      continue;
+    }
+
+    /* Mirrors a full hardware FIFO, the frame is dropped */
+    if (!s_ring_push(&s_rx_ring, &frames[i])) {
+      LOG_WARN("CAN RX ring full, dropping frame 0x%lx\n", (unsigned long)frames[i].can_id);
+    }
+  }
+}
+
+static void s_transmit_batch(void) {
+  struct can_frame frames[CAN_HW_BATCH_SIZE];
+  struct iovec iovecs[CAN_HW_BATCH_SIZE];
+  struct mmsghdr msgs[CAN_HW_BATCH_SIZE];
+  uint32_t num_frames = 0U;
+
+  memset(msgs, 0, sizeof(msgs));
+  while (num_frames < CAN_HW_BATCH_SIZE && s_ring_pop(&s_tx_ring, &frames[num_frames])) {
+    iovecs[num_frames].iov_base = &frames[num_frames];
+    iovecs[num_frames].iov_len = sizeof(struct can_frame);
+    msgs[num_frames].msg_hdr.msg_iov = &iovecs[num_frames];
+    msgs[num_frames].msg_hdr.msg_iovlen = 1U;
+    num_frames++;
+  }
+
+  uint32_t num_sent = 0U;
+  while (num_sent < num_frames) {
+    int ret = sendmmsg(s_can_socket, &msgs[num_sent], num_frames - num_sent, 0);
+
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      /* ENOBUFS means the interface queue is full, equivalent to losing arbitration repeatedly */
+      atomic_store(&s_bus_error, true);
+      return;
+    }
+
+    num_sent += (uint32_t)ret;
+  }
+
+  atomic_store(&s_bus_error, false);
+}
+
+static void *s_io_thread_procedure(void *arg) {
+  struct pollfd fds[2U] = {
+    { .fd = s_can_socket, .events = POLLIN, .revents = 0 },
+    { .fd = s_tx_event_fd, .events = POLLIN, .revents = 0 },
+  };
+
+  while (true) {
+    if (poll(fds, 2U, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG_CRITICAL("CAN IO thread poll failed: %s\n", strerror(errno));
+      return NULL;
+    }
+
+    if (fds[0U].revents & POLLIN) {
+      s_receive_batch();
+    }
+
+    if (fds[1U].revents & POLLIN) {
+      uint64_t num_events;
+      (void)read(s_tx_event_fd, &num_events, sizeof(num_events));
+
+      /* Frames may be queued faster than one batch, drain the whole ring */
+      while (atomic_load(&s_tx_ring.head) != atomic_load(&s_tx_ring.tail)) {
+        s_transmit_batch();
+      }
+    }
+  }
+
+  return NULL;
+}
+
+StatusCode can_hw_init(const CanQueue *rx_queue, const CanSettings *settings) {
+  if (rx_queue == NULL || settings == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (s_can_socket >= 0) {
+    return STATUS_CODE_OK;
+  }
+
+  s_can_socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (s_can_socket < 0) {
+    LOG_CRITICAL("Failed to create SocketCAN socket: %s\n", strerror(errno));
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  struct ifreq ifr = { 0 };
+  snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", CAN_HW_DEV_INTERFACE);
+  if (ioctl(s_can_socket, SIOCGIFINDEX, &ifr) < 0) {
+    LOG_CRITICAL("CAN interface %s not found. Check if it is enabled?\n", CAN_HW_DEV_INTERFACE);
+    close(s_can_socket);
+    s_can_socket = -1;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  /* Loopback mirrors the hardware self-test mode, our own frames are received as well */
+  int recv_own_msgs = settings->loopback ? 1 : 0;
+  setsockopt(s_can_socket, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &recv_own_msgs, sizeof(recv_own_msgs));
+
+  /* Only data frames are forwarded, error frames are not subscribed to */
+  can_err_mask_t err_mask = 0U;
+  setsockopt(s_can_socket, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &err_mask, sizeof(err_mask));
+
+  struct sockaddr_can addr = { 0 };
+  addr.can_family = AF_CAN;
+  addr.can_ifindex = ifr.ifr_ifindex;
+
+  if (bind(s_can_socket, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    LOG_CRITICAL("Failed to bind SocketCAN socket: %s\n", strerror(errno));
+    close(s_can_socket);
+    s_can_socket = -1;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  fcntl(s_can_socket, F_SETFL, fcntl(s_can_socket, F_GETFL) | O_NONBLOCK);
+
+  s_tx_event_fd = eventfd(0U, EFD_NONBLOCK);
+  if (s_tx_event_fd < 0) {
+    close(s_can_socket);
+    s_can_socket = -1;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  atomic_init(&s_rx_ring.head, 0U);
+  atomic_init(&s_rx_ring.tail, 0U);
+  atomic_init(&s_tx_ring.head, 0U);
+  atomic_init(&s_tx_ring.tail, 0U);
+  s_num_filters = 0U;
+  s_silent = settings->silent;
+
+  /* The IO thread is not a FreeRTOS task, block all signals so it is never chosen to run
+   * the scheduler tick or mock interrupt handlers */
+  sigset_t all_signals;
+  sigset_t previous_signals;
+  sigfillset(&all_signals);
+  pthread_sigmask(SIG_SETMASK, &all_signals, &previous_signals);
+  int ret = pthread_create(&s_io_thread, NULL, s_io_thread_procedure, NULL);
+  pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+
+  if (ret != 0) {
+    close(s_tx_event_fd);
+    close(s_can_socket);
+    s_tx_event_fd = -1;
+    s_can_socket = -1;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  return STATUS_CODE_OK;
 }
 
 StatusCode can_hw_add_filter_in(uint32_t mask, uint32_t filter, bool extended) {
-    return STATUS_CODE_UNIMPLEMENTED;
+  if (s_can_socket < 0) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  if (s_num_filters >= CAN_HW_MAX_FILTERS) {
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  uint32_t id_mask = extended ? CAN_EFF_MASK : CAN_SFF_MASK;
+
+  /* Always match the frame format and reject remote frames, like the STM32 filter banks */
+  s_filters[s_num_filters].can_id = (filter & id_mask) | (extended ? CAN_EFF_FLAG : 0U);
+  s_filters[s_num_filters].can_mask = (mask & id_mask) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+  s_num_filters++;
+
+  /* The kernel replaces the whole filter list, so every filter is written each time */
+  if (setsockopt(s_can_socket, SOL_CAN_RAW, CAN_RAW_FILTER, s_filters, s_num_filters * sizeof(struct can_filter)) < 0) {
+    s_num_filters--;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  return STATUS_CODE_OK;
 }
 
 CanHwBusStatus can_hw_bus_status(void) {
-    return CAN_HW_BUS_STATUS_OK;
+  if (s_can_socket < 0) {
+    return CAN_HW_BUS_STATUS_OFF;
+  }
+
+  return atomic_load(&s_bus_error) ? CAN_HW_BUS_STATUS_ERROR : CAN_HW_BUS_STATUS_OK;
 }
 
 StatusCode can_hw_transmit(uint32_t id, bool extended, const uint8_t *data, uint8_t len) {
-    return STATUS_CODE_UNIMPLEMENTED;
+  if (data == NULL || len > CAN_MAX_DLEN) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (s_can_socket < 0) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  if (s_silent) {
+    return STATUS_CODE_OK;
+  }
+
+  struct can_frame frame = { 0 };
+  frame.can_id = extended ? ((id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (id & CAN_SFF_MASK);
+  frame.can_dlc = len;
+  memcpy(frame.data, data, len);
+
+  /* Tasks may transmit concurrently, the critical section keeps the ring single-producer */
+  taskENTER_CRITICAL();
+  bool queued = s_ring_push(&s_tx_ring, &frame);
+  taskEXIT_CRITICAL();
+
+  if (!queued) {
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  /* The IO thread coalesces all queued frames into sendmmsg() batches */
+  uint64_t event = 1U;
+  (void)write(s_tx_event_fd, &event, sizeof(event));
+
+  return STATUS_CODE_OK;
 }
 
 StatusCode can_hw_receive(uint32_t *id, bool *extended, uint64_t *data, uint8_t *len) {
-    return true;
+  if (id == NULL || extended == NULL || data == NULL || len == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  struct can_frame frame;
+
+  taskENTER_CRITICAL();
+  bool received = s_ring_pop(&s_rx_ring, &frame);
+  taskEXIT_CRITICAL();
+
+  if (!received) {
+    return STATUS_CODE_EMPTY;
+  }
+
+  *extended = (frame.can_id & CAN_EFF_FLAG) != 0U;
+  *id = frame.can_id & (*extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+  *len = frame.can_dlc;
+  *data = 0U;
+  memcpy(data, frame.data, frame.can_dlc);
+
+  return STATUS_CODE_OK;
 }
@@ -5,6 +5,8 @@
 #
 #  @ingroup CANSimulator
 
+import struct
+from collections import namedtuple
 from enum import Enum
 
 SYSTEM_CAN_MESSAGE_ID_OFFSET = 4
@@ -48,4 +50,205 @@ class SystemCanMessageId(int, Enum):
     SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS_ID =  SYSTEM_CAN_MESSAGE_PRIORITY_BIT + (21 << SYSTEM_CAN_MESSAGE_ID_OFFSET) + SystemCanDevice.SYSTEM_CAN_DEVICE_FRONT_CONTROLLER
     SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A_ID =  SYSTEM_CAN_MESSAGE_PRIORITY_BIT + (31 << SYSTEM_CAN_MESSAGE_ID_OFFSET) + SystemCanDevice.SYSTEM_CAN_DEVICE_FRONT_CONTROLLER
     SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B_ID =  SYSTEM_CAN_MESSAGE_PRIORITY_BIT + (37 << SYSTEM_CAN_MESSAGE_ID_OFFSET) + SystemCanDevice.SYSTEM_CAN_DEVICE_FRONT_CONTROLLER
-    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_ID =  SYSTEM_CAN_MESSAGE_PRIORITY_BIT + (34 << SYSTEM_CAN_MESSAGE_ID_OFFSET) + SystemCanDevice.SYSTEM_CAN_DEVICE_FRONT_CONTROLLER
\ No newline at end of file
+    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_ID =  SYSTEM_CAN_MESSAGE_PRIORITY_BIT + (34 << SYSTEM_CAN_MESSAGE_ID_OFFSET) + SystemCanDevice.SYSTEM_CAN_DEVICE_FRONT_CONTROLLER## @brief Position and conversion of a signal in the 64-bit little-endian CAN message data
+#  @details Generated from the same YAML data as the SYSTEM_CAN_SIGNAL_* macros in system_can.h
+SystemCanSignal = namedtuple("SystemCanSignal", ["name", "shift", "length", "mask", "signed", "is_float", "scale", "offset"])
+
+## @brief Signal layouts for every message, indexed by CAN message ID
+SYSTEM_CAN_SIGNALS = {
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_STEERING_STEERING_ID: (
+        SystemCanSignal("cruise_control_target_velocity", 0, 32, 0xFFFFFFFF, False, False, 1, 0),
+        SystemCanSignal("buttons", 32, 8, 0xFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_ID: (
+        SystemCanSignal("triggers", 0, 32, 0xFFFFFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A_ID: (
+        SystemCanSignal("pack_voltage", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("pack_current", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("pack_soc", 32, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B_ID: (
+        SystemCanSignal("max_cell_voltage", 0, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("min_cell_voltage", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("max_temperature", 16, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS_ID: (
+        SystemCanSignal("input_dcdc_voltage", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("input_dcdc_current", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("input_aux_voltage", 32, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("input_aux_current", 48, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_ID: (
+        SystemCanSignal("AFE1", 0, 32, 0xFFFFFFFF, False, False, 1, 0),
+        SystemCanSignal("AFE2", 32, 32, 0xFFFFFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_0", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_1", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_2", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_3", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_4", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_5", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_6", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_7", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_8", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_9", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_10", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_11", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_12", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_13", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_14", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_15", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_16", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_17", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_0", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_1", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_2", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_3", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_4", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_5", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_6", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_7", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_8", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_9", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_10", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_11", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_12", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_13", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_14", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("voltage_15", 8, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_16", 16, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+        SystemCanSignal("voltage_17", 24, 8, 0xFF, False, True, 118.57707214355469, 19881.423828125),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE_ID: (
+        SystemCanSignal("id", 0, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_0", 8, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_1", 16, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_2", 24, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_3", 32, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_4", 40, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_5", 48, 8, 0xFF, False, False, 1, 0),
+        SystemCanSignal("temperature_6", 56, 8, 0xFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_ID: (
+        SystemCanSignal("sig1", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("sig2", 16, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_ID: (
+        SystemCanSignal("sig1", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("sig2", 16, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_ID: (
+        SystemCanSignal("sig1", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("sig2", 16, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA_ID: (
+        SystemCanSignal("x_axis", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("y_axis", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("z_axis", 32, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA_ID: (
+        SystemCanSignal("x_axis", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("y_axis", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("z_axis", 32, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA_ID: (
+        SystemCanSignal("g_force", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("roll", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("pitch", 32, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("yaw", 48, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS_ID: (
+        SystemCanSignal("pedal_percentage", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("brake_percentage", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("state_data", 32, 8, 0xFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A_ID: (
+        SystemCanSignal("rev_cam_current", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("telem_current", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("steering_current", 32, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("driver_fan_current", 48, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B_ID: (
+        SystemCanSignal("horn_current", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("spare_current", 16, 16, 0xFFFF, False, False, 1, 0),
+    ),
+    SystemCanMessageId.SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_ID: (
+        SystemCanSignal("brake_light_sig_current", 0, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("bps_light_sig_current", 16, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("right_sig_current", 32, 16, 0xFFFF, False, False, 1, 0),
+        SystemCanSignal("left_sig_current", 48, 16, 0xFFFF, False, False, 1, 0),
+    ),
+}
+
+def to_float32(value):
+    """
+    @brief Rounds a number to the nearest single precision float, like a C float conversion
+    """
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+def extract_signal(data, signal):
+    """
+    @brief Extracts one signal from the CAN message data
+    @details Float signals are converted with two separately rounded float32 operations, so the
+             result matches system_can_signal_to_float() in firmware and the simulation server
+    @param data 64-bit CAN message data as an integer
+    @param signal SystemCanSignal describing the signal
+    @return Raw value, sign extended value for signed signals or physical value for float signals
+    """
+    raw = (data >> signal.shift) & signal.mask
+    if signal.signed:
+        sign_bit = 1 << (signal.length - 1)
+        return (raw ^ sign_bit) - sign_bit
+    if signal.is_float:
+        return to_float32(to_float32(float(raw) * signal.scale) + signal.offset)
+    return raw
+
+def decode_message(can_id, data):
+    """
+    @brief Decodes every signal of a CAN message
+    @param can_id CAN message ID
+    @param data CAN message data bytes
+    @return Dictionary of signal names to values, or None if the CAN ID is unknown
+    """
+    signals = SYSTEM_CAN_SIGNALS.get(can_id)
+    if signals is None:
+        return None
+
+    payload = int.from_bytes(bytes(data[:8]).ljust(8, b"\0"), "little")
+    return {signal.name: extract_signal(payload, signal) for signal in signals}
\ No newline at end of file
@@ -34,6 +34,7 @@ extern "C" {
 #endif
 
 #include <limits.h>
+#include <stdint.h>
 
 /*-----------------------------------------------------------
  * Port specific definitions.
@@ -125,6 +126,39 @@ extern void vPortCancelThread(void *pxTaskToDelete);
  */
 #define portMEMORY_BARRIER() __asm volatile("" ::: "memory")
 
+/* Tickless idle, advances the virtual clock while every task is blocked. */
+extern void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) vPortSuppressTicksAndSleep(xExpectedIdleTime)
+
+/*
+ * Virtual time, must be configured before the scheduler is started.
+ * A real-time ratio of 0 runs as fast as possible, N runs at most N times
+ * faster than wall-clock time. Setting the MS_VIRTUAL_TIME_RATIO environment
+ * variable has the same effect.
+ */
+extern void vPortSetVirtualTime(BaseType_t xEnable, uint32_t ulRealTimeRatio);
+
+/* Returns pdTRUE if the tick is driven by the virtual clock. */
+extern BaseType_t xPortIsVirtualTimeEnabled(void);
+
+/* Generates a virtual tick, must be called by an application defined idle hook. */
+extern void vPortVirtualTimeIdle(void);
+
+/*
+ * Lockstep virtual time. Once a barrier callback is set, the virtual clock
+ * never advances past the tick granted with vPortGrantVirtualTime(). The
+ * callback is called from the idle task with the tick count each time the
+ * grant is reached. Passing NULL releases the barrier.
+ */
+extern void vPortSetVirtualTimeBarrier(void (*pxCallback)(uint64_t ullTicks));
+
+/* Allows the virtual clock to advance up to the given tick. */
+extern void vPortGrantVirtualTime(uint64_t ullTicks);
+
+/* Returns the number of virtual ticks since the scheduler was started. */
+extern uint64_t ullPortGetVirtualTicks(void);
+/*-----------------------------------------------------------*/
+
 extern unsigned long ulPortGetRunTime(void);
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE() ulPortGetRunTime()
@@ -5778,10 +5778,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 
             /* This small sleep was added because of x86 simulations taking up 100% of the CPU */
             /* The Idle task never relinquished control and attempted to context switch */
-            struct timespec ts;
-            ts.tv_sec = 0;
-            ts.tv_nsec = 1000000; /* 1 millisecond */
-            nanosleep(&ts, NULL);
+            /* With virtual time the idle task generates the ticks, so it must not sleep */
+            if( xPortIsVirtualTimeEnabled() == pdFALSE )
+            {
+                struct timespec ts;
+                ts.tv_sec = 0;
+                ts.tv_nsec = 1000000; /* 1 millisecond */
+                nanosleep(&ts, NULL);
+            }
         }
         #endif
 
@@ -48,6 +48,22 @@
  * stdio (printf() and friends) should be called from a single task
  * only or serialized with a FreeRTOS primitive such as a binary
  * semaphore or mutex.
+ *
+ * Virtual time:
+ *
+ * vPortSetVirtualTime() (or the MS_VIRTUAL_TIME_RATIO environment
+ * variable) replaces the SIGALRM wall-clock tick with a virtual clock.
+ * The tick only advances from the idle task, i.e. once every task is
+ * blocked. Tickless idle jumps the tick count straight to the next
+ * task unblock time, so simulations run as fast as the tasks execute
+ * and every run produces the same tick sequence. A non-zero real-time
+ * ratio paces the virtual clock to at most that many times wall-clock
+ * speed. Tasks that never block stop virtual time from advancing.
+ *
+ * vPortSetVirtualTimeBarrier() additionally holds the virtual clock at
+ * the tick granted with vPortGrantVirtualTime(), which lets an external
+ * time master advance several processes in lockstep. The barrier
+ * callback is called from the idle task whenever the grant is reached.
  *----------------------------------------------------------*/
 
 #include <errno.h>
@@ -69,6 +85,11 @@
 
 #define SIG_RESUME SIGUSR1
 
+/* Environment variable that enables virtual time with the given real-time ratio */
+#define portVIRTUAL_TIME_RATIO_ENV "MS_VIRTUAL_TIME_RATIO"
+
+#define portTICK_PERIOD_NS ( ( uint64_t ) portTICK_RATE_MICROSECONDS * 1000ULL )
+
 typedef struct THREAD
 {
     pthread_t pthread;
@@ -102,6 +123,18 @@ static volatile portBASE_TYPE uxCriticalNesting;
 static portBASE_TYPE xSchedulerEnd = pdFALSE;
 /*-----------------------------------------------------------*/
 
+static BaseType_t xVirtualTimeEnabled = pdFALSE;
+static uint32_t ulVirtualTimeRatio = 0U;
+static uint64_t ullVirtualTicks = 0U;
+static uint64_t ullVirtualStartTimeNs = 0U;
+
+static void ( *pxVirtualTimeBarrierCallback )( uint64_t ullTicks ) = NULL;
+static uint64_t ullVirtualTimeGrant = 0U;
+static uint64_t ullVirtualTimeReported = UINT64_MAX;
+static pthread_mutex_t xVirtualTimeGrantMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xVirtualTimeGrantCond = PTHREAD_COND_INITIALIZER;
+/*-----------------------------------------------------------*/
+
 static void prvSetupSignalsAndSchedulerPolicy( void );
 static void prvSetupTimerInterrupt( void );
 static void *prvWaitForStart( void * pvParams );
@@ -110,6 +143,8 @@ static void prvSwitchThread( Thread_t * xThreadToResume,
 static void prvSuspendSelf( Thread_t * thread);
 static void prvResumeThread( Thread_t * xThreadId );
 static void vPortSystemTickHandler( int sig );
+static void prvProcessTick( void );
+static uint64_t prvGetTimeNs( void );
 static void vPortStartFirstTask( void );
 static void prvPortYieldFromISR( void );
 /*-----------------------------------------------------------*/
@@ -184,9 +219,23 @@ sigset_t xSignals;
 
     hMainThread = pthread_self();
 
-    /* Start the timer that generates the tick ISR(SIGALRM).
-       Interrupts are disabled here already. */
-    prvSetupTimerInterrupt();
+    if ( getenv( portVIRTUAL_TIME_RATIO_ENV ) != NULL )
+    {
+        vPortSetVirtualTime( pdTRUE, ( uint32_t )strtoul( getenv( portVIRTUAL_TIME_RATIO_ENV ), NULL, 10 ) );
+    }
+
+    if ( xVirtualTimeEnabled )
+    {
+        /* Ticks are generated by the idle task, there is no timer. */
+        ullVirtualTicks = 0U;
+        ullVirtualStartTimeNs = prvGetTimeNs();
+    }
+    else
+    {
+        /* Start the timer that generates the tick ISR(SIGALRM).
+           Interrupts are disabled here already. */
+        prvSetupTimerInterrupt();
+    }
 
     /* Start the first task. */
     vPortStartFirstTask();
@@ -318,7 +367,7 @@ void vPortClearInterruptMask( portBASE_TYPE xMask )
 }
 /*-----------------------------------------------------------*/
 
-static uint64_t prvGetTimeNs(void)
+static uint64_t prvGetTimeNs( void )
 {
 struct timespec t;
 
@@ -367,14 +416,12 @@ int iRet;
 }
 /*-----------------------------------------------------------*/
 
-static void vPortSystemTickHandler( int sig )
+static void prvProcessTick( void )
 {
 Thread_t *pxThreadToSuspend;
 Thread_t *pxThreadToResume;
 /* uint64_t xExpectedTicks; */
 
-    uxCriticalNesting++; /* Signals are blocked in this signal handler. */
-
 #if ( configUSE_PREEMPTION == 1 )
     pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 #endif
@@ -399,11 +446,238 @@ Thread_t *pxThreadToResume;
 
     prvSwitchThread(pxThreadToResume, pxThreadToSuspend);
 #endif
+}
+/*-----------------------------------------------------------*/
+
+static void vPortSystemTickHandler( int sig )
+{
+    uxCriticalNesting++; /* Signals are blocked in this signal handler. */
+
+    prvProcessTick();
 
     uxCriticalNesting--;
 }
 /*-----------------------------------------------------------*/
 
+void vPortSetVirtualTime( BaseType_t xEnable, uint32_t ulRealTimeRatio )
+{
+    xVirtualTimeEnabled = xEnable;
+    ulVirtualTimeRatio = ulRealTimeRatio;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsVirtualTimeEnabled( void )
+{
+    return xVirtualTimeEnabled;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetVirtualTimeBarrier( void ( *pxCallback )( uint64_t ullTicks ) )
+{
+    pthread_mutex_lock( &xVirtualTimeGrantMutex );
+    pxVirtualTimeBarrierCallback = pxCallback;
+    ullVirtualTimeReported = UINT64_MAX;
+    pthread_cond_broadcast( &xVirtualTimeGrantCond );
+    pthread_mutex_unlock( &xVirtualTimeGrantMutex );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGrantVirtualTime( uint64_t ullTicks )
+{
+    pthread_mutex_lock( &xVirtualTimeGrantMutex );
+
+    /* Grants can overtake each other, time never moves backwards. */
+    if ( ullTicks > ullVirtualTimeGrant )
+    {
+        ullVirtualTimeGrant = ullTicks;
+        pthread_cond_broadcast( &xVirtualTimeGrantCond );
+    }
+
+    pthread_mutex_unlock( &xVirtualTimeGrantMutex );
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetVirtualTicks( void )
+{
+    return ullVirtualTicks;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Limit a virtual time step to the granted tick when a barrier is set.
+ * Reports the barrier once per reached tick and waits up to one real
+ * tick for the next grant, so tasks woken by interrupts still run.
+ * Returns the number of ticks that may be stepped.
+ */
+static uint64_t prvWaitForVirtualTimeGrant( uint64_t ullTicks )
+{
+void ( *pxCallback )( uint64_t ullTicks ) = NULL;
+struct timespec xTimeout;
+uint64_t ullAvailable;
+
+    pthread_mutex_lock( &xVirtualTimeGrantMutex );
+
+    if ( pxVirtualTimeBarrierCallback == NULL )
+    {
+        pthread_mutex_unlock( &xVirtualTimeGrantMutex );
+        return ullTicks;
+    }
+
+    if ( ullVirtualTicks >= ullVirtualTimeGrant && ullVirtualTimeReported != ullVirtualTicks )
+    {
+        ullVirtualTimeReported = ullVirtualTicks;
+        pxCallback = pxVirtualTimeBarrierCallback;
+    }
+
+    pthread_mutex_unlock( &xVirtualTimeGrantMutex );
+
+    /* The callback may block on a socket, never call it with the mutex held. */
+    if ( pxCallback != NULL )
+    {
+        pxCallback( ullVirtualTicks );
+    }
+
+    pthread_mutex_lock( &xVirtualTimeGrantMutex );
+
+    if ( ullVirtualTicks >= ullVirtualTimeGrant && pxVirtualTimeBarrierCallback != NULL )
+    {
+        clock_gettime( CLOCK_REALTIME, &xTimeout );
+        xTimeout.tv_nsec += ( long )portTICK_PERIOD_NS;
+        if ( xTimeout.tv_nsec >= 1000000000L )
+        {
+            xTimeout.tv_sec++;
+            xTimeout.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait( &xVirtualTimeGrantCond, &xVirtualTimeGrantMutex, &xTimeout );
+    }
+
+    if ( pxVirtualTimeBarrierCallback == NULL )
+    {
+        ullAvailable = ullTicks;
+    }
+    else
+    {
+        ullAvailable = ( ullVirtualTimeGrant > ullVirtualTicks ) ? ullVirtualTimeGrant - ullVirtualTicks : 0U;
+    }
+
+    pthread_mutex_unlock( &xVirtualTimeGrantMutex );
+
+    return ( ullTicks < ullAvailable ) ? ullTicks : ullAvailable;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Wait until wall-clock time catches up with the virtual clock when a
+ * real-time ratio is set.
+ * Returns pdFALSE if the wait was interrupted by a signal (interrupt).
+ */
+static BaseType_t prvWaitForVirtualTime( uint64_t ullTargetTicks )
+{
+struct timespec xDeadline;
+uint64_t ullDeadlineNs;
+
+    if ( ulVirtualTimeRatio == 0U )
+    {
+        return pdTRUE;
+    }
+
+    ullDeadlineNs = ullVirtualStartTimeNs + ( ullTargetTicks * portTICK_PERIOD_NS ) / ulVirtualTimeRatio;
+    xDeadline.tv_sec = ( time_t )( ullDeadlineNs / 1000000000ULL );
+    xDeadline.tv_nsec = ( long )( ullDeadlineNs % 1000000000ULL );
+
+    return ( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xDeadline, NULL ) == 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Idle hook, called by the idle task when every other task is blocked.
+ * Generates one virtual tick. An application that defines its own idle
+ * hook must call vPortVirtualTimeIdle() from it.
+ */
+__attribute__((weak)) void vApplicationIdleHook( void )
+{
+    vPortVirtualTimeIdle();
+}
+
+void vPortVirtualTimeIdle( void )
+{
+    if ( !xVirtualTimeEnabled || xSchedulerEnd )
+    {
+        return;
+    }
+
+    if ( prvWaitForVirtualTimeGrant( 1U ) == 0U )
+    {
+        /* Held at the barrier, let the idle task run again. */
+        return;
+    }
+
+    while ( prvWaitForVirtualTime( ullVirtualTicks + 1U ) == pdFALSE )
+    {
+    }
+
+    ullVirtualTicks++;
+
+    /* Run the tick exactly as the SIGALRM handler would, on the thread
+     * of the current (idle) task. */
+    vPortEnterCritical();
+    prvProcessTick();
+    vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Tickless idle, called by the idle task with the scheduler suspended.
+ * Jumps the virtual tick count to the next task unblock time.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+TickType_t xTicksToJump = xExpectedIdleTime;
+TickType_t xGrantedTicks;
+uint64_t ullElapsedTicks;
+
+    if ( !xVirtualTimeEnabled )
+    {
+        /* The SIGALRM tick keeps running. */
+        return;
+    }
+
+    if ( xTaskGetTickCount() + xExpectedIdleTime == portMAX_DELAY )
+    {
+        /* No task is waiting on a timeout, only an interrupt can wake a
+         * task. Let virtual time follow wall-clock time meanwhile. */
+        struct timespec xTickPeriod = { .tv_sec = 0, .tv_nsec = ( long )portTICK_PERIOD_NS };
+        nanosleep( &xTickPeriod, NULL );
+        return;
+    }
+
+    xGrantedTicks = ( TickType_t )prvWaitForVirtualTimeGrant( xExpectedIdleTime );
+    if ( xGrantedTicks == 0U )
+    {
+        return;
+    }
+    xTicksToJump = xGrantedTicks;
+
+    if ( prvWaitForVirtualTime( ullVirtualTicks + xTicksToJump ) == pdFALSE )
+    {
+        /* Woken early by an interrupt, only step the ticks that passed. */
+        ullElapsedTicks = ( ( prvGetTimeNs() - ullVirtualStartTimeNs ) * ulVirtualTimeRatio ) / portTICK_PERIOD_NS;
+        xTicksToJump = ( ullElapsedTicks > ullVirtualTicks ) ? ( TickType_t )( ullElapsedTicks - ullVirtualTicks ) : 0U;
+        if ( xTicksToJump > xGrantedTicks )
+        {
+            xTicksToJump = xGrantedTicks;
+        }
+    }
+
+    if ( xTicksToJump > 0U )
+    {
+        ullVirtualTicks += xTicksToJump;
+        vTaskStepTick( xTicksToJump );
+    }
+}
+/*-----------------------------------------------------------*/
+
 void vPortThreadDying( void *pxTaskToDelete, volatile BaseType_t *pxPendYield )
 {
 Thread_t *pxThread = prvGetThreadFromTask( pxTaskToDelete );
@@ -112,6 +112,22 @@ void adc_deinit(void);
  *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
  */
 StatusCode adc_set_reading(GpioAddress *address, uint16_t reading);
+
+/**
+ * @brief   Returns the voltage in mV on an ADC pin at the moment it is converted
+ * @details Lets tests model hardware in front of the pin, such as an analog mux whose output depends on GPIO states
+ */
+typedef uint16_t (*AdcMockSource)(GpioAddress *address, void *context);
+
+/**
+ * @brief   Sets a source that is sampled for a Gpio address on every adc_run
+ * @param   address Specifies which Gpio to update
+ * @param   source Function returning the voltage in mV, or NULL to keep the last reading
+ * @param   context Passed to source on every conversion
+ * @return  STATUS_CODE_OK if the source is set successfully
+ *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
+ */
+StatusCode adc_set_mock_source(GpioAddress *address, AdcMockSource source, void *context);
 #endif
 
 /** @} */
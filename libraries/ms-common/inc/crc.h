@@ -32,6 +32,14 @@ typedef enum {
   NUM_CRC_LENGTHS /**< Number of CRC Length */
 } CRCLength;
 
+/**
+ * @brief   Running CRC of data fed in several pieces
+ * @details Uses the polynomial, initial value and input format selected by crc_init
+ */
+typedef struct {
+  uint32_t crc; /**< CRC of all data accumulated so far */
+} CRCContext;
+
 /**
  * @brief   Initilize the CRC API with default values
  * @param   crc_length Number of bits in the CRC
@@ -53,6 +61,29 @@ StatusCode crc_init(CRCLength crc_length);
  */
 uint32_t crc_calculate(const uint32_t *data, size_t length);
 
+/**
+ * @brief   Start an incremental CRC calculation
+ * @param   context Pointer to the CRC context to reset to the initial value
+ */
+void crc_start(CRCContext *context);
+
+/**
+ * @brief   Accumulate data into an incremental CRC calculation
+ * @details Feeding a buffer in several updates gives the same result as one crc_calculate call.
+ *          Length is in CRC-length words, as for crc_calculate
+ * @param   context Pointer to the CRC context
+ * @param   data Pointer to the buffer of 32-bit words
+ * @param   length Number of CRC-length words in the buffer
+ */
+void crc_update(CRCContext *context, const uint32_t *data, size_t length);
+
+/**
+ * @brief   Get the CRC of all data accumulated into a context
+ * @param   context Pointer to the CRC context
+ * @return  Computed CRC checksum
+ */
+uint32_t crc_finalize(const CRCContext *context);
+
 /**
  * @brief   Reset the CRC hardware peripheral
  * @details This function forces a reset of the CRC peripheral and then releases the reset,
@@ -10,6 +10,7 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -93,4 +94,40 @@ StatusCode flash_write(uintptr_t address, uint8_t *buffer, size_t buffer_len);
  */
 StatusCode flash_erase(uint8_t start_page, uint8_t num_pages);
 
+#ifdef MS_PLATFORM_X86
+
+/** @brief  Typical page erase time in microseconds as per the STM32L433xx datasheet */
+#define FLASH_TYPICAL_ERASE_LATENCY_US 22000U
+
+/** @brief  Typical double word program time in microseconds as per the STM32L433xx datasheet */
+#define FLASH_TYPICAL_PROGRAM_LATENCY_US 82U
+
+/**
+ * @brief   Enable or disable strict NOR programming checks
+ * @details Writes can only clear bits. By default a write is ANDed into the existing contents.
+ *          In strict mode a write that would set a cleared bit is rejected and logged, which
+ *          matches the programming error raised by the hardware
+ * @param   strict True to reject writes to bits that have not been erased
+ */
+void flash_set_strict_mode(bool strict);
+
+/**
+ * @brief   Set the simulated flash latencies
+ * @details Erase and write calls sleep for the given time to keep x86 timing representative.
+ *          The latency is disabled by default. The sleep happens after the flash lock is released
+ * @note    Simulations that depend on flash timing opt in with FLASH_TYPICAL_ERASE_LATENCY_US and
+ *          FLASH_TYPICAL_PROGRAM_LATENCY_US
+ * @param   erase_page_us Time to erase one page in microseconds
+ * @param   program_double_word_us Time to program one 8-byte double word in microseconds
+ */
+void flash_set_latency(uint32_t erase_page_us, uint32_t program_double_word_us);
+
+/**
+ * @brief   Peeks at the number of times a flash page has been erased
+ * @param   page Flash page number
+ * @return  Number of erases of the page since flash_init(), 0 if the page is out of range
+ */
+uint32_t flash_peek_erase_count(uint8_t page);
+#endif
+
 /** @} */
@@ -27,8 +27,8 @@
 
 /** @brief  Maximum time permitted for a SPI transaction */
 #define SPI_TIMEOUT_MS 100U
-/** @brief  None of our SPI transactions should need to be longer than 32 bytes */
-#define SPI_MAX_NUM_DATA 32U
+/** @brief  Longest SPI transaction, sized for sensor FIFO burst reads */
+#define SPI_MAX_NUM_DATA 128U
 
 /** @brief  SPI Port selection */
 typedef enum {
@@ -181,6 +181,23 @@ StatusCode spi_set_rx(SpiPort spi, const uint8_t *data, uint8_t len);
  */
 size_t spi_get_tx_num_bytes(SpiPort spi);
 
+/**
+ * @brief   Simulated SPI device, answering each transaction in place of the RX/TX queues
+ * @details Called with the bytes clocked out, fills the bytes clocked back in like a real device would.
+ *          This lets stateful devices such as sensor FIFOs be modelled in tests
+ */
+typedef StatusCode (*SpiMockDevice)(const uint8_t *tx_data, size_t tx_len, uint8_t *rx_data, size_t rx_len, void *context);
+
+/**
+ * @brief   Attaches a simulated device to a SPI port
+ * @param   spi Specifies which SPI port the device is on
+ * @param   device Device callback, or NULL to go back to the RX/TX queues
+ * @param   context Pointer passed to every device call
+ * @return  STATUS_CODE_OK if the device is attached successfully
+ *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
+ */
+StatusCode spi_set_mock_device(SpiPort spi, SpiMockDevice device, void *context);
+
 #endif
 
 /** @} */
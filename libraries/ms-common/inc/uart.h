@@ -10,6 +10,7 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <stddef.h>
 #include <stdint.h>
 
 /* Inter-component Headers */
@@ -96,4 +97,45 @@ StatusCode uart_rx(UartPort uart, uint8_t *data, size_t len);
  */
 StatusCode uart_tx(UartPort uart, uint8_t *data, size_t len);
 
+/**
+ * @brief   Start a transmission from the UART port without waiting for it to complete
+ * @details Data is moved to the peripheral by DMA (interrupts on UART_PORT_3), so the caller
+ *          can prepare the next buffer while this one is on the wire. The buffer must not be
+ *          modified until uart_tx_wait() returns STATUS_CODE_OK. Only one transmission can be in
+ *          flight per port, and the port is held until it is waited on. Sends up to UART_MAX_BUFFER_LEN.
+ * @param   uart Specifies which UART port to transmit on
+ * @param   data Pointer to the data buffer
+ * @param   len Length of data to transmit
+ * @return  STATUS_CODE_OK if the transmission started
+ *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
+ *          STATUS_CODE_UNINITIALIZED if the port is not initialized
+ *          STATUS_CODE_RESOURCE_EXHAUSTED if a transmission is already in flight
+ *          STATUS_CODE_TIMEOUT if the port is held by another transfer
+ *          STATUS_CODE_INTERNAL_ERROR if HAL transmission fails
+ */
+StatusCode uart_tx_async(UartPort uart, uint8_t *data, size_t len);
+
+/**
+ * @brief   Wait for the transmission started by uart_tx_async() to complete
+ * @param   uart Specifies which UART port to wait on
+ * @param   timeout_ms Maximum time to wait in milliseconds
+ * @return  STATUS_CODE_OK if the transmission completed or none was in flight
+ *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
+ *          STATUS_CODE_TIMEOUT if the transmission is still in flight
+ */
+StatusCode uart_tx_wait(UartPort uart, uint32_t timeout_ms);
+
+#ifdef MS_PLATFORM_X86
+
+/**
+ * @brief   Get the number of bytes transmitted on a simulated UART port
+ * @details Transmissions occupy the port for the time the configured baudrate needs with
+ *          8N1 framing, measured in FreeRTOS ticks, so the byte count over time gives the
+ *          throughput achievable on hardware
+ * @param   uart Specifies which UART port to inspect
+ * @return  Number of bytes transmitted since initialization
+ */
+uint32_t uart_peek_tx_bytes(UartPort uart);
+#endif
+
 /** @} */
@@ -64,6 +64,34 @@ uint32_t crc_calculate(const uint32_t *data, size_t length) {
   return HAL_CRC_Calculate(&s_crc_handle, (uint32_t *)data, length);
 }
 
+void crc_start(CRCContext *context) {
+  if (context == NULL) {
+    return;
+  }
+
+  context->crc = s_crc_handle.Init.InitValue;
+}
+
+void crc_update(CRCContext *context, const uint32_t *data, size_t length) {
+  if (context == NULL || data == NULL || length == 0U) {
+    return;
+  }
+
+  /* Resume from the context's running CRC, then restore the initial value for crc_calculate */
+  WRITE_REG(s_crc_handle.Instance->INIT, context->crc);
+  __HAL_CRC_DR_RESET(&s_crc_handle);
+  context->crc = HAL_CRC_Accumulate(&s_crc_handle, (uint32_t *)data, length);
+  WRITE_REG(s_crc_handle.Instance->INIT, s_crc_handle.Init.InitValue);
+}
+
+uint32_t crc_finalize(const CRCContext *context) {
+  if (context == NULL) {
+    return 0U;
+  }
+
+  return context->crc;
+}
+
 void crc_reset(void) {
   __HAL_RCC_CRC_FORCE_RESET();
   __HAL_RCC_CRC_RELEASE_RESET();
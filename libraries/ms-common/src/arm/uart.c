@@ -13,6 +13,7 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "stm32l4xx.h"
+#include "stm32l4xx_hal_dma.h"
 #include "stm32l4xx_hal_conf.h"
 #include "stm32l4xx_hal_rcc.h"
 #include "stm32l4xx_hal_rcc_ex.h"
@@ -39,15 +40,22 @@ static inline void s_enable_usart3(void) {
 
 /** @brief  UART Port data */
 typedef struct {
-  USART_TypeDef *base;   /**< UART HW Base address */
-  void (*rcc_cmd)(void); /**< Function pointer to enable UART clock using RCC */
-  uint8_t irq;           /**< UART interrupt number */
-  bool initialized;      /**< Initialized flag */
+  USART_TypeDef *base;                 /**< UART HW Base address */
+  void (*rcc_cmd)(void);               /**< Function pointer to enable UART clock using RCC */
+  uint8_t irq;                         /**< UART interrupt number */
+  DMA_Channel_TypeDef *tx_dma_channel; /**< DMA1 channel serving UART TX requests */
+  uint8_t tx_dma_irq;                  /**< DMA1 channel interrupt number */
+  bool tx_in_flight;                   /**< Asynchronous transmission started and not yet waited on */
+  bool initialized;                    /**< Initialized flag */
 } UartPortData;
 
-static UartPortData s_port[NUM_UART_PORTS] = { [UART_PORT_1] = { .rcc_cmd = s_enable_usart1, .irq = USART1_IRQn, .base = USART1, .initialized = false },
-                                               [UART_PORT_2] = { .rcc_cmd = s_enable_usart2, .irq = USART2_IRQn, .base = USART2, .initialized = false },
-                                               [UART_PORT_3] = { .rcc_cmd = s_enable_usart3, .irq = USART3_IRQn, .base = USART3, .initialized = false } };
+/* TX DMA channels follow the DMA1 request 2 mapping of the reference manual.
+ * USART3 TX would use DMA1 channel 2, which is reserved for the steering LED driver, so it falls back to interrupts */
+static UartPortData s_port[NUM_UART_PORTS] = {
+  [UART_PORT_1] = { .rcc_cmd = s_enable_usart1, .irq = USART1_IRQn, .base = USART1, .tx_dma_channel = DMA1_Channel4, .tx_dma_irq = DMA1_Channel4_IRQn, .initialized = false },
+  [UART_PORT_2] = { .rcc_cmd = s_enable_usart2, .irq = USART2_IRQn, .base = USART2, .tx_dma_channel = DMA1_Channel7, .tx_dma_irq = DMA1_Channel7_IRQn, .initialized = false },
+  [UART_PORT_3] = { .rcc_cmd = s_enable_usart3, .irq = USART3_IRQn, .base = USART3, .tx_dma_channel = NULL, .initialized = false }
+};
 
 static const uint16_t s_uart_flow_control_map[] = {
   [UART_FLOW_CONTROL_NONE] = UART_HWCONTROL_NONE,
@@ -57,6 +65,7 @@ static const uint16_t s_uart_flow_control_map[] = {
 };
 
 static UART_HandleTypeDef s_uart_handles[NUM_UART_PORTS];
+static DMA_HandleTypeDef s_uart_tx_dma_handles[NUM_UART_PORTS];
 
 /* Mutex for port access */
 static StaticSemaphore_t s_uart_port_mutex[NUM_UART_PORTS];
@@ -129,6 +138,14 @@ void USART3_IRQHandler(void) {
   HAL_UART_IRQHandler(&s_uart_handles[UART_PORT_3]);
 }
 
+void DMA1_Channel4_IRQHandler(void) {
+  HAL_DMA_IRQHandler(&s_uart_tx_dma_handles[UART_PORT_1]);
+}
+
+void DMA1_Channel7_IRQHandler(void) {
+  HAL_DMA_IRQHandler(&s_uart_tx_dma_handles[UART_PORT_2]);
+}
+
 /* Callback functions for HAL UART TX */
 void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
   s_uart_transfer_complete_callback(huart, false);
@@ -147,6 +164,60 @@ StatusCode uart_tx(UartPort uart, uint8_t *data, size_t len) {
   return s_uart_transfer(uart, data, len, false);
 }
 
+StatusCode uart_tx_async(UartPort uart, uint8_t *data, size_t len) {
+  if (data == NULL || uart >= NUM_UART_PORTS || len == 0U || len > UART_MAX_BUFFER_LEN) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!s_port[uart].initialized) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  if (s_port[uart].tx_in_flight) {
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  /* The port mutex is held until uart_tx_wait() so blocking transfers cannot interleave */
+  if (xSemaphoreTake(s_uart_port_handle[uart], pdMS_TO_TICKS(UART_TIMEOUT_MS)) != pdTRUE) {
+    return STATUS_CODE_TIMEOUT;
+  }
+
+  HAL_StatusTypeDef status;
+  if (s_port[uart].tx_dma_channel != NULL) {
+    status = HAL_UART_Transmit_DMA(&s_uart_handles[uart], data, len);
+  } else {
+    status = HAL_UART_Transmit_IT(&s_uart_handles[uart], data, len);
+  }
+
+  if (status != HAL_OK) {
+    xSemaphoreGive(s_uart_port_handle[uart]);
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  s_port[uart].tx_in_flight = true;
+
+  return STATUS_CODE_OK;
+}
+
+StatusCode uart_tx_wait(UartPort uart, uint32_t timeout_ms) {
+  if (uart >= NUM_UART_PORTS) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!s_port[uart].tx_in_flight) {
+    return STATUS_CODE_OK;
+  }
+
+  if (xSemaphoreTake(s_uart_cmplt_handle[uart], pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+    return STATUS_CODE_TIMEOUT;
+  }
+
+  s_port[uart].tx_in_flight = false;
+  xSemaphoreGive(s_uart_port_handle[uart]);
+
+  return STATUS_CODE_OK;
+}
+
 StatusCode uart_init(UartPort uart, UartSettings *settings) {
   if (settings == NULL) {
     return STATUS_CODE_INVALID_ARGS;
@@ -207,6 +278,27 @@ StatusCode uart_init(UartPort uart, UartSettings *settings) {
     return STATUS_CODE_INTERNAL_ERROR;
   }
 
+  /* Initialize TX DMA, used by uart_tx_async() */
+  if (s_port[uart].tx_dma_channel != NULL) {
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    s_uart_tx_dma_handles[uart].Instance = s_port[uart].tx_dma_channel;
+    s_uart_tx_dma_handles[uart].Init.Request = DMA_REQUEST_2;
+    s_uart_tx_dma_handles[uart].Init.Direction = DMA_MEMORY_TO_PERIPH;
+    s_uart_tx_dma_handles[uart].Init.PeriphInc = DMA_PINC_DISABLE;
+    s_uart_tx_dma_handles[uart].Init.MemInc = DMA_MINC_ENABLE;
+    s_uart_tx_dma_handles[uart].Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    s_uart_tx_dma_handles[uart].Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    s_uart_tx_dma_handles[uart].Init.Mode = DMA_NORMAL;
+    s_uart_tx_dma_handles[uart].Init.Priority = DMA_PRIORITY_LOW;
+
+    if (HAL_DMA_Init(&s_uart_tx_dma_handles[uart]) != HAL_OK) {
+      return STATUS_CODE_INTERNAL_ERROR;
+    }
+    __HAL_LINKDMA(&s_uart_handles[uart], hdmatx, s_uart_tx_dma_handles[uart]);
+
+    interrupt_nvic_enable(s_port[uart].tx_dma_irq, INTERRUPT_PRIORITY_HIGH);
+  }
+
   /* Initialize interrupts */
   interrupt_nvic_enable(s_port[uart].irq, INTERRUPT_PRIORITY_HIGH);
 
@@ -13,7 +13,6 @@
 
 /* Inter-component Headers */
 #include "FreeRTOS.h"
-#include "delay.h"
 #include "semphr.h"
 
 /* Intra-component Headers */
@@ -23,6 +22,12 @@
 #define ADC_MAX_VAL 4095U
 #define MAX_ADC_READINGS 16U
 
+typedef struct AdcMockChannel {
+  GpioAddress address;
+  AdcMockSource source;
+  void *context;
+} AdcMockChannel;
+
 typedef struct AdcStatus {
   bool initialized;
   uint8_t active_channels;
@@ -39,6 +44,9 @@ static volatile uint16_t s_adc_readings[MAX_ADC_READINGS];
 /* Store of ranks for each channel, at their channel index */
 static uint8_t s_adc_ranks[NUM_ADC_CHANNELS];
 
+/* Sources sampled on every conversion, at their channel index */
+static AdcMockChannel s_adc_mock_channels[NUM_ADC_CHANNELS];
+
 /* Convert GPIO address to one of the 16 ADC channels */
 /* Channels 1-4 are occupied by pins C0-C3 */
 /* Channels 5-12 are occupied by pins A0-A7 */
@@ -88,8 +96,19 @@ static StatusCode s_check_channel_enabled(uint8_t channel) {
   }
 }
 
+static uint16_t s_mv_to_raw(uint16_t reading_mv) {
+  return (reading_mv * ADC_MAX_VAL) / VREFINT_MV;
+}
+
+/* Sample every source in rank order, as the DMA transfer of a scan would, then signal completion */
 static void s_adc_mock_reading(void) {
-  delay_ms(25);
+  for (uint8_t channel = 0U; channel < NUM_ADC_CHANNELS; channel++) {
+    AdcMockChannel *mock = &s_adc_mock_channels[channel];
+    if (mock->source != NULL && s_check_channel_enabled(channel) == STATUS_CODE_OK) {
+      s_adc_readings[s_adc_ranks[channel] - 1U] = s_mv_to_raw(mock->source(&mock->address, mock->context));
+    }
+  }
+
   xSemaphoreGive(s_adc_status.converting_handle);
 }
 
@@ -135,7 +154,7 @@ StatusCode adc_run(void) {
     return STATUS_CODE_TIMEOUT;
   }
 
-  return STATUS_CODE_UNIMPLEMENTED;
+  return STATUS_CODE_OK;
 }
 
 StatusCode adc_read_raw(GpioAddress *address, uint16_t *reading) {
@@ -169,6 +188,7 @@ void adc_deinit(void) {
   memset(&s_adc_status, 0, sizeof(s_adc_status));
   memset(s_adc_readings, 0, sizeof(uint16_t) * MAX_ADC_READINGS);
   memset(s_adc_ranks, 0, sizeof(uint8_t) * NUM_ADC_CHANNELS);
+  memset(s_adc_mock_channels, 0, sizeof(s_adc_mock_channels));
 }
 
 StatusCode adc_set_reading(GpioAddress *address, uint16_t reading) {
@@ -181,6 +201,21 @@ StatusCode adc_set_reading(GpioAddress *address, uint16_t reading) {
   status_ok_or_return(s_check_channel_enabled(channel));
 
   /* We will convert our passed value in mV to a raw reading */
-  s_adc_readings[s_adc_ranks[channel] - 1U] = (reading * ADC_MAX_VAL) / VREFINT_MV;
+  s_adc_readings[s_adc_ranks[channel] - 1U] = s_mv_to_raw(reading);
+  return STATUS_CODE_OK;
+}
+
+StatusCode adc_set_mock_source(GpioAddress *address, AdcMockSource source, void *context) {
+  if (address == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  uint8_t channel;
+  status_ok_or_return(s_adc_get_channel(address, &channel));
+  status_ok_or_return(s_check_channel_enabled(channel));
+
+  s_adc_mock_channels[channel].address = *address;
+  s_adc_mock_channels[channel].source = source;
+  s_adc_mock_channels[channel].context = context;
   return STATUS_CODE_OK;
 }
@@ -0,0 +1,172 @@
+/************************************************************************************************
+ * @file   crc.c
+ *
+ * @brief  CRC Library Source file
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <endian.h>
+#include <string.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "crc.h"
+
+/* Software model of the STM32 CRC unit, bit-exact with the hardware so x86 builds compute the same values as the board */
+
+#define CRC_TABLE_SLICES 8U
+
+/** @brief  Settings programmed into the CRC unit by crc_init */
+typedef struct {
+  uint32_t polynomial; /**< Generating polynomial, without the leading bit */
+  uint32_t init_value; /**< Value the CRC starts from */
+  uint8_t width_bits;  /**< Number of bits in the CRC */
+  uint8_t input_bytes; /**< Size of each input word, matching the input data format */
+} CRCSettings;
+
+static const CRCSettings s_crc_settings[NUM_CRC_LENGTHS] = {
+  [CRC_LENGTH_8] = { .polynomial = 0x07U, .init_value = 0xFFU, .width_bits = 8U, .input_bytes = 1U },
+  [CRC_LENGTH_16] = { .polynomial = 0x1021U, .init_value = 0xFFFFU, .width_bits = 16U, .input_bytes = 2U },
+  [CRC_LENGTH_32] = { .polynomial = 0x04C11DB7U, .init_value = 0xFFFFFFFFU, .width_bits = 32U, .input_bytes = 4U },
+};
+
+/* The CRC unit comes out of reset as CRC-32, the table is rebuilt lazily whenever the length changes */
+static CRCLength s_crc_length = CRC_LENGTH_32;
+static CRCLength s_table_length = NUM_CRC_LENGTHS;
+
+/* s_crc_table[k][b] is the CRC of byte b followed by k zero bytes, so eight bytes fold in with eight lookups */
+static uint32_t s_crc_table[CRC_TABLE_SLICES][256U];
+
+static void s_build_table(void) {
+  const CRCSettings *settings = &s_crc_settings[s_crc_length];
+  uint32_t top_bit = 1U << (settings->width_bits - 1U);
+  uint32_t mask = (settings->width_bits == 32U) ? 0xFFFFFFFFU : (1U << settings->width_bits) - 1U;
+
+  for (uint32_t byte = 0U; byte < 256U; ++byte) {
+    uint32_t crc = byte << (settings->width_bits - 8U);
+
+    for (uint8_t bit = 0U; bit < 8U; ++bit) {
+      crc = (crc & top_bit) ? ((crc << 1U) ^ settings->polynomial) : (crc << 1U);
+    }
+
+    s_crc_table[0U][byte] = crc & mask;
+  }
+
+  /* Slicing is only used for CRC-32, the narrower lengths go a byte at a time */
+  if (s_crc_length == CRC_LENGTH_32) {
+    for (uint32_t slice = 1U; slice < CRC_TABLE_SLICES; ++slice) {
+      for (uint32_t byte = 0U; byte < 256U; ++byte) {
+        uint32_t previous = s_crc_table[slice - 1U][byte];
+        s_crc_table[slice][byte] = (previous << 8U) ^ s_crc_table[0U][previous >> 24U];
+      }
+    }
+  }
+
+  s_table_length = s_crc_length;
+}
+
+/* Words are stored little-endian and shifted in MSB first, like writes to the CRC data register */
+static uint32_t s_read_word(const uint8_t *data) {
+  uint32_t word;
+  memcpy(&word, data, sizeof(word));
+  return le32toh(word);
+}
+
+static uint32_t s_accumulate_32(uint32_t crc, const uint8_t *data, size_t length) {
+  while (length >= 2U) {
+    uint32_t high = crc ^ s_read_word(data);
+    uint32_t low = s_read_word(data + sizeof(uint32_t));
+
+    crc = s_crc_table[7U][high >> 24U] ^ s_crc_table[6U][(high >> 16U) & 0xFFU] ^ s_crc_table[5U][(high >> 8U) & 0xFFU] ^ s_crc_table[4U][high & 0xFFU] ^
+          s_crc_table[3U][low >> 24U] ^ s_crc_table[2U][(low >> 16U) & 0xFFU] ^ s_crc_table[1U][(low >> 8U) & 0xFFU] ^ s_crc_table[0U][low & 0xFFU];
+
+    data += 2U * sizeof(uint32_t);
+    length -= 2U;
+  }
+
+  if (length > 0U) {
+    uint32_t word = crc ^ s_read_word(data);
+    crc = s_crc_table[3U][word >> 24U] ^ s_crc_table[2U][(word >> 16U) & 0xFFU] ^ s_crc_table[1U][(word >> 8U) & 0xFFU] ^ s_crc_table[0U][word & 0xFFU];
+  }
+
+  return crc;
+}
+
+/* CRC-8 takes bytes in memory order, CRC-16 takes little-endian halfwords MSB first */
+static uint32_t s_accumulate_narrow(uint32_t crc, const uint8_t *data, size_t length) {
+  const CRCSettings *settings = &s_crc_settings[s_crc_length];
+  uint32_t mask = (1U << settings->width_bits) - 1U;
+
+  for (size_t i = 0U; i < length; ++i) {
+    for (int8_t byte = (int8_t)settings->input_bytes - 1; byte >= 0; --byte) {
+      uint8_t input = data[byte];
+      crc = ((crc << 8U) ^ s_crc_table[0U][((crc >> (settings->width_bits - 8U)) ^ input) & 0xFFU]) & mask;
+    }
+    data += settings->input_bytes;
+  }
+
+  return crc;
+}
+
+static uint32_t s_accumulate(uint32_t crc, const uint32_t *data, size_t length) {
+  if (s_table_length != s_crc_length) {
+    s_build_table();
+  }
+
+  if (s_crc_length == CRC_LENGTH_32) {
+    return s_accumulate_32(crc, (const uint8_t *)data, length);
+  }
+
+  return s_accumulate_narrow(crc, (const uint8_t *)data, length);
+}
+
+StatusCode crc_init(CRCLength crc_length) {
+  if (crc_length >= NUM_CRC_LENGTHS) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  s_crc_length = crc_length;
+  s_build_table();
+
+  return STATUS_CODE_OK;
+}
+
+uint32_t crc_calculate(const uint32_t *data, size_t length) {
+  if (data == NULL) {
+    return 0U;
+  }
+
+  return s_accumulate(s_crc_settings[s_crc_length].init_value, data, length);
+}
+
+void crc_start(CRCContext *context) {
+  if (context == NULL) {
+    return;
+  }
+
+  context->crc = s_crc_settings[s_crc_length].init_value;
+}
+
+void crc_update(CRCContext *context, const uint32_t *data, size_t length) {
+  if (context == NULL || data == NULL) {
+    return;
+  }
+
+  context->crc = s_accumulate(context->crc, data, length);
+}
+
+uint32_t crc_finalize(const CRCContext *context) {
+  if (context == NULL) {
+    return 0U;
+  }
+
+  return context->crc;
+}
+
+void crc_reset(void) {
+  s_crc_length = CRC_LENGTH_32;
+}
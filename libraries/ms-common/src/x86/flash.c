@@ -8,14 +8,18 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <errno.h>
+#include <fcntl.h>
 #include <pthread.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 /* Inter-component Headers */
 #include "log.h"
-#include "semphr.h"
 #include "status.h"
 
 /* Intra-component Headers */
@@ -24,10 +28,12 @@
 /* Symbols from linker-scripts */
 // None are used in this case
 
+#ifndef FLASH_FILENAME
 #define FLASH_FILENAME "Midsun_x86_flash"
+#endif
 
-static pthread_mutex_t s_flash_mutex;
-static FILE *s_flash_fp = NULL;
+/** @brief  Value of an erased flash byte */
+#define FLASH_ERASED_BYTE 0xFFU
 
 #ifndef _flash_start
 #define _flash_start 0x08000000
@@ -41,6 +47,16 @@ static FILE *s_flash_fp = NULL;
 #define _flash_size 0x040000
 #endif
 
+static pthread_mutex_t s_flash_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Flash file mapped into memory, offset 0 is _flash_start */
+static uint8_t *s_flash_memory = NULL;
+
+static bool s_strict_mode = false;
+static uint32_t s_erase_latency_us = 0U;
+static uint32_t s_program_latency_us = 0U;
+static uint32_t s_erase_count[NUM_FLASH_PAGES];
+
 static StatusCode s_validate_address(uintptr_t address, size_t size) {
   /* Check memory alignment */
   if (address % FLASH_MEMORY_ALIGNMENT != 0U || size % FLASH_MEMORY_ALIGNMENT != 0U) {
@@ -56,49 +72,87 @@ static StatusCode s_validate_address(uintptr_t address, size_t size) {
   return STATUS_CODE_OK;
 }
 
+static void s_simulate_latency(uint64_t latency_us) {
+  if (latency_us == 0U) {
+    return;
+  }
+
+  struct timespec remaining = { .tv_sec = (time_t)(latency_us / 1000000U), .tv_nsec = (long)((latency_us % 1000000U) * 1000U) };
+
+  /* The FreeRTOS tick signal interrupts the sleep, so continue with the remaining time */
+  while (nanosleep(&remaining, &remaining) != 0 && errno == EINTR) {
+  }
+}
+
 StatusCode flash_init() {
-  char *flash_filename = FLASH_FILENAME;
+  pthread_mutex_lock(&s_flash_mutex);
+
+  if (s_flash_memory != NULL) {
+    pthread_mutex_unlock(&s_flash_mutex);
+    return STATUS_CODE_OK;
+  }
 
-  LOG_DEBUG("Using flash file: %s\n", flash_filename);
+  LOG_DEBUG("Using flash file: %s\n", FLASH_FILENAME);
 
   // Opening the file or creating a new one if it does not exist
-  s_flash_fp = fopen(flash_filename, "r+b");
-  if (s_flash_fp == NULL) {
-    LOG_DEBUG("Setting up new flash file...\n");
-    s_flash_fp = fopen(flash_filename, "w+b");
-    if (s_flash_fp == NULL) {
-      LOG_DEBUG("Error: could not open flash file\n");
-      exit(EXIT_FAILURE);
+  int fd = open(FLASH_FILENAME, O_RDWR | O_CREAT, 0644);
+  struct stat file_stat;
+
+  if (fd < 0 || fstat(fd, &file_stat) != 0) {
+    LOG_DEBUG("Error: could not open flash file\n");
+    if (fd >= 0) {
+      close(fd);
     }
-    flash_erase(0, NUM_FLASH_PAGES);
+    pthread_mutex_unlock(&s_flash_mutex);
+    return STATUS_CODE_INTERNAL_ERROR;
   }
 
-  // Initializing the mutex
-  if (pthread_mutex_init(&s_flash_mutex, NULL) == 0) {
-    return STATUS_CODE_OK;
-  } else {
+  size_t existing_size = (size_t)file_stat.st_size;
+  if (existing_size < (size_t)_flash_size && ftruncate(fd, (off_t)_flash_size) != 0) {
+    close(fd);
+    pthread_mutex_unlock(&s_flash_mutex);
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  void *memory = mmap(NULL, (size_t)_flash_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+  /* The mapping keeps the file referenced, so the descriptor is no longer needed */
+  close(fd);
+
+  if (memory == MAP_FAILED) {
+    LOG_DEBUG("Error: could not map flash file\n");
+    pthread_mutex_unlock(&s_flash_mutex);
     return STATUS_CODE_INTERNAL_ERROR;
   }
+
+  s_flash_memory = memory;
+
+  // A new or grown flash file starts out erased
+  if (existing_size < (size_t)_flash_size) {
+    LOG_DEBUG("Setting up new flash file...\n");
+    memset(s_flash_memory + existing_size, FLASH_ERASED_BYTE, (size_t)_flash_size - existing_size);
+  }
+
+  memset(s_erase_count, 0, sizeof(s_erase_count));
+
+  pthread_mutex_unlock(&s_flash_mutex);
+  return STATUS_CODE_OK;
 }
 
 StatusCode flash_read(uintptr_t address, uint8_t *buffer, size_t buffer_len) {
-  if (buffer == NULL || s_validate_address(address, buffer_len) != 0) {
+  if (buffer == NULL || s_validate_address(address, buffer_len) != STATUS_CODE_OK) {
     return STATUS_CODE_INVALID_ARGS;
   }
 
-  pthread_mutex_lock(&s_flash_mutex);
-
-  fseek(s_flash_fp, (intptr_t)address, SEEK_SET);
-  size_t read = fread(buffer, 1, buffer_len, s_flash_fp);
+  if (s_flash_memory == NULL) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
 
+  pthread_mutex_lock(&s_flash_mutex);
+  memcpy(buffer, s_flash_memory + (address - (uint32_t)_flash_start), buffer_len);
   pthread_mutex_unlock(&s_flash_mutex);
 
-  // Check if the number of objects read is less than buffer length to see if an error occured
-  if (read < buffer_len) {
-    return STATUS_CODE_INTERNAL_ERROR;
-  } else {
-    return STATUS_CODE_OK;
-  }
+  return STATUS_CODE_OK;
 }
 
 StatusCode flash_write(uintptr_t address, uint8_t *buffer, size_t buffer_len) {
@@ -106,18 +160,37 @@ StatusCode flash_write(uintptr_t address, uint8_t *buffer, size_t buffer_len) {
     return STATUS_CODE_INVALID_ARGS;
   }
 
+  if (s_flash_memory == NULL) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
   pthread_mutex_lock(&s_flash_mutex);
 
-  // Erase all memory to overwrite
-  flash_erase(0, 128);
+  uint8_t *destination = s_flash_memory + (address - (uint32_t)_flash_start);
 
-  // Seek to memeory address and write
-  fseek(s_flash_fp, (intptr_t)address, SEEK_SET);
-  fwrite(buffer, 1, buffer_len, s_flash_fp);
-  fflush(s_flash_fp);
+  /* NOR flash can only clear bits, setting a bit requires erasing the page */
+  if (s_strict_mode) {
+    for (size_t i = 0U; i < buffer_len; i++) {
+      if ((destination[i] & buffer[i]) != buffer[i]) {
+        LOG_WARN("Flash write to unerased memory at 0x%08lx\n", (unsigned long)(address + i));
+        pthread_mutex_unlock(&s_flash_mutex);
+        return STATUS_CODE_INTERNAL_ERROR;
+      }
+    }
+  }
+
+  for (size_t i = 0U; i < buffer_len; i++) {
+    destination[i] &= buffer[i];
+  }
+
+  size_t num_double_words = (buffer_len + FLASH_MEMORY_WRITE_ALIGNMENT - 1U) / FLASH_MEMORY_WRITE_ALIGNMENT;
+  uint64_t latency_us = (uint64_t)num_double_words * s_program_latency_us;
 
   pthread_mutex_unlock(&s_flash_mutex);
 
+  /* Sleep without the lock so readers and other writers are not stalled */
+  s_simulate_latency(latency_us);
+
   return STATUS_CODE_OK;
 }
 
@@ -126,24 +199,55 @@ StatusCode flash_erase(uint8_t start_page, uint8_t num_pages) {
     return STATUS_CODE_INVALID_ARGS;
   }
 
-  pthread_mutex_lock(&s_flash_mutex);
+  uintptr_t address = FLASH_PAGE_TO_ADDR(start_page);
+  size_t erase_size = (size_t)num_pages * FLASH_PAGE_SIZE;
 
-  size_t buffer_size = (num_pages - start_page) * FLASH_PAGE_SIZE;
-  char *buffer = malloc(buffer_size);
+  if (s_validate_address(address, erase_size) != STATUS_CODE_OK) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
 
-  if (buffer == NULL) {
-    pthread_mutex_unlock(&s_flash_mutex);
-    return STATUS_CODE_INTERNAL_ERROR;
+  if (s_flash_memory == NULL) {
+    return STATUS_CODE_UNINITIALIZED;
   }
 
-  memset(buffer, 0xFF, buffer_size);
+  pthread_mutex_lock(&s_flash_mutex);
+
+  memset(s_flash_memory + (address - (uint32_t)_flash_start), FLASH_ERASED_BYTE, erase_size);
+
+  for (uint8_t page = start_page; page < start_page + num_pages; page++) {
+    s_erase_count[page]++;
+  }
 
-  fseek(s_flash_fp, (intptr_t)FLASH_PAGE_TO_ADDR(start_page), SEEK_SET);
-  fwrite(buffer, 1, buffer_size, s_flash_fp);
-  fflush(s_flash_fp);
+  uint64_t latency_us = (uint64_t)num_pages * s_erase_latency_us;
 
-  free(buffer);
   pthread_mutex_unlock(&s_flash_mutex);
 
+  s_simulate_latency(latency_us);
+
   return STATUS_CODE_OK;
 }
+
+void flash_set_strict_mode(bool strict) {
+  pthread_mutex_lock(&s_flash_mutex);
+  s_strict_mode = strict;
+  pthread_mutex_unlock(&s_flash_mutex);
+}
+
+void flash_set_latency(uint32_t erase_page_us, uint32_t program_double_word_us) {
+  pthread_mutex_lock(&s_flash_mutex);
+  s_erase_latency_us = erase_page_us;
+  s_program_latency_us = program_double_word_us;
+  pthread_mutex_unlock(&s_flash_mutex);
+}
+
+uint32_t flash_peek_erase_count(uint8_t page) {
+  if (page >= NUM_FLASH_PAGES) {
+    return 0U;
+  }
+
+  pthread_mutex_lock(&s_flash_mutex);
+  uint32_t count = s_erase_count[page];
+  pthread_mutex_unlock(&s_flash_mutex);
+
+  return count;
+}
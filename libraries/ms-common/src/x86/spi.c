@@ -31,6 +31,8 @@ typedef struct {
   SpiBuffer spi_rx_buf;
   SpiMode spi_mode;
   volatile uint8_t num_rx_bytes;
+  SpiMockDevice device;
+  void *device_context;
 } SPIPortData;
 
 // only supported ports for SPI im MPXE are port 1 and port 2
@@ -73,6 +75,10 @@ StatusCode spi_exchange(SpiPort spi, uint8_t *tx_data, size_t tx_len, uint8_t *r
     return STATUS_CODE_INVALID_ARGS;
   }
 
+  if (s_port[spi].device != NULL) {
+    return s_port[spi].device(tx_data, tx_len, rx_data, rx_len, s_port[spi].device_context);
+  }
+
   status_ok_or_return(spi_write(spi, tx_data, tx_len));
   status_ok_or_return(spi_read(spi, rx_data, rx_len));
 
@@ -151,3 +157,14 @@ size_t spi_get_tx_num_bytes(SpiPort spi) {
 
   return s_port[spi].spi_tx_buf.queue.num_items - queue_get_spaces_available(&s_port[spi].spi_tx_buf.queue);
 }
+
+StatusCode spi_set_mock_device(SpiPort spi, SpiMockDevice device, void *context) {
+  if (spi >= NUM_SPI_PORTS) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  s_port[spi].device = device;
+  s_port[spi].device_context = context;
+
+  return STATUS_CODE_OK;
+}
@@ -8,16 +8,81 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <stdbool.h>
 #include <stddef.h>
 
 /* Inter-component Headers */
+#include "FreeRTOS.h"
+#include "task.h"
 
 /* Intra-component Headers */
 #include "status.h"
 #include "uart.h"
 
+/** @brief  Bits on the wire per byte with 8N1 framing */
+#define UART_BITS_PER_BYTE 10U
+
+/** @brief  Simulated UART port data */
+typedef struct {
+  uint32_t baudrate;      /**< Configured symbols per second */
+  uint64_t busy_until_us; /**< Time at which the last queued byte leaves the wire */
+  uint32_t tx_bytes;      /**< Bytes transmitted since initialization */
+  bool initialized;       /**< Initialized flag */
+} UartPortData;
+
+static UartPortData s_port[NUM_UART_PORTS];
+
+static uint64_t s_now_us(void) {
+  return (uint64_t)xTaskGetTickCount() * portTICK_PERIOD_MS * 1000U;
+}
+
+/* Queue len bytes behind any transmission still on the wire and return when they finish */
+static uint64_t s_queue_transmission(UartPort uart, size_t len) {
+  uint64_t line_time_us = ((uint64_t)len * UART_BITS_PER_BYTE * 1000000U) / s_port[uart].baudrate;
+  uint64_t now_us = s_now_us();
+
+  taskENTER_CRITICAL();
+  uint64_t start_us = (s_port[uart].busy_until_us > now_us) ? s_port[uart].busy_until_us : now_us;
+  s_port[uart].busy_until_us = start_us + line_time_us;
+  s_port[uart].tx_bytes += (uint32_t)len;
+  uint64_t busy_until_us = s_port[uart].busy_until_us;
+  taskEXIT_CRITICAL();
+
+  return busy_until_us;
+}
+
+/* Whole ticks until the line is idle. The sub-tick remainder is left for the next transmission to queue behind */
+static TickType_t s_ticks_until(uint64_t busy_until_us) {
+  uint64_t now_us = s_now_us();
+
+  if (busy_until_us <= now_us) {
+    return 0U;
+  }
+
+  return (TickType_t)((busy_until_us - now_us) / (portTICK_PERIOD_MS * 1000U));
+}
+
+static void s_wait_ticks(TickType_t ticks) {
+  if (ticks > 0U && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+    vTaskDelay(ticks);
+  }
+}
+
 StatusCode uart_init(UartPort uart, UartSettings *settings) {
-  return STATUS_CODE_UNIMPLEMENTED;
+  if (settings == NULL || uart >= NUM_UART_PORTS || settings->baudrate == 0U) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (s_port[uart].initialized) {
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  s_port[uart].baudrate = settings->baudrate;
+  s_port[uart].busy_until_us = 0U;
+  s_port[uart].tx_bytes = 0U;
+  s_port[uart].initialized = true;
+
+  return STATUS_CODE_OK;
 }
 
 StatusCode uart_rx(UartPort uart, uint8_t *data, size_t len) {
@@ -25,5 +90,58 @@ StatusCode uart_rx(UartPort uart, uint8_t *data, size_t len) {
 }
 
 StatusCode uart_tx(UartPort uart, uint8_t *data, size_t len) {
-  return STATUS_CODE_UNIMPLEMENTED;
+  if (data == NULL || uart >= NUM_UART_PORTS || len > UART_MAX_BUFFER_LEN) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!s_port[uart].initialized) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  s_wait_ticks(s_ticks_until(s_queue_transmission(uart, len)));
+
+  return STATUS_CODE_OK;
+}
+
+StatusCode uart_tx_async(UartPort uart, uint8_t *data, size_t len) {
+  if (data == NULL || uart >= NUM_UART_PORTS || len == 0U || len > UART_MAX_BUFFER_LEN) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!s_port[uart].initialized) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  if (s_ticks_until(s_port[uart].busy_until_us) > 0U) {
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  s_queue_transmission(uart, len);
+
+  return STATUS_CODE_OK;
+}
+
+StatusCode uart_tx_wait(UartPort uart, uint32_t timeout_ms) {
+  if (uart >= NUM_UART_PORTS) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  TickType_t ticks = s_ticks_until(s_port[uart].busy_until_us);
+
+  if (ticks > pdMS_TO_TICKS(timeout_ms)) {
+    s_wait_ticks(pdMS_TO_TICKS(timeout_ms));
+    return STATUS_CODE_TIMEOUT;
+  }
+
+  s_wait_ticks(ticks);
+
+  return STATUS_CODE_OK;
+}
+
+uint32_t uart_peek_tx_bytes(UartPort uart) {
+  if (uart >= NUM_UART_PORTS) {
+    return 0U;
+  }
+
+  return s_port[uart].tx_bytes;
 }
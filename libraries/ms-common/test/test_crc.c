@@ -0,0 +1,116 @@
+/************************************************************************************************
+ * @file   test_crc.c
+ *
+ * @brief  Test file for CRC library
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "log.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "crc.h"
+
+/* Same size as the bootloader's application region, the largest image checksummed on the host */
+#define TEST_IMAGE_SIZE (256U * 1024U)
+#define TEST_PATTERN_SIZE 1024U
+
+static uint32_t s_image[TEST_IMAGE_SIZE / sizeof(uint32_t)];
+
+/* Bit at a time reference, the same algorithm as projects/bootloader/scripts/crc32.py */
+static uint32_t s_reference_crc32(const uint8_t *data, size_t length_words) {
+  uint32_t crc = 0xFFFFFFFFU;
+
+  for (size_t i = 0U; i < length_words * sizeof(uint32_t); ++i) {
+    crc ^= (uint32_t)data[(i & ~3U) + 3U - (i & 3U)] << 24U;
+    for (uint8_t bit = 0U; bit < 8U; ++bit) {
+      crc = (crc & 0x80000000U) ? ((crc << 1U) ^ 0x04C11DB7U) : (crc << 1U);
+    }
+  }
+
+  return crc;
+}
+
+static double s_elapsed_ms(const struct timespec *start, const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1000.0 + (end->tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+void setup_test(void) {
+  uint8_t *image = (uint8_t *)s_image;
+  for (size_t i = 0U; i < TEST_IMAGE_SIZE; ++i) {
+    image[i] = (uint8_t)(i * 7U + 3U);
+  }
+
+  TEST_ASSERT_OK(crc_init(CRC_LENGTH_32));
+}
+
+void teardown_test(void) {
+  crc_reset();
+}
+
+void test_crc32_matches_crc_unit(void) {
+  /* Reference value from the STM32 CRC unit with its reset configuration */
+  uint32_t word = 0x12345678U;
+  TEST_ASSERT_EQUAL_HEX32(0xDF8A8A2BU, crc_calculate(&word, 1U));
+
+  /* crc32.py returns the complement of the CRC unit, 0xEC693F73 for this pattern */
+  TEST_ASSERT_EQUAL_HEX32(0xEC693F73U ^ 0xFFFFFFFFU, crc_calculate(s_image, TEST_PATTERN_SIZE / sizeof(uint32_t)));
+
+  /* Odd word counts end on the single word tail */
+  TEST_ASSERT_EQUAL_HEX32(s_reference_crc32((uint8_t *)s_image, 257U), crc_calculate(s_image, 257U));
+}
+
+void test_crc32_incremental(void) {
+  uint32_t expected = crc_calculate(s_image, TEST_PATTERN_SIZE / sizeof(uint32_t));
+
+  CRCContext context;
+  crc_start(&context);
+  crc_update(&context, s_image, 3U);
+  crc_update(&context, &s_image[3], 0U);
+  crc_update(&context, &s_image[3], 1U);
+  crc_update(&context, &s_image[4], TEST_PATTERN_SIZE / sizeof(uint32_t) - 4U);
+
+  TEST_ASSERT_EQUAL_HEX32(expected, crc_finalize(&context));
+}
+
+void test_crc_narrow_lengths(void) {
+  /* CRC-8 takes bytes in memory order */
+  uint32_t bytes[3] = { 0 };
+  memcpy(bytes, "123456789", 9U);
+  TEST_ASSERT_OK(crc_init(CRC_LENGTH_8));
+  TEST_ASSERT_EQUAL_HEX32(0xFBU, crc_calculate(bytes, 9U));
+
+  /* CRC-16 takes each halfword MSB first, so "12345678" is shifted in as "21436587" */
+  TEST_ASSERT_OK(crc_init(CRC_LENGTH_16));
+  TEST_ASSERT_EQUAL_HEX32(0x3D14U, crc_calculate(bytes, 4U));
+
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, crc_init(NUM_CRC_LENGTHS));
+}
+
+void test_crc32_full_image_throughput(void) {
+  struct timespec start, end;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  uint32_t crc = crc_calculate(s_image, TEST_IMAGE_SIZE / sizeof(uint32_t));
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double table_ms = s_elapsed_ms(&start, &end);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  uint32_t reference = s_reference_crc32((uint8_t *)s_image, TEST_IMAGE_SIZE / sizeof(uint32_t));
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double reference_ms = s_elapsed_ms(&start, &end);
+
+  LOG_DEBUG("CRC32 of %u KiB: %.3f ms sliced, %.3f ms bitwise\n", TEST_IMAGE_SIZE / 1024U, table_ms, reference_ms);
+
+  TEST_ASSERT_EQUAL_HEX32(reference, crc);
+}
@@ -0,0 +1,130 @@
+/************************************************************************************************
+ * @file   test_flash.c
+ *
+ * @brief  Test file for the x86 flash library
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "flash.h"
+
+/* Flash file used by the x86 flash library */
+#define TEST_FLASH_FILENAME "Midsun_x86_flash"
+
+#define TEST_PAGE FLASH_LAST_PAGE_NUM
+#define TEST_ADDRESS FLASH_PAGE_TO_ADDR(TEST_PAGE)
+#define TEST_DATA_SIZE 16U
+
+static uint8_t s_pattern[TEST_DATA_SIZE];
+
+void setup_test(void) {
+  for (size_t i = 0U; i < TEST_DATA_SIZE; i++) {
+    s_pattern[i] = (uint8_t)(0xA5U ^ i);
+  }
+
+  TEST_ASSERT_OK(flash_init());
+  flash_set_strict_mode(false);
+  TEST_ASSERT_OK(flash_erase(TEST_PAGE, 1U));
+}
+
+void teardown_test(void) {
+  flash_set_strict_mode(false);
+}
+
+void test_flash_write_without_erase_fails_in_strict_mode(void) {
+  uint8_t read_back[TEST_DATA_SIZE];
+  uint8_t set_bits[TEST_DATA_SIZE];
+  uint8_t cleared_bits[TEST_DATA_SIZE];
+
+  flash_set_strict_mode(true);
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, s_pattern, TEST_DATA_SIZE));
+
+  /* Setting a cleared bit needs an erase, so the write is rejected and the contents are unchanged */
+  memset(set_bits, 0xFF, TEST_DATA_SIZE);
+  TEST_ASSERT_EQUAL(STATUS_CODE_INTERNAL_ERROR, flash_write(TEST_ADDRESS, set_bits, TEST_DATA_SIZE));
+  TEST_ASSERT_OK(flash_read(TEST_ADDRESS, read_back, TEST_DATA_SIZE));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_pattern, read_back, TEST_DATA_SIZE);
+
+  /* Clearing further bits is allowed without an erase */
+  for (size_t i = 0U; i < TEST_DATA_SIZE; i++) {
+    cleared_bits[i] = s_pattern[i] & 0x0FU;
+  }
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, cleared_bits, TEST_DATA_SIZE));
+  TEST_ASSERT_OK(flash_read(TEST_ADDRESS, read_back, TEST_DATA_SIZE));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(cleared_bits, read_back, TEST_DATA_SIZE);
+
+  /* After an erase the original write succeeds again */
+  TEST_ASSERT_OK(flash_erase(TEST_PAGE, 1U));
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, s_pattern, TEST_DATA_SIZE));
+}
+
+void test_flash_write_ands_when_not_strict(void) {
+  uint8_t read_back[TEST_DATA_SIZE];
+  uint8_t overwrite[TEST_DATA_SIZE];
+  uint8_t expected[TEST_DATA_SIZE];
+
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, s_pattern, TEST_DATA_SIZE));
+
+  for (size_t i = 0U; i < TEST_DATA_SIZE; i++) {
+    overwrite[i] = (uint8_t)(0x3CU + i);
+    expected[i] = s_pattern[i] & overwrite[i];
+  }
+
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, overwrite, TEST_DATA_SIZE));
+  TEST_ASSERT_OK(flash_read(TEST_ADDRESS, read_back, TEST_DATA_SIZE));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, read_back, TEST_DATA_SIZE);
+}
+
+void test_flash_erase_resets_page(void) {
+  uint8_t read_back[FLASH_PAGE_SIZE];
+  uint8_t erased[FLASH_PAGE_SIZE];
+  memset(erased, 0xFF, FLASH_PAGE_SIZE);
+
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS + FLASH_PAGE_SIZE - TEST_DATA_SIZE, s_pattern, TEST_DATA_SIZE));
+  TEST_ASSERT_OK(flash_erase(TEST_PAGE, 1U));
+  TEST_ASSERT_OK(flash_read(TEST_ADDRESS, read_back, FLASH_PAGE_SIZE));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(erased, read_back, FLASH_PAGE_SIZE);
+
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, flash_erase(TEST_PAGE, 2U));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, flash_erase(TEST_PAGE, 0U));
+}
+
+void test_flash_erase_count(void) {
+  uint32_t first_count = flash_peek_erase_count(TEST_PAGE - 1U);
+  uint32_t second_count = flash_peek_erase_count(TEST_PAGE);
+  uint32_t untouched_count = flash_peek_erase_count(TEST_PAGE - 2U);
+
+  TEST_ASSERT_OK(flash_erase(TEST_PAGE - 1U, 2U));
+  TEST_ASSERT_OK(flash_erase(TEST_PAGE, 1U));
+
+  TEST_ASSERT_EQUAL_UINT32(first_count + 1U, flash_peek_erase_count(TEST_PAGE - 1U));
+  TEST_ASSERT_EQUAL_UINT32(second_count + 2U, flash_peek_erase_count(TEST_PAGE));
+  TEST_ASSERT_EQUAL_UINT32(untouched_count, flash_peek_erase_count(TEST_PAGE - 2U));
+  TEST_ASSERT_EQUAL_UINT32(0U, flash_peek_erase_count(NUM_FLASH_PAGES));
+}
+
+void test_flash_persists_to_file(void) {
+  uint8_t file_data[TEST_DATA_SIZE];
+
+  TEST_ASSERT_OK(flash_write(TEST_ADDRESS, s_pattern, TEST_DATA_SIZE));
+
+  /* The flash file is mapped shared, so the write is visible through the file straight away */
+  FILE *flash_file = fopen(TEST_FLASH_FILENAME, "rb");
+  TEST_ASSERT_NOT_NULL(flash_file);
+  TEST_ASSERT_EQUAL(0, fseek(flash_file, (long)(TEST_ADDRESS - FLASH_BASE_ADDR), SEEK_SET));
+  TEST_ASSERT_EQUAL(TEST_DATA_SIZE, fread(file_data, 1U, TEST_DATA_SIZE, flash_file));
+  fclose(flash_file);
+
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_pattern, file_data, TEST_DATA_SIZE);
+}
@@ -9,7 +9,12 @@ extern uint32_t SystemCoreClock;
 
 #define configUSE_PREEMPTION 1
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#ifdef MS_PLATFORM_X86
+/* The x86 port uses tickless idle and the idle hook to drive its virtual clock */
+#define configUSE_TICKLESS_IDLE 1
+#else
 #define configUSE_TICKLESS_IDLE 0
+#endif
 #define configCPU_CLOCK_HZ SystemCoreClock
 #define configTICK_RATE_HZ ((TickType_t)1000)
 #define configMAX_PRIORITIES 5
@@ -38,7 +43,11 @@ extern uint32_t SystemCoreClock;
 #define configSYSTEM_CALL_STACK_SIZE 128
 
 /* Hook function related definitions. */
+#ifdef MS_PLATFORM_X86
+#define configUSE_IDLE_HOOK 1
+#else
 #define configUSE_IDLE_HOOK 0
+#endif
 #define configUSE_TICK_HOOK 0
 #define configCHECK_FOR_STACK_OVERFLOW 2
 #define configUSE_MALLOC_FAILED_HOOK 1
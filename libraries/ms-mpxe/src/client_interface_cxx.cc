@@ -23,11 +23,11 @@ extern "C" {
 void *client_cpp_create(const char *ip_address, int port, void (*msg_callback)(void *, const char *, int), void (*connect_callback)(void *), void *context) {
   Client *client = NULL;
   try {
-    std::function<void(Client *, std::string &)> message_callback;
+    std::function<void(Client *, std::string_view)> message_callback;
     std::function<void(Client *)> conn_callback;
 
     if (msg_callback) {
-      message_callback = [context, msg_callback](Client *, std::string &message) { msg_callback(context, message.c_str(), static_cast<int>(message.length())); };
+      message_callback = [context, msg_callback](Client *, std::string_view message) { msg_callback(context, message.data(), static_cast<int>(message.length())); };
     } else {
       message_callback = applicationMessageCallback;
     }
@@ -19,6 +19,7 @@
 #include "gpio_manager.h"
 #include "i2c_manager.h"
 #include "spi_manager.h"
+#include "time_manager.h"
 
 /**
  * @defgroup ClientAppMain
@@ -42,5 +43,6 @@ extern AfeManager clientAfeManager;   /**< Global ADBMS1818 AFE Manager */
 extern SPIManager clientSpiManager;   /**<GLobal SPI Manager */
 extern AdcManager clientAdcManager;   /**< Global ADC Manager */
 extern I2CManager clientI2CManager;   /**< Global I2C Manager */
+extern TimeManager clientTimeManager; /**< Global virtual-time Manager */
 
 /** @} */
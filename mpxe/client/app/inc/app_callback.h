@@ -11,6 +11,7 @@
 
 /* Standard library Headers */
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 #include "client.h"
@@ -29,9 +30,9 @@
  *          This shall branch out to the GpioManager, I2CManager, SPIManager or InterruptManager
  *          based on the CommandCode
  * @param   client Pointer to the connected client instance
- * @param   message String message value that has been received
+ * @param   message Complete frame that has been received, only valid during the call
  */
-void applicationMessageCallback(Client *client, std::string &message);
+void applicationMessageCallback(Client *client, std::string_view message);
 
 /**
  * @brief   Handle connecting to the server
@@ -46,21 +46,21 @@ class I2CManager {
    * @param   payload Serialized I2C datagram payload containing port and data
    * @return  Serialized acknowledgement response
    */
-  std::string writeI2CData(std::string &payload);
+  std::string writeI2CData(std::string_view payload);
 
   /**
    * @brief   Reads data from the I2C TX buffer that firmware wrote via i2c_write()
    * @param   payload Serialized I2C datagram payload containing port and length
    * @return  Serialized response with TX buffer data
    */
-  std::string readI2CData(std::string &payload);
+  std::string readI2CData(std::string_view payload);
 
   /**
    * @brief   Clears both the I2C RX and TX buffers
    * @param   payload Serialized I2C datagram payload containing port
    * @return  Serialized acknowledgement response
    */
-  std::string clearI2CBuffers(std::string &payload);
+  std::string clearI2CBuffers(std::string_view payload);
 };
 
 /** @} */
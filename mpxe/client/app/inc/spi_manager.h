@@ -46,27 +46,27 @@ class SPIManager {
    * @param   payload Serialized SPI datagram payload containing port and data
    * @return  Serialized acknowledgement response
    */
-  std::string writeSpiData(std::string &payload);
+  std::string writeSpiData(std::string_view payload);
 
   /**
    * @brief   Reads data from the SPI TX buffer written from spi_write()
    * @param   payload Serialized SPI datagram payload containing port and data
    * @return  Serialized response with TX buffer data
    */
-  std::string processReadSpiData(std::string &payload);
+  std::string processReadSpiData(std::string_view payload);
 
   /**
    * @brief   Transmits
    * @details This function shall be called upon receiving a pin-specific payload
    * @param   payload Message data payload to be parsed
    */
-  std::string transferSpiData(std::string &payload);
+  std::string transferSpiData(std::string_view payload);
 
   /**
    * @brief   Clears both SPI RX and TX buffers
    * @param   payload Serialized SPI datagram payload containing port and data
    */
-  void clearBuffer(std::string &payload);
+  void clearBuffer(std::string_view payload);
 };
 
 /** @} */
@@ -0,0 +1,70 @@
+#pragma once
+
+/************************************************************************************************
+ * @file   time_manager.h
+ *
+ * @brief  Header file defining the Client TimeManager class
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+/* Inter-component Headers */
+#include "client.h"
+#include "time_sync_datagram.h"
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup ClientTimeManager
+ * @brief    TimeManager for the Client
+ * @{
+ */
+
+/**
+ * @class   TimeManager
+ * @brief   Class that runs the FreeRTOS virtual clock in lockstep with the server time master
+ * @details The virtual clock is held at the tick granted by the server. Each time the grant is reached
+ *          the reached tick is acknowledged, which also joins the server barrier on the first call.
+ *          This has no effect unless FreeRTOS runs in virtual time.
+ *          If the server connection is lost the virtual clock stays at the last granted tick
+ */
+class TimeManager {
+ private:
+  static std::atomic<Client *> s_client; /**< Client used to acknowledge reached ticks */
+
+  /**
+   * @brief   Acknowledge a reached tick to the server
+   * @details Called by the FreeRTOS idle task when the virtual clock reaches the granted tick
+   * @param   ticks Virtual tick count that has been reached
+   */
+  static void barrierReached(uint64_t ticks);
+
+ public:
+  /**
+   * @brief   Constructs a TimeManager object
+   * @details Default constructor
+   */
+  TimeManager() = default;
+
+  /**
+   * @brief   Hold the virtual clock at the server barrier
+   * @details This shall be called once the client is connected
+   * @param   client Pointer to the connected client instance
+   */
+  void joinLockstep(Client *client);
+
+  /**
+   * @brief   Allow the virtual clock to advance given the data payload
+   * @details This function shall be called upon receiving a TIME_GRANT payload
+   * @param   payload Message data payload to be parsed
+   */
+  void grantTime(std::string_view payload);
+};
+
+/** @} */
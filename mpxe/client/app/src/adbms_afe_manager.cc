@@ -32,7 +32,7 @@ constexpr uint8_t kBoardThermistorIndex = ADBMS_AFE_MAX_CELL_THERMISTORS_PER_DEV
 
 /* SET
 -------------------------------------------------*/
-void AfeManager::setAfeCell(std::string &payload) {
+void AfeManager::setAfeCell(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint8_t cell_index = m_afeDatagram.getIndex();
@@ -51,7 +51,7 @@ void AfeManager::setAfeCell(std::string &payload) {
   }
 }
 
-void AfeManager::setAfeTherm(std::string &payload) {
+void AfeManager::setAfeTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint8_t therm_index = m_afeDatagram.getIndex();
@@ -70,7 +70,7 @@ void AfeManager::setAfeTherm(std::string &payload) {
   }
 }
 
-void AfeManager::setAfeDevCell(std::string &payload) {
+void AfeManager::setAfeDevCell(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   std::size_t device_index = m_afeDatagram.getDevIndex();
@@ -89,7 +89,7 @@ void AfeManager::setAfeDevCell(std::string &payload) {
   }
 }
 
-void AfeManager::setAfeDevTherm(std::string &payload) {
+void AfeManager::setAfeDevTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   std::size_t device_index = m_afeDatagram.getDevIndex();
@@ -109,7 +109,7 @@ void AfeManager::setAfeDevTherm(std::string &payload) {
   }
 }
 
-void AfeManager::setAfePackCell(std::string &payload) {
+void AfeManager::setAfePackCell(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint16_t voltage = m_afeDatagram.getCache(Datagram::ADBMS_AFE::CacheIndex::CELL_PACK);
@@ -121,7 +121,7 @@ void AfeManager::setAfePackCell(std::string &payload) {
   }
 }
 
-void AfeManager::setAfePackTherm(std::string &payload) {
+void AfeManager::setAfePackTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint16_t voltage = m_afeDatagram.getCache(Datagram::ADBMS_AFE::CacheIndex::THERMISTOR_PACK);
@@ -133,7 +133,7 @@ void AfeManager::setAfePackTherm(std::string &payload) {
   }
 }
 
-void AfeManager::setAfeBoardTherm(std::string &payload) {
+void AfeManager::setAfeBoardTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   std::size_t dev_index = m_afeDatagram.getDevIndex();
@@ -151,7 +151,7 @@ void AfeManager::setAfeBoardTherm(std::string &payload) {
   }
 }
 
-void AfeManager::setCellDischarge(std::string &payload) {
+void AfeManager::setCellDischarge(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint8_t cell_index = m_afeDatagram.getIndex();
@@ -164,7 +164,7 @@ void AfeManager::setCellDischarge(std::string &payload) {
   }
 }
 
-void AfeManager::setCellPackDischarge(std::string &payload) {
+void AfeManager::setCellPackDischarge(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   bool is_discharge = static_cast<bool>(m_afeDatagram.getCache(Datagram::ADBMS_AFE::CacheIndex::DISCHARGE_PACK));
@@ -180,7 +180,7 @@ void AfeManager::setCellPackDischarge(std::string &payload) {
 
 /* PROCESS
 -------------------------------------------------------- */
-std::string AfeManager::processAfeCell(std::string &payload) {
+std::string AfeManager::processAfeCell(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint16_t cell_index = m_afeDatagram.getIndex();
@@ -198,7 +198,7 @@ std::string AfeManager::processAfeCell(std::string &payload) {
   return m_afeDatagram.serialize(CommandCode::AFE_GET_CELL);
 }
 
-std::string AfeManager::processAfeTherm(std::string &payload) {
+std::string AfeManager::processAfeTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   uint16_t therm_index = m_afeDatagram.getIndex();
@@ -217,7 +217,7 @@ std::string AfeManager::processAfeTherm(std::string &payload) {
   return m_afeDatagram.serialize(CommandCode::AFE_GET_THERMISTOR);
 }
 
-std::string AfeManager::processAfeDevCell(std::string &payload) {
+std::string AfeManager::processAfeDevCell(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   std::size_t dev_index = m_afeDatagram.getDevIndex();
@@ -238,7 +238,7 @@ std::string AfeManager::processAfeDevCell(std::string &payload) {
 
   return m_afeDatagram.serialize(CommandCode::AFE_GET_DEV_CELL);
 }
-std::string AfeManager::processAfeDevTherm(std::string &payload) {
+std::string AfeManager::processAfeDevTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
 
   std::size_t dev_index = m_afeDatagram.getDevIndex();
@@ -298,7 +298,7 @@ std::string AfeManager::processAfePackTherm() {
   return m_afeDatagram.serialize(CommandCode::AFE_GET_PACK_THERMISTOR);
 }
 
-std::string AfeManager::processAfeBoardTherm(std::string &payload) {
+std::string AfeManager::processAfeBoardTherm(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
   std::size_t dev_index = m_afeDatagram.getDevIndex();
 
@@ -316,7 +316,7 @@ std::string AfeManager::processAfeBoardTherm(std::string &payload) {
   return m_afeDatagram.serialize(CommandCode::AFE_GET_BOARD_TEMP);
 }
 
-std::string AfeManager::processCellDischarge(std::string &payload) {
+std::string AfeManager::processCellDischarge(std::string_view payload) {
   m_afeDatagram.deserialize(payload);
   uint16_t cell_index = m_afeDatagram.getIndex();
 
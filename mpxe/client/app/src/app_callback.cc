@@ -23,9 +23,9 @@ AfeManager clientAfeManager;
 AdcManager clientAdcManager;
 SPIManager clientSpiManager;
 I2CManager clientI2CManager;
+TimeManager clientTimeManager;
 
-void applicationMessageCallback(Client *client, std::string &message) {
-  std::string data = message;
+void applicationMessageCallback(Client *client, std::string_view message) {
   auto [commandCode, payload] = decodeCommand(message);
 
   switch (commandCode) {
@@ -33,6 +33,10 @@ void applicationMessageCallback(Client *client, std::string &message) {
       /* Future expansion if the server needs to send the client some metadata? */
       break;
     }
+    case CommandCode::TIME_GRANT: {
+      clientTimeManager.grantTime(payload);
+      break;
+    }
     case CommandCode::GPIO_SET_PIN_STATE: {
       clientGpioManager.setGpioPinState(payload);
       break;
@@ -211,4 +215,6 @@ void applicationConnectCallback(Client *client) {
   Datagram::Metadata projectMetadata(initialData);
 
   client->sendMessage(projectMetadata.serialize());
+
+  clientTimeManager.joinLockstep(client);
 }
@@ -23,7 +23,7 @@ extern "C" {
 #include "app.h"
 #include "gpio_manager.h"
 
-void GpioManager::setGpioPinState(std::string &payload) {
+void GpioManager::setGpioPinState(std::string_view payload) {
   m_gpioDatagram.deserialize(payload);
 
   const uint8_t *receivedData = m_gpioDatagram.getBuffer();
@@ -32,7 +32,7 @@ void GpioManager::setGpioPinState(std::string &payload) {
   gpio_set_state(&pinAddress, static_cast<GpioState>(receivedData[0U]));
 }
 
-void GpioManager::setGpioAllStates(std::string &payload) {
+void GpioManager::setGpioAllStates(std::string_view payload) {
   m_gpioDatagram.deserialize(payload);
 
   const uint8_t *receivedData = m_gpioDatagram.getBuffer();
@@ -43,7 +43,7 @@ void GpioManager::setGpioAllStates(std::string &payload) {
   }
 }
 
-std::string GpioManager::processGpioPinState(std::string &payload) {
+std::string GpioManager::processGpioPinState(std::string_view payload) {
   m_gpioDatagram.deserialize(payload);
 
   GpioAddress pinAddress = { .port = static_cast<GpioPort>(m_gpioDatagram.getGpioPort()), .pin = m_gpioDatagram.getGpioPin() };
@@ -87,7 +87,7 @@ std::string GpioManager::processGpioAllStates() {
   return m_gpioDatagram.serialize(CommandCode::GPIO_GET_ALL_STATES);
 }
 
-std::string GpioManager::processGpioPinMode(std::string &payload) {
+std::string GpioManager::processGpioPinMode(std::string_view payload) {
   m_gpioDatagram.deserialize(payload);
 
   GpioAddress pinAddress = { .port = static_cast<GpioPort>(m_gpioDatagram.getGpioPort()), .pin = m_gpioDatagram.getGpioPin() };
@@ -135,7 +135,7 @@ std::string GpioManager::processGpioAllModes() {
   return m_gpioDatagram.serialize(CommandCode::GPIO_GET_ALL_MODES);
 }
 
-std::string GpioManager::processGpioPinAltFunction(std::string &payload) {
+std::string GpioManager::processGpioPinAltFunction(std::string_view payload) {
   m_gpioDatagram.deserialize(payload);
 
   GpioAddress pinAddress = { .port = static_cast<GpioPort>(m_gpioDatagram.getGpioPort()), .pin = m_gpioDatagram.getGpioPin() };
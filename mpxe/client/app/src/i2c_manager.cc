@@ -23,7 +23,7 @@ extern "C" {
 #include "app.h"
 #include "i2c_manager.h"
 
-std::string I2CManager::writeI2CData(std::string &payload) {
+std::string I2CManager::writeI2CData(std::string_view payload) {
   m_I2CDatagram.deserialize(payload);
 
   I2CPort port = static_cast<I2CPort>(m_I2CDatagram.getI2CPort());
@@ -36,7 +36,7 @@ std::string I2CManager::writeI2CData(std::string &payload) {
   return m_I2CDatagram.serialize(CommandCode::I2C_WRITE_DATA);
 }
 
-std::string I2CManager::readI2CData(std::string &payload) {
+std::string I2CManager::readI2CData(std::string_view payload) {
   m_I2CDatagram.deserialize(payload);
 
   I2CPort port = static_cast<I2CPort>(m_I2CDatagram.getI2CPort());
@@ -53,7 +53,7 @@ std::string I2CManager::readI2CData(std::string &payload) {
   return m_I2CDatagram.serialize(CommandCode::I2C_READ_DATA);
 }
 
-std::string I2CManager::clearI2CBuffers(std::string &payload) {
+std::string I2CManager::clearI2CBuffers(std::string_view payload) {
   m_I2CDatagram.deserialize(payload);
 
   I2CPort port = static_cast<I2CPort>(m_I2CDatagram.getI2CPort());
@@ -23,7 +23,7 @@ extern "C" {
 #include "app.h"
 #include "spi_manager.h"
 
-std::string SPIManager::writeSpiData(std::string &payload) {
+std::string SPIManager::writeSpiData(std::string_view payload) {
   m_spiDatagram.deserialize(payload);
   SpiPort port = static_cast<SpiPort>(m_spiDatagram.getSPIPort());
   const u_int8_t *receivedData = m_spiDatagram.getBuffer();
@@ -36,7 +36,7 @@ std::string SPIManager::writeSpiData(std::string &payload) {
   return m_spiDatagram.serialize(CommandCode::SPI_WRITE_DATA);
 }
 
-std::string SPIManager::processReadSpiData(std::string &payload) {
+std::string SPIManager::processReadSpiData(std::string_view payload) {
   m_spiDatagram.deserialize(payload);
 
   // Get Spi Port and Data
@@ -56,7 +56,7 @@ std::string SPIManager::processReadSpiData(std::string &payload) {
   return m_spiDatagram.serialize(CommandCode::SPI_READ_DATA);
 }
 
-std::string SPIManager::transferSpiData(std::string &payload) {
+std::string SPIManager::transferSpiData(std::string_view payload) {
   m_spiDatagram.deserialize(payload);
 
   SpiPort port = static_cast<SpiPort>(m_spiDatagram.getSPIPort());
@@ -69,7 +69,7 @@ std::string SPIManager::transferSpiData(std::string &payload) {
   return m_spiDatagram.serialize(CommandCode::SPI_TRANSFER_DATA);
 }
 
-void SPIManager::clearBuffer(std::string &payload) {
+void SPIManager::clearBuffer(std::string_view payload) {
   const Datagram::SPI::Port port = m_spiDatagram.getSPIPort();
   m_spiDatagram.setSPIPort(port);
   m_spiDatagram.clearBuffer();
@@ -0,0 +1,53 @@
+/************************************************************************************************
+ * @file   time_manager.cc
+ *
+ * @brief  Source file defining the TimeManager class for the client
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <cstdint>
+#include <iostream>
+
+/* Inter-component Headers */
+extern "C" {
+#include "FreeRTOS.h"
+}
+
+#include "command_code.h"
+
+/* Intra-component Headers */
+#include "app.h"
+#include "time_manager.h"
+
+std::atomic<Client *> TimeManager::s_client{ nullptr };
+
+void TimeManager::barrierReached(uint64_t ticks) {
+  Client *client = s_client.load();
+
+  if (client == nullptr || !client->isConnected()) {
+    return;
+  }
+
+  Datagram::TimeSync::Payload ack = { .tick = ticks };
+
+  try {
+    client->sendMessage(Datagram::TimeSync(ack).serialize(CommandCode::TIME_ACK));
+  } catch (std::exception &e) {
+    std::cerr << "Failed to acknowledge virtual time: " << e.what() << std::endl;
+  }
+}
+
+void TimeManager::joinLockstep(Client *client) {
+  s_client = client;
+  vPortSetVirtualTimeBarrier(barrierReached);
+}
+
+void TimeManager::grantTime(std::string_view payload) {
+  Datagram::TimeSync grant;
+  grant.deserialize(payload);
+
+  vPortGrantVirtualTime(grant.getTick());
+}
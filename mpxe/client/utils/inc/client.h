@@ -12,18 +12,18 @@
 /* Standard library Headers */
 #include <atomic>
 #include <functional>
-#include <queue>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <pthread.h>
-#include <semaphore.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
 /* Intra-component Headers */
+#include "frame_transport.h"
 
 /**
  * @defgroup Client_Utils
@@ -40,23 +40,19 @@
 class Client {
  private:
   /** @brief  The message callback function definition */
-  using messageCallback = std::function<void(Client *client, std::string &)>;
+  using messageCallback = std::function<void(Client *client, std::string_view)>;
   /** @brief  The connection callback function definition */
   using connectCallback = std::function<void(Client *client)>;
 
-  static constexpr size_t MAX_BUFFER_SIZE = 512; /**< Maximum permitted read size for all clients */
-
-  pthread_t m_receiverThreadId;       /**< Thread Id for reading incoming server data */
-  pthread_t m_processMessageThreadId; /**< Thread Id for processing cached server data */
-  pthread_mutex_t m_mutex;            /**< Mutex to protect m_messageQueue */
-  sem_t m_messageSemaphore;           /**< Semaphore to signal the processMessageThread when new data is received */
+  pthread_t m_receiverThreadId; /**< Thread Id for reading incoming server data */
+  pthread_mutex_t m_sendMutex;  /**< Mutex to keep concurrently sent frames from interleaving */
 
   messageCallback m_messageCallback; /**< Function pointer to store the message callback */
   connectCallback m_connectCallback; /**< Function pointer to store the connection callback */
 
   std::atomic<bool> m_isConnected{ false }; /**< Boolean flag to indicate the servers status */
 
-  std::queue<std::string> m_messageQueue; /**< Queue to cache and input-buffer received server data */
+  ReceiveBuffer m_receiveBuffer; /**< Buffer to reassemble frames received from the server */
 
   int m_clientSocket;                 /**< The clients socket FD */
   std::string m_host;                 /**< The servers host address (ie: 127.0.0.1) */
@@ -81,33 +77,28 @@ class Client {
   /**
    * @brief   Destructs a Client object
    * @details If using TCP this closes the existing socket connection
-   *          This shall also delete the mutex, and terminate both running threads
+   *          This shall also delete the mutex, and terminate the running thread
    */
   ~Client();
 
   /**
-   * @brief   Thread procedure for caching/receiving incoming server data
+   * @brief   Thread procedure for receiving incoming server data
    * @details This thread shall be blocked while no new server data is available
+   *          The socket is drained until EAGAIN, and the message callback shall be called
+   *          once for every complete frame directly from the receive buffer
    */
   void receiverProcedure();
 
-  /**
-   * @brief   Thread procedure for processing cached/stored server data
-   * @details This thread shall be blocked while no new server data is available in storage
-   *          Upon receiving a message, the message callback shall be called
-   */
-  void processMessagesProcedure();
-
   /**
    * @brief   Connect to the server
    * @details This shall throw an exception if the server does not exist or is not accepting clients
-   *          Upon connection, this shall spawn the receiverProcedure and processMessages threads
+   *          Upon connection, this shall spawn the receiverProcedure thread
    */
   void connectServer();
 
   /**
    * @brief   Disconnect from the server
-   * @details If the server is connected, this shall safely terminate both receiverProcedure and processMessages threads
+   * @details If the server is connected, this shall safely terminate the receiverProcedure thread
    *          This shall close the existing socket connection
    */
   void disconnectServer();
@@ -121,6 +112,7 @@ class Client {
 
   /**
    * @brief   Function wrapper to transmit a message
+   * @details The complete frame is written even if the socket accepts it in several parts
    * @param   message String message value to be sent
    */
   void sendMessage(const std::string &message);
@@ -16,29 +16,8 @@
 /* Intra-component Headers */
 #include "client.h"
 
-void Client::processMessagesProcedure() {
-  while (m_isConnected) {
-    /* Wait for new data */
-    sem_wait(&m_messageSemaphore);
-
-    pthread_mutex_lock(&m_mutex);
-
-    if (!m_messageQueue.empty()) {
-      auto message = m_messageQueue.front();
-      m_messageQueue.pop();
-      if (m_messageCallback) {
-        m_messageCallback(this, message);
-      }
-    }
-
-    pthread_mutex_unlock(&m_mutex);
-  }
-}
-
 void Client::receiverProcedure() {
   while (m_isConnected) {
-    std::string message(MAX_BUFFER_SIZE, '\0');
-
     fd_set readSet;
     FD_ZERO(&readSet);
     FD_SET(m_clientSocket, &readSet);
@@ -57,37 +36,27 @@ void Client::receiverProcedure() {
       disconnectServer();
       throw std::runtime_error("Select error: " + std::string(strerror(errno)));
     } else if (selectResult > 0 && FD_ISSET(m_clientSocket, &readSet)) {
-      size_t bytesRead = read(m_clientSocket, &message[0], message.length());
-
-      if (bytesRead <= 0) {
+      ReceiveBuffer::Status status = m_receiveBuffer.drainSocket(m_clientSocket, [this](std::string_view frame) {
+        if (!m_messageCallback) {
+          return;
+        }
+
+        try {
+          m_messageCallback(this, frame);
+        } catch (std::exception &e) {
+          /* A single bad message shall not take down the connection */
+          std::cerr << "Failed to handle server message: " << e.what() << std::endl;
+        }
+      });
+
+      if (status == ReceiveBuffer::Status::CLOSED) {
         disconnectServer();
         throw std::runtime_error("Connection lost");
       }
-
-      message[bytesRead] = '\0';
-
-      pthread_mutex_lock(&m_mutex);
-      m_messageQueue.push(message);
-      pthread_mutex_unlock(&m_mutex);
-
-      /* Signal that there is new data */
-      sem_post(&m_messageSemaphore);
     }
   }
 }
 
-void *processMessagesProcedureWrapper(void *param) {
-  Client *client = static_cast<Client *>(param);
-
-  try {
-    client->processMessagesProcedure();
-  } catch (std::exception &e) {
-    std::cerr << "Process Messages Thread Error " << e.what() << std::endl;
-  }
-
-  return nullptr;
-}
-
 void *receiverProcedureWrapper(void *param) {
   Client *client = static_cast<Client *>(param);
 
@@ -119,6 +88,11 @@ void Client::connectServer() {
       throw std::runtime_error("Error connecting socket");
     }
 
+    /* Set as non blocking so the receiver can drain the socket until EAGAIN */
+    int flags = fcntl(m_clientSocket, F_GETFL, 0);
+    fcntl(m_clientSocket, F_SETFL, flags | O_NONBLOCK);
+
+    m_receiveBuffer.clear();
     m_isConnected = true;
 
     if (m_connectCallback) {
@@ -129,11 +103,6 @@ void Client::connectServer() {
       close(m_clientSocket);
       throw std::runtime_error("Failed to create receiver thread");
     }
-
-    if (pthread_create(&m_processMessageThreadId, NULL, processMessagesProcedureWrapper, this)) {
-      close(m_clientSocket);
-      throw std::runtime_error("Failed to create process messages thread");
-    }
   } catch (std::exception &e) {
     std::cerr << "Error connecting to the server: " << e.what() << std::endl;
   }
@@ -146,8 +115,14 @@ void Client::disconnectServer() {
 }
 
 void Client::sendMessage(const std::string &message) {
-  int n = send(m_clientSocket, message.c_str(), message.size(), 0);
-  if (n < 0) throw std::runtime_error("Error sending message");
+  pthread_mutex_lock(&m_sendMutex);
+  try {
+    transmitFrame(m_clientSocket, message);
+  } catch (std::exception &e) {
+    pthread_mutex_unlock(&m_sendMutex);
+    throw std::runtime_error("Error sending message");
+  }
+  pthread_mutex_unlock(&m_sendMutex);
 }
 
 bool Client::isConnected() const {
@@ -169,17 +144,12 @@ Client::Client(const std::string &host, int port, messageCallback messageCallbac
   this->m_messageCallback = messageCallback;
   this->m_connectCallback = connectCallback;
 
-  if (pthread_mutex_init(&m_mutex, NULL) != 0) {
+  if (pthread_mutex_init(&m_sendMutex, NULL) != 0) {
     throw std::runtime_error("Error initializing mutex");
   }
-
-  if (sem_init(&m_messageSemaphore, 0, 0) != 0) {
-    throw std::runtime_error("Error initializing semaphore");
-  }
 }
 
 Client::~Client() {
   disconnectServer();
-  pthread_mutex_destroy(&m_mutex);
-  sem_destroy(&m_messageSemaphore);
+  pthread_mutex_destroy(&m_sendMutex);
 }
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Intra-component Headers */
 #include "command_code.h"
@@ -62,7 +63,7 @@ class Acs37800 {
    * @brief Deserializes ltc acs37800 data from payload string
    * @param acs37800DatagramPayload String containing serialized Ltc Acs37800 data
    */
-  void deserialize(std::string &acs37800DatagramPayload);
+  void deserialize(std::string_view acs37800DatagramPayload);
 
   /**
    * @brief   Sets voltage
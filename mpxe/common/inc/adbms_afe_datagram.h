@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Intra-component Headers */
 #include "command_code.h"
@@ -98,7 +99,7 @@ class ADBMS_AFE {
    * @brief Deserializes ltc afe data from payload string
    * @param afeDatagramPayload String containing serialized Ltc Afe data
    */
-  void deserialize(std::string &afeDatagramPayload);
+  void deserialize(std::string_view afeDatagramPayload);
 
   /**
    * @brief Sets index of cell to set
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -81,7 +82,7 @@ class Adc {
    * @brief   Deserializes Adc data from payload string
    * @param   gpioDatagramPayload String containing serialized Gpio data
    */
-  void deserialize(std::string &AdcDatagramPayload);
+  void deserialize(std::string_view AdcDatagramPayload);
 
   /**
    * @brief   Sets the target Gpio port for Adc
@@ -10,7 +10,10 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -27,7 +30,9 @@
  */
 enum class CommandCode {
   /* MISC Commands */
-  METADATA, /**< Retrieve Client Metadata Command */
+  METADATA,   /**< Retrieve Client Metadata Command */
+  TIME_GRANT, /**< Grant a lockstep client virtual time up to a tick */
+  TIME_ACK,   /**< Report that a lockstep client reached its granted tick */
 
   /* GPIO Commands */
   GPIO_SET_PIN_STATE,         /**< Set a Gpio Pin state */
@@ -84,19 +89,63 @@ enum class CommandCode {
   NUM_COMMAND_CODES /**< Number of command codes */
 };
 
+/**
+ * @brief   Command frame header
+ * @details Every command payload is prefixed with this header, which is stored little-endian:
+ *          | 16-bit magic | 8-bit version | 8-bit command code | 16-bit flags | 16-bit reserved |
+ *          | 32-bit payload length | 32-bit sequence number |
+ */
+struct CommandHeader {
+  uint16_t magic;         /**< Frame start marker, always COMMAND_HEADER_MAGIC */
+  uint8_t version;        /**< Protocol version, always COMMAND_PROTOCOL_VERSION */
+  uint8_t commandCode;    /**< Encoded CommandCode */
+  uint16_t flags;         /**< Frame flags, reserved for future extensions */
+  uint16_t reserved;      /**< Padding to keep the following fields aligned */
+  uint32_t payloadLength; /**< Number of payload bytes following the header */
+  uint32_t sequence;      /**< Per-process sequence number of the sender */
+};
+
+constexpr uint16_t COMMAND_HEADER_MAGIC = 0x584DU;                                  /**< Frame start marker, "MX" on the wire */
+constexpr uint8_t COMMAND_PROTOCOL_VERSION = 2U;                                    /**< Current protocol version */
+constexpr size_t COMMAND_HEADER_SIZE = sizeof(CommandHeader);                       /**< Size of the frame header that precedes every command payload */
+constexpr size_t COMMAND_HEADER_PREFIX_SIZE = offsetof(CommandHeader, commandCode); /**< Bytes needed to check the magic and version */
+constexpr size_t MAX_COMMAND_PAYLOAD_SIZE = 64U * 1024U;                            /**< Maximum permitted payload length of a single frame */
+
+static_assert(sizeof(CommandHeader) == 16U, "CommandHeader must not contain implicit padding");
+
 /**
  * @brief   Encode a command code into an existing data payload
+ * @details The payload is prefixed with the frame header so the receiver can split the stream
  * @param   commandCode Command code to be encoded
  * @param   message String data payload to be modified
+ * @param   flags Frame flags to be encoded
  * @return  Encoded message
  */
-std::string encodeCommand(const CommandCode commandCode, std::string &message);
+std::string encodeCommand(const CommandCode commandCode, std::string &message, uint16_t flags = 0U);
+
+/**
+ * @brief   Decode the frame header from existing data
+ * @details This shall throw an exception if the frame is malformed or uses another protocol version
+ * @param   message Complete frame to be decoded
+ * @return  Decoded frame header
+ */
+CommandHeader decodeCommandHeader(std::string_view message);
 
 /**
  * @brief   Decode a command code from existing data
- * @param   message String data payload to be decoded
+ * @details The payload is not copied, it references the memory of the message
+ * @param   message Complete frame to be decoded
  * @return  Pair containing <CommandCode, Data payload without the command Code>
  */
-std::pair<CommandCode, std::string> decodeCommand(std::string &message);
+std::pair<CommandCode, std::string_view> decodeCommand(std::string_view message);
+
+/**
+ * @brief   Determine the total length of the frame at the start of a buffer
+ * @details This shall throw an exception if the frame header is malformed or uses another protocol version
+ * @param   data Pointer to the start of the frame
+ * @param   length Number of bytes available at data
+ * @return  Total frame length including the header, or 0 if the header is incomplete
+ */
+size_t peekFrameLength(const char *data, size_t length);
 
 /** @} */
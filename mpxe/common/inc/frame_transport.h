@@ -0,0 +1,101 @@
+#pragma once
+
+/************************************************************************************************
+ * @file   frame_transport.h
+ *
+ * @brief  Header file defining the ReceiveBuffer class and framed socket helpers
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+
+/**
+ * @defgroup FrameTransport
+ * @brief    Length-prefixed framing over stream sockets
+ * @{
+ */
+
+/**
+ * @class   ReceiveBuffer
+ * @brief   Per-connection receive buffer that reassembles frames from a stream socket
+ * @details Socket data is read directly into the buffer until the socket reports EAGAIN.
+ *          Every complete frame is dispatched in place as a std::string_view, so no copy is made
+ *          on the receive path. Only the trailing partial frame is moved back to the start of the
+ *          buffer when the write position reaches the end, which keeps frames contiguous.
+ *          Frame views are only valid for the duration of the callback
+ */
+class ReceiveBuffer {
+ public:
+  /** @brief  The frame callback function definition */
+  using frameCallback = std::function<void(std::string_view)>;
+
+  static constexpr size_t DEFAULT_CAPACITY = 16U * 1024U; /**< Default receive buffer capacity in bytes */
+
+  /**
+   * @brief   Result of draining a socket
+   */
+  enum class Status {
+    DRAINED, /**< All available data was read, the socket returned EAGAIN */
+    CLOSED,  /**< The peer closed the connection */
+  };
+
+  /**
+   * @brief   Constructs a ReceiveBuffer object
+   * @param   capacity Initial buffer capacity. The buffer grows if a single frame exceeds it
+   */
+  explicit ReceiveBuffer(size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @brief   Read a non-blocking socket until EAGAIN and dispatch all complete frames
+   * @details This shall throw an exception if the read fails or a frame header is malformed
+   * @param   fd Non-blocking socket FD to be drained
+   * @param   callback Function called once for every complete frame
+   * @return  DRAINED if the socket has no more data, CLOSED if the peer disconnected
+   */
+  Status drainSocket(int fd, const frameCallback &callback);
+
+  /**
+   * @brief   Discard all buffered data
+   */
+  void clear();
+
+ private:
+  std::vector<char> m_buffer; /**< Backing storage for received data */
+  size_t m_readIndex;         /**< Offset of the first byte that has not been dispatched */
+  size_t m_writeIndex;        /**< Offset one past the last received byte */
+
+  /**
+   * @brief   Dispatch every complete frame between the read and write index
+   * @param   callback Function called once for every complete frame
+   */
+  void dispatchFrames(const frameCallback &callback);
+
+  /**
+   * @brief   Make space at the end of the buffer for the next read
+   * @details Moves the pending partial frame to the start of the buffer, or grows the buffer
+   *          if the pending frame is larger than the current capacity
+   */
+  void reclaimSpace();
+};
+
+/**
+ * @brief   Write a complete frame to a socket
+ * @details Handles partial writes and waits for the socket to become writable if it is
+ *          non-blocking and the kernel send buffer is full.
+ *          This shall throw an exception if the write fails
+ * @param   fd Socket FD to be written to
+ * @param   frame Encoded frame to be sent
+ */
+void transmitFrame(int fd, std::string_view frame);
+
+/** @} */
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -144,7 +145,7 @@ class Gpio {
    * @brief   Deserializes Gpio data from payload string
    * @param   gpioDatagramPayload String containing serialized Gpio data
    */
-  void deserialize(std::string &gpioDatagramPayload);
+  void deserialize(std::string_view gpioDatagramPayload);
 
   /**
    * @brief   Sets the target Gpio port
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -77,7 +78,7 @@ class I2C {
    * @brief   Deserializes I2C data from payload string
    * @param   i2cDatagramPayload String containing serialized I2C data
    */
-  void deserialize(std::string &i2cDatagramPayload);
+  void deserialize(std::string_view i2cDatagramPayload);
 
   /**
    * @brief   Sets the target I2C port
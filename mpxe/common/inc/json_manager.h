@@ -10,13 +10,17 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 /* Inter-component Headers */
+#include <pthread.h>
+
 #include <nlohmann/json.hpp>
 
 /* Intra-component Headers */
@@ -32,20 +36,41 @@
 /**
  * @class   JSONManager
  * @brief   Class for managing JSON Files
- * @details This class supports creating new JSON files, writing/reading to and from JSON files
- *          Default JSON generation and saving/loading data from provided paths
+ * @details This class keeps an in-memory JSON document for every project, which all readers and
+ *          writers access under a mutex. A background thread snapshots the documents that changed
+ *          since the last flush to disk at a configurable rate. Each file is written to a temporary
+ *          file and renamed over the original, so readers never observe a partially written file
  */
 class JSONManager {
  private:
   static constexpr const char *DEFAULT_JSON_PATH = "./mpxe/Simulation_JSON/"; /**< Default JSON folder path */
-  std::filesystem::path m_projectBasePath;                                    /**<  Temporary variable to store project file path */
+  static constexpr unsigned int DEFAULT_FLUSH_PERIOD_MS = 250U;               /**< Default period between disk flushes */
+
+  /**
+   * @brief   In-memory state of a single project
+   */
+  struct ProjectState {
+    nlohmann::json data;    /**< Project JSON document */
+    bool dirty;             /**< Document has changed since the last successful flush */
+    unsigned long revision; /**< Incremented on every change, so a flush only clears dirty if nothing changed during the write */
+  };
+
+  std::filesystem::path m_projectBasePath;                      /**< Temporary variable to store project file path */
+  std::unordered_map<std::string, ProjectState> m_projectStates; /**< In-memory project documents keyed by project name */
+  pthread_mutex_t m_mutex;                                       /**< Mutex to protect m_projectStates */
+  pthread_mutex_t m_fileMutex;                                   /**< Mutex to serialize flushes and deletes of project files */
+  pthread_t m_flushThreadId;                                     /**< Thread Id for flushing dirty projects to disk */
+  std::atomic<bool> m_isFlushing;                                /**< Boolean flag to indicate the flush thread status */
+  std::atomic<unsigned int> m_flushPeriodMs;                     /**< Period between disk flushes in milliseconds */
 
   /**
    * @brief   Creates a default project JSON
-   * @details The project shall be created within the DEFAULT_JSON_PATH folder
+   * @details The project document is created in memory and flushed to the DEFAULT_JSON_PATH folder
+   *          The caller must hold m_mutex
    * @param   projectName Name of the project being created
+   * @return  Reference to the new project state
    */
-  void createDefaultProjectJSON(const std::string &projectName);
+  ProjectState &createDefaultProjectJSON(const std::string &projectName);
 
   /**
    * @brief   Get the file path of a specified project
@@ -55,18 +80,23 @@ class JSONManager {
   std::filesystem::path getProjectFilePath(const std::string &projectName);
 
   /**
-   * @brief   Loads the JSON of a specified project
+   * @brief   Gets the in-memory JSON of a specified project
+   * @details The project is created if it does not exist yet. The caller must hold m_mutex
    * @param   projectName Name of the project being retrieved
-   * @return  JSON object of the selected project
+   * @return  Reference to the state of the selected project
    */
-  nlohmann::json loadProjectJSON(const std::string &projectName);
+  ProjectState &loadProjectJSON(const std::string &projectName);
 
   /**
-   * @brief   Saves JSON data to a specified project
+   * @brief   Atomically writes JSON data to a specified project file
+   * @details The data is written to a temporary file which is then renamed over the project file
+   *          The caller must hold m_fileMutex
    * @param   projectName Name of the project being written to
    * @param   projectData JSON object of the data to be written
+   * @return  TRUE if the project file was replaced
+   *          FALSE if the write or rename failed
    */
-  void saveProjectJSON(const std::string &projectName, const nlohmann::json &projectData);
+  bool saveProjectJSON(const std::string &projectName, const nlohmann::json &projectData);
 
  public:
   /**
@@ -76,6 +106,30 @@ class JSONManager {
    */
   JSONManager();
 
+  /**
+   * @brief   Destructs a JSONManager object
+   * @details This shall stop the flush thread and write all remaining changes to disk
+   */
+  ~JSONManager();
+
+  /**
+   * @brief   Thread procedure for flushing changed projects to disk
+   * @details This thread shall write every dirty project once per flush period
+   */
+  void flushProcedure();
+
+  /**
+   * @brief   Write all changed projects to disk immediately
+   * @details Projects whose write fails stay dirty and are retried by the next flush
+   */
+  void flush();
+
+  /**
+   * @brief   Set the period between disk flushes
+   * @param   periodMs Flush period in milliseconds
+   */
+  void setFlushPeriod(unsigned int periodMs);
+
   /**
    * @brief   Validate if a project JSON exists
    * @param   projectName Name of the project to validate
@@ -92,8 +146,8 @@ class JSONManager {
 
   /**
    * @brief   Sets a value for a given key in the project JSON
-   * @details This function loads the project's JSON, updates the value for the given key,
-   *          and then saves the updated JSON back to the project file
+   * @details This function updates the value for the given key in the project's in-memory JSON
+   *          The change is written to the project file by the next flush
    * @tparam  T The type of the value to be set
    * @param   projectName Name of the project whose JSON will be updated
    * @param   key The key in the JSON to update
@@ -101,21 +155,23 @@ class JSONManager {
    */
   template <typename T>
   void setProjectValue(const std::string &projectName, const std::string &key, T value) {
+    pthread_mutex_lock(&m_mutex);
     try {
-      nlohmann::json projectJSON = loadProjectJSON(projectName);
+      ProjectState &projectState = loadProjectJSON(projectName);
 
-      projectJSON[key] = value;
-
-      saveProjectJSON(projectName, projectJSON);
+      projectState.data[key] = value;
+      projectState.dirty = true;
+      projectState.revision++;
     } catch (const std::exception &e) {
       std::cerr << "Error setting project value: " << e.what() << std::endl;
     }
+    pthread_mutex_unlock(&m_mutex);
   }
 
   /**
    * @brief   Sets a nested value for a given key in the project JSON
-   * @details This function loads the project's JSON, updates the value for the given key,
-   *          and then saves the updated JSON back to the project file
+   * @details This function updates the value for the given key in the project's in-memory JSON
+   *          The change is written to the project file by the next flush
    * @tparam  T The type of the value to be set
    * @param   projectName Name of the project whose JSON will be updated
    * @param   keyPath The key path in the JSON to update in the format: { 'key1', 'key2', 'key3' }
@@ -123,10 +179,11 @@ class JSONManager {
    */
   template <typename T>
   void setProjectNestedValue(const std::string &projectName, const std::vector<std::string> &keyPath, const T &value) {
+    pthread_mutex_lock(&m_mutex);
     try {
-      nlohmann::json projectJSON = loadProjectJSON(projectName);
+      ProjectState &projectState = loadProjectJSON(projectName);
 
-      nlohmann::json *current = &projectJSON;
+      nlohmann::json *current = &projectState.data;
 
       /* Navigate to the desired key location */
       for (size_t i = 0; i < keyPath.size() - 1; ++i) {
@@ -138,16 +195,17 @@ class JSONManager {
       }
 
       (*current)[keyPath.back()] = value;
-
-      saveProjectJSON(projectName, projectJSON);
+      projectState.dirty = true;
+      projectState.revision++;
     } catch (const std::exception &e) {
       std::cerr << "Error setting nested project value: " << e.what() << std::endl;
     }
+    pthread_mutex_unlock(&m_mutex);
   }
 
   /**
    * @brief   Gets a value for a given key in the project JSON
-   * @details This function loads the project's JSON, and then retrieves the value for the given key
+   * @details This function retrieves the value for the given key from the project's in-memory JSON
    * @tparam  T The type of the value to be fetched
    * @param   projectName Name of the project whose JSON will be checked
    * @param   key The key in the JSON to check
@@ -155,21 +213,25 @@ class JSONManager {
    */
   template <typename T>
   T getProjectValue(const std::string &projectName, const std::string &key) {
+    pthread_mutex_lock(&m_mutex);
     try {
-      nlohmann::json projectJSON = loadProjectJSON(projectName);
+      ProjectState &projectState = loadProjectJSON(projectName);
 
-      if (projectJSON.contains(key)) {
-        return projectJSON[key].get<T>();
+      if (projectState.data.contains(key)) {
+        T value = projectState.data[key].template get<T>();
+        pthread_mutex_unlock(&m_mutex);
+        return value;
       }
     } catch (const std::exception &e) {
       std::cerr << "Error getting project value: " << e.what() << std::endl;
     }
+    pthread_mutex_unlock(&m_mutex);
     return static_cast<T>(0U);
   }
 
   /**
    * @brief   Gets a nested value for a given key in the project JSON
-   * @details This function loads the project's JSON, and then retrieves the value for the given key
+   * @details This function retrieves the value for the given key from the project's in-memory JSON
    * @tparam  T The type of the value to be fetched
    * @param   projectName Name of the project whose JSON will be checked
    * @param   keyPath The key path in the JSON to check in the format: { 'key1', 'key2', 'key3' }
@@ -177,22 +239,26 @@ class JSONManager {
    */
   template <typename T = nlohmann::json>
   T getProjectNestedValue(const std::string &projectName, const std::vector<std::string> &keyPath, const T &defaultValue = T()) {
+    pthread_mutex_lock(&m_mutex);
     try {
-      nlohmann::json projectJSON = loadProjectJSON(projectName);
+      const nlohmann::json *current = &loadProjectJSON(projectName).data;
 
-      const nlohmann::json *current = &projectJSON;
       /* Navigate to the desired key location */
       for (const auto &key : keyPath) {
         if (!current->contains(key)) {
+          pthread_mutex_unlock(&m_mutex);
           return defaultValue;
         }
         /* Update the JSON pointer to the nested JSON */
         current = &((*current)[key]);
       }
 
-      return current->get<T>();
+      T value = current->template get<T>();
+      pthread_mutex_unlock(&m_mutex);
+      return value;
     } catch (const std::exception &e) {
       std::cerr << "Error getting nested project value: " << e.what() << std::endl;
+      pthread_mutex_unlock(&m_mutex);
       return defaultValue;
     }
   }
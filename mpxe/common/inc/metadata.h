@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -63,7 +64,7 @@ class Metadata {
    * @brief   Deserializes Metadata data from payload string
    * @param   metadataPayload String containing serialized Metadata data
    */
-  void deserialize(std::string &metadataPayload);
+  void deserialize(std::string_view metadataPayload);
 
   /**
    * @brief   Sets the target project name
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstring>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -54,7 +55,7 @@ void serializeString(std::string &target, const std::string &str);
  * @return  Deserialized integer value
  */
 template <typename T>
-T deserializeInteger(const std::string &source, size_t &offset) {
+T deserializeInteger(std::string_view source, size_t &offset) {
   T value;
   std::memcpy(&value, source.data() + offset, sizeof(T));
   offset += sizeof(T);
@@ -69,6 +70,6 @@ T deserializeInteger(const std::string &source, size_t &offset) {
  * @param   offset Byte offset from the start of the message payload
  * @return  Deserialized string value
  */
-std::string deserializeString(std::string &source, size_t &offset);
+std::string deserializeString(std::string_view source, size_t &offset);
 
 /** @} */
@@ -12,6 +12,7 @@
 /* Standard library Headers */
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 
@@ -77,7 +78,7 @@ class SPI {
    * @brief   Deserializes SPI data from payload string
    * @param   spiDatagramPayload String containing serialized SPI data
    */
-  void deserialize(std::string &spiDatagramPayload);
+  void deserialize(std::string_view spiDatagramPayload);
 
   /**
    * @brief   Sets the target SPI port
@@ -0,0 +1,87 @@
+#pragma once
+
+/************************************************************************************************
+ * @file   time_sync_datagram.h
+ *
+ * @brief  Header file defining the TimeSyncDatagram class
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "command_code.h"
+
+/**
+ * @defgroup TimeSyncDatagram
+ * @brief    Shared lockstep virtual-time Datagram class
+ * @{
+ */
+
+namespace Datagram {
+
+/**
+ * @class   TimeSync
+ * @brief   Class for exchanging virtual-time quanta between the server and lockstep clients
+ * @details The server sends TIME_GRANT with the tick that clients may advance up to
+ *          Clients send TIME_ACK with the tick they have reached once they stop at the grant
+ */
+class TimeSync {
+ public:
+  /**
+   * @brief   TimeSync Datagram payload storage
+   */
+  struct Payload {
+    uint64_t tick; /**< Granted tick for TIME_GRANT, reached tick for TIME_ACK */
+  };
+
+  /**
+   * @brief   Constructs a TimeSync object with provided payload data
+   * @param   data Reference to payload data
+   */
+  explicit TimeSync(Payload &data);
+
+  /**
+   * @brief   Default constructor for TimeSync object
+   */
+  TimeSync() = default;
+
+  /**
+   * @brief   Serializes TimeSync data with command code for transmission
+   * @param   commandCode Command code to include in serialized data
+   * @return  Serialized string containing TimeSync data
+   */
+  std::string serialize(const CommandCode &commandCode) const;
+
+  /**
+   * @brief   Deserializes TimeSync data from payload string
+   * @param   timeSyncDatagramPayload String containing serialized TimeSync data
+   */
+  void deserialize(std::string_view timeSyncDatagramPayload);
+
+  /**
+   * @brief   Sets the tick
+   * @param   tick Granted or reached tick
+   */
+  void setTick(uint64_t tick);
+
+  /**
+   * @brief   Gets the tick
+   * @return  Granted or reached tick
+   */
+  uint64_t getTick() const;
+
+ private:
+  Payload m_timeSyncDatagram; /**< Private datagram payload */
+};
+
+}  // namespace Datagram
+
+/** @} */
@@ -46,7 +46,7 @@ std::string Acs37800::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void Acs37800::deserialize(std::string &acs37800DatagramPayload) {
+void Acs37800::deserialize(std::string_view acs37800DatagramPayload) {
   std::size_t offset = 0;
 
   std::memcpy(&m_acs37800Datagram.voltage_mV, acs37800DatagramPayload.data() + offset, sizeof(float));
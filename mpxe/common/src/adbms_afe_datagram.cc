@@ -48,7 +48,7 @@ std::string ADBMS_AFE::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void ADBMS_AFE::deserialize(std::string &afeDatagramPayload) {
+void ADBMS_AFE::deserialize(std::string_view afeDatagramPayload) {
   std::size_t offset = 0;
 
   m_afeDatagram.index = deserializeInteger<uint8_t>(afeDatagramPayload, offset);
@@ -40,7 +40,7 @@ std::string Adc::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void Adc::deserialize(std::string &AdcDatagramPayload) {
+void Adc::deserialize(std::string_view AdcDatagramPayload) {
   if (AdcDatagramPayload.size() < 3U) {
     throw std::runtime_error("Invalid ADC datagram payload");
   }
@@ -8,7 +8,9 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 /* Inter-component Headers */
@@ -16,26 +18,84 @@
 /* Intra-component Headers */
 #include "command_code.h"
 
-std::string encodeCommand(const CommandCode commandCode, std::string &message) {
-  return std::to_string(static_cast<uint8_t>(commandCode)) + '|' + message;
+/** @brief  Sequence number of the next encoded frame */
+static std::atomic<uint32_t> s_sequenceNumber{ 0U };
+
+/**
+ * @brief   Check if a buffer starts with a valid frame header
+ * @details Only the magic and version are checked, the buffer must hold at least COMMAND_HEADER_PREFIX_SIZE bytes
+ */
+static bool isValidHeader(const char *data) {
+  uint16_t magic;
+  std::memcpy(&magic, data, sizeof(magic));
+  return magic == COMMAND_HEADER_MAGIC && static_cast<uint8_t>(data[sizeof(magic)]) == COMMAND_PROTOCOL_VERSION;
+}
+
+std::string encodeCommand(const CommandCode commandCode, std::string &message, uint16_t flags) {
+  if (message.length() > MAX_COMMAND_PAYLOAD_SIZE) {
+    throw std::runtime_error("Command payload exceeds maximum frame size");
+  }
+
+  CommandHeader header = {};
+  header.magic = COMMAND_HEADER_MAGIC;
+  header.version = COMMAND_PROTOCOL_VERSION;
+  header.commandCode = static_cast<uint8_t>(commandCode);
+  header.flags = flags;
+  header.payloadLength = static_cast<uint32_t>(message.length());
+  header.sequence = s_sequenceNumber.fetch_add(1U, std::memory_order_relaxed);
+
+  std::string frame;
+  frame.reserve(COMMAND_HEADER_SIZE + message.length());
+  frame.append(reinterpret_cast<const char *>(&header), COMMAND_HEADER_SIZE);
+  frame.append(message);
+
+  return frame;
 }
 
-std::pair<CommandCode, std::string> decodeCommand(std::string &message) {
-  size_t delimPosition = message.find('|');
+CommandHeader decodeCommandHeader(std::string_view message) {
+  size_t frameLength = peekFrameLength(message.data(), message.length());
 
-  if (delimPosition == std::string::npos) {
+  if (frameLength == 0U || frameLength != message.length()) {
     throw std::runtime_error("Invalid command format");
   }
 
-  uint8_t commandCodeValue = std::stoi(message.substr(0, delimPosition));
+  CommandHeader header = {};
+  std::memcpy(&header, message.data(), COMMAND_HEADER_SIZE);
 
-  if (commandCodeValue > static_cast<uint8_t>(CommandCode::NUM_COMMAND_CODES)) {
+  if (header.commandCode >= static_cast<uint8_t>(CommandCode::NUM_COMMAND_CODES)) {
     throw std::runtime_error("CommandCode out of valid range");
   }
 
-  CommandCode commandCode = static_cast<CommandCode>(commandCodeValue);
+  return header;
+}
+
+std::pair<CommandCode, std::string_view> decodeCommand(std::string_view message) {
+  CommandHeader header = decodeCommandHeader(message);
+
+  CommandCode commandCode = static_cast<CommandCode>(header.commandCode);
+
+  return { commandCode, message.substr(message.length() - header.payloadLength) };
+}
+
+size_t peekFrameLength(const char *data, size_t length) {
+  if (length < COMMAND_HEADER_PREFIX_SIZE) {
+    return 0U;
+  }
+
+  if (!isValidHeader(data)) {
+    throw std::runtime_error("Invalid frame header");
+  }
+
+  if (length < COMMAND_HEADER_SIZE) {
+    return 0U;
+  }
 
-  std::string payload = message.substr(delimPosition + 1);
+  uint32_t payloadLength;
+  std::memcpy(&payloadLength, data + offsetof(CommandHeader, payloadLength), sizeof(uint32_t));
+
+  if (payloadLength > MAX_COMMAND_PAYLOAD_SIZE) {
+    throw std::runtime_error("Frame payload length exceeds maximum frame size");
+  }
 
-  return { commandCode, payload };
+  return COMMAND_HEADER_SIZE + payloadLength;
 }
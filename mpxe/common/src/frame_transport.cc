@@ -0,0 +1,119 @@
+/************************************************************************************************
+ * @file   frame_transport.cc
+ *
+ * @brief  Source file defining the ReceiveBuffer class and framed socket helpers
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/* Inter-component Headers */
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* Intra-component Headers */
+#include "command_code.h"
+#include "frame_transport.h"
+
+ReceiveBuffer::ReceiveBuffer(size_t capacity) : m_buffer(capacity < COMMAND_HEADER_SIZE ? COMMAND_HEADER_SIZE : capacity), m_readIndex(0U), m_writeIndex(0U) {}
+
+ReceiveBuffer::Status ReceiveBuffer::drainSocket(int fd, const frameCallback &callback) {
+  while (true) {
+    if (m_writeIndex == m_buffer.size()) {
+      reclaimSpace();
+    }
+
+    ssize_t bytesRead = read(fd, m_buffer.data() + m_writeIndex, m_buffer.size() - m_writeIndex);
+
+    if (bytesRead > 0) {
+      m_writeIndex += static_cast<size_t>(bytesRead);
+      dispatchFrames(callback);
+      continue;
+    }
+
+    if (bytesRead == 0) {
+      return Status::CLOSED;
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return Status::DRAINED;
+    }
+
+    throw std::runtime_error("Socket read failed: " + std::string(strerror(errno)));
+  }
+}
+
+void ReceiveBuffer::clear() {
+  m_readIndex = 0U;
+  m_writeIndex = 0U;
+}
+
+void ReceiveBuffer::dispatchFrames(const frameCallback &callback) {
+  while (m_writeIndex > m_readIndex) {
+    size_t available = m_writeIndex - m_readIndex;
+    size_t frameLength = peekFrameLength(m_buffer.data() + m_readIndex, available);
+
+    if (frameLength == 0U || frameLength > available) {
+      break;
+    }
+
+    callback(std::string_view(m_buffer.data() + m_readIndex, frameLength));
+    m_readIndex += frameLength;
+  }
+
+  /* Rewind while empty so the next frame starts at the front without a copy */
+  if (m_readIndex == m_writeIndex) {
+    clear();
+  }
+}
+
+void ReceiveBuffer::reclaimSpace() {
+  size_t pending = m_writeIndex - m_readIndex;
+
+  if (m_readIndex > 0U) {
+    std::memmove(m_buffer.data(), m_buffer.data() + m_readIndex, pending);
+    m_readIndex = 0U;
+    m_writeIndex = pending;
+    return;
+  }
+
+  /* A single frame fills the whole buffer, peekFrameLength() bounds its size */
+  size_t frameLength = peekFrameLength(m_buffer.data(), pending);
+  m_buffer.resize(frameLength > m_buffer.size() ? frameLength : m_buffer.size() * 2U);
+}
+
+void transmitFrame(int fd, std::string_view frame) {
+  size_t bytesSent = 0U;
+
+  while (bytesSent < frame.length()) {
+    ssize_t result = send(fd, frame.data() + bytesSent, frame.length() - bytesSent, MSG_NOSIGNAL);
+
+    if (result >= 0) {
+      bytesSent += static_cast<size_t>(result);
+      continue;
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      struct pollfd writeFd = { .fd = fd, .events = POLLOUT, .revents = 0 };
+      poll(&writeFd, 1, -1);
+      continue;
+    }
+
+    throw std::runtime_error("Socket write failed: " + std::string(strerror(errno)));
+  }
+}
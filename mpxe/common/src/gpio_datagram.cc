@@ -35,7 +35,7 @@ std::string Gpio::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void Gpio::deserialize(std::string &gpioDatagramPayload) {
+void Gpio::deserialize(std::string_view gpioDatagramPayload) {
   if (gpioDatagramPayload.size() < 3U) {
     throw std::runtime_error("Invalid GPIO datagram payload");
   }
@@ -35,7 +35,7 @@ std::string I2C::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void I2C::deserialize(std::string &i2cDatagramPayload) {
+void I2C::deserialize(std::string_view i2cDatagramPayload) {
   size_t offset = 0;
 
   m_i2cDatagram.i2cPort = static_cast<Port>(deserializeInteger<uint8_t>(i2cDatagramPayload, offset));
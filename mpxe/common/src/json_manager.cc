@@ -10,30 +10,29 @@
 /* Standard library Headers */
 #include <chrono>
 #include <ctime>
+#include <utility>
 
 /* Inter-component Headers */
 
 /* Intra-component Headers */
 #include "json_manager.h"
+#include "thread_helpers.h"
 
-void JSONManager::createDefaultProjectJSON(const std::string &projectName) {
-  if (projectExists(projectName)) {
-    std::cerr << "Project '" << projectName << "' already exists." << std::endl;
-    return;
-  }
+JSONManager::ProjectState &JSONManager::createDefaultProjectJSON(const std::string &projectName) {
+  std::time_t now = std::time(nullptr);
 
-  try {
-    std::time_t now = std::time(nullptr);
+  /* YYYY-MM-DD HH:MM:SS -> 19 chars + null terminator */
+  char timeBuffer[20];
+  std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
 
-    /* YYYY-MM-DD HH:MM:SS -> 19 chars + null terminator */
-    char timeBuffer[20];
-    std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+  nlohmann::json defaultJSON = { { "project_name", projectName }, { "version", "1.0.0" }, { "created_at", std::string(timeBuffer) }, { "settings", nlohmann::json::object() } };
 
-    nlohmann::json defaultJSON = { { "project_name", projectName }, { "version", "1.0.0" }, { "created_at", std::string(timeBuffer) }, { "settings", nlohmann::json::object() } };
-    saveProjectJSON(projectName, defaultJSON);
-  } catch (const std::exception &e) {
-    std::cerr << "Error creating project JSON: " << e.what() << std::endl;
-  }
+  ProjectState &projectState = m_projectStates[projectName];
+  projectState.data = std::move(defaultJSON);
+  projectState.dirty = true;
+  projectState.revision = 0U;
+
+  return projectState;
 }
 
 std::filesystem::path JSONManager::getProjectFilePath(const std::string &projectName) {
@@ -48,68 +47,166 @@ std::filesystem::path JSONManager::getProjectFilePath(const std::string &project
   return m_projectBasePath / (sanitizedName + ".json");
 }
 
-nlohmann::json JSONManager::loadProjectJSON(const std::string &projectName) {
+JSONManager::ProjectState &JSONManager::loadProjectJSON(const std::string &projectName) {
+  auto it = m_projectStates.find(projectName);
+
+  if (it != m_projectStates.end()) {
+    return it->second;
+  }
+
+  return createDefaultProjectJSON(projectName);
+}
+
+bool JSONManager::saveProjectJSON(const std::string &projectName, const nlohmann::json &projectData) {
   try {
     std::filesystem::path projectPath = getProjectFilePath(projectName);
 
-    if (!std::filesystem::exists(projectPath)) {
-      createDefaultProjectJSON(projectName);
-    }
+    /* The temporary file must not end in .json so it is never picked up as a project */
+    std::filesystem::path temporaryPath = projectPath;
+    temporaryPath += ".tmp";
+
+    {
+      std::ofstream projectFile(temporaryPath, std::ios::trunc);
+      if (!projectFile.is_open()) {
+        throw std::runtime_error("Could not open project JSON file for writing");
+      }
 
-    std::ifstream projectFile(projectPath);
-    if (!projectFile.is_open()) {
-      throw std::runtime_error("Could not open project JSON file");
+      projectFile << projectData.dump(2);
+
+      if (!projectFile.good()) {
+        throw std::runtime_error("Could not write project JSON file");
+      }
     }
 
-    return nlohmann::json::parse(projectFile);
+    std::filesystem::rename(temporaryPath, projectPath);
+    return true;
   } catch (const std::exception &e) {
-    std::cerr << "Error loading project JSON: " << e.what() << std::endl;
+    std::cerr << "Error saving project JSON: " << e.what() << std::endl;
+    return false;
   }
-  return nlohmann::json::object();
 }
 
-void JSONManager::saveProjectJSON(const std::string &projectName, const nlohmann::json &projectData) {
-  try {
-    std::filesystem::path projectPath = getProjectFilePath(projectName);
+void JSONManager::flush() {
+  struct Snapshot {
+    std::string projectName;
+    nlohmann::json data;
+    unsigned long revision;
+  };
+  std::vector<Snapshot> snapshots;
+
+  /* Serialize with other flushes and deletes, so no two writers share a temporary file and a deleted project is not written back */
+  pthread_mutex_lock(&m_fileMutex);
+
+  /* Copy the changed documents so the disk writes happen outside of the lock */
+  pthread_mutex_lock(&m_mutex);
+  for (const auto &pair : m_projectStates) {
+    if (pair.second.dirty) {
+      snapshots.push_back({ pair.first, pair.second.data, pair.second.revision });
+    }
+  }
+  pthread_mutex_unlock(&m_mutex);
 
-    std::ofstream projectFile(projectPath);
-    if (!projectFile.is_open()) {
-      throw std::runtime_error("Could not open project JSON file for writing");
+  for (const auto &snapshot : snapshots) {
+    if (!saveProjectJSON(snapshot.projectName, snapshot.data)) {
+      continue;
     }
 
-    projectFile << projectData.dump(2);
-  } catch (const std::exception &e) {
-    std::cerr << "Error saving project JSON: " << e.what() << std::endl;
+    /* Leave the project dirty if it changed while it was being written */
+    pthread_mutex_lock(&m_mutex);
+    auto it = m_projectStates.find(snapshot.projectName);
+    if (it != m_projectStates.end() && it->second.revision == snapshot.revision) {
+      it->second.dirty = false;
+    }
+    pthread_mutex_unlock(&m_mutex);
   }
+
+  pthread_mutex_unlock(&m_fileMutex);
+}
+
+void JSONManager::flushProcedure() {
+  while (m_isFlushing) {
+    thread_sleep_ms(m_flushPeriodMs);
+    flush();
+  }
+}
+
+void *flushWrapper(void *param) {
+  JSONManager *jsonManager = static_cast<JSONManager *>(param);
+
+  try {
+    jsonManager->flushProcedure();
+  } catch (std::exception &e) {
+    std::cerr << "JSON Manager Flush Thread Error: " << e.what() << std::endl;
+  }
+
+  return nullptr;
+}
+
+void JSONManager::setFlushPeriod(unsigned int periodMs) {
+  m_flushPeriodMs = periodMs;
 }
 
 JSONManager::JSONManager() {
+  pthread_mutex_init(&m_mutex, nullptr);
+  pthread_mutex_init(&m_fileMutex, nullptr);
+  m_flushPeriodMs = DEFAULT_FLUSH_PERIOD_MS;
+
   /* Create the JSON output directory */
   m_projectBasePath = std::filesystem::absolute(DEFAULT_JSON_PATH);
   std::filesystem::create_directories(m_projectBasePath);
 
   /* Clean up the directory by deleting all .json files */
   for (const auto &file : std::filesystem::directory_iterator(m_projectBasePath)) {
-    if (file.is_regular_file() && file.path().extension() == ".json") {
+    if (file.is_regular_file() && (file.path().extension() == ".json" || file.path().extension() == ".tmp")) {
       std::filesystem::remove(file.path());
     }
   }
+
+  m_isFlushing = true;
+
+  if (pthread_create(&m_flushThreadId, nullptr, flushWrapper, this)) {
+    m_isFlushing = false;
+    throw std::runtime_error("JSON flush thread creation error");
+  }
+}
+
+JSONManager::~JSONManager() {
+  if (m_isFlushing) {
+    m_isFlushing = false;
+    pthread_join(m_flushThreadId, nullptr);
+  }
+
+  flush();
+  pthread_mutex_destroy(&m_fileMutex);
+  pthread_mutex_destroy(&m_mutex);
 }
 
 bool JSONManager::projectExists(const std::string &projectName) {
-  return std::filesystem::exists(getProjectFilePath(projectName));
+  pthread_mutex_lock(&m_mutex);
+  bool exists = m_projectStates.count(projectName) > 0U;
+  pthread_mutex_unlock(&m_mutex);
+
+  return exists;
 }
 
 void JSONManager::deleteProject(const std::string &projectName) {
+  pthread_mutex_lock(&m_fileMutex);
+
   try {
+    pthread_mutex_lock(&m_mutex);
+    size_t numErased = m_projectStates.erase(projectName);
+    pthread_mutex_unlock(&m_mutex);
+
     std::filesystem::path projectPath = getProjectFilePath(projectName);
 
     if (std::filesystem::exists(projectPath)) {
       std::filesystem::remove(projectPath);
-    } else {
+    } else if (numErased == 0U) {
       std::cerr << "Project '" << projectName << "' does not exist." << std::endl;
     }
   } catch (const std::exception &e) {
     std::cerr << "Error deleting project JSON: " << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_fileMutex);
 }
@@ -30,7 +30,7 @@ std::string Metadata::serialize() const {
   return encodeCommand(CommandCode::METADATA, serializedData);
 }
 
-void Metadata::deserialize(std::string &metadataPayload) {
+void Metadata::deserialize(std::string_view metadataPayload) {
   size_t offset = 0;
 
   m_metadata.projectName = deserializeString(metadataPayload, offset);
@@ -22,9 +22,9 @@ void serializeString(std::string &target, const std::string &str) {
   target.append(str);
 }
 
-std::string deserializeString(std::string &source, size_t &offset) {
+std::string deserializeString(std::string_view source, size_t &offset) {
   uint16_t length = deserializeInteger<uint16_t>(source, offset);
-  std::string str = source.substr(offset, length);
+  std::string str(source.substr(offset, length));
   offset += length;
   return str;
 }
@@ -35,7 +35,7 @@ std::string SPI::serialize(const CommandCode &commandCode) const {
   return encodeCommand(commandCode, serializedData);
 }
 
-void SPI::deserialize(std::string &spiDatagramPayload) {
+void SPI::deserialize(std::string_view spiDatagramPayload) {
   size_t offset = 0;
 
   m_spiDatagram.spiPort = static_cast<Port>(deserializeInteger<uint8_t>(spiDatagramPayload, offset));
@@ -0,0 +1,52 @@
+/************************************************************************************************
+ * @file   time_sync_datagram.cc
+ *
+ * @brief  Source file defining the TimeSyncDatagram class
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <cstdint>
+#include <stdexcept>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "serialization.h"
+#include "time_sync_datagram.h"
+
+namespace Datagram {
+
+TimeSync::TimeSync(Payload &data) {
+  m_timeSyncDatagram = data;
+}
+
+std::string TimeSync::serialize(const CommandCode &commandCode) const {
+  std::string serializedData;
+
+  serializeInteger<uint64_t>(serializedData, m_timeSyncDatagram.tick);
+
+  return encodeCommand(commandCode, serializedData);
+}
+
+void TimeSync::deserialize(std::string_view timeSyncDatagramPayload) {
+  if (timeSyncDatagramPayload.size() < sizeof(uint64_t)) {
+    throw std::runtime_error("Invalid TimeSync datagram payload");
+  }
+
+  size_t offset = 0U;
+
+  m_timeSyncDatagram.tick = deserializeInteger<uint64_t>(timeSyncDatagramPayload, offset);
+}
+
+void TimeSync::setTick(uint64_t tick) {
+  m_timeSyncDatagram.tick = tick;
+}
+
+uint64_t TimeSync::getTick() const {
+  return m_timeSyncDatagram.tick;
+}
+
+}  // namespace Datagram
@@ -110,28 +110,28 @@ class AdcManager {
    * @param   projectName Project name for which data is updated
    * @param   payload Serialized data payload containing the reading
    */
-  void updateAdcRaw(std::string &projectName, std::string &payload);
+  void updateAdcRaw(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update raw ADC readings for all ADC Channels
    * @param   projectName Project name for which data is updated
    * @param   payload Serialized data payload containing all raw readings
    */
-  void updateAdcRawAll(std::string &projectName, std::string &payload);
+  void updateAdcRawAll(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update a converted ADC reading for a specific ADC Channel
    * @param   projectName Project name for which data is updated
    * @param   payload Serialized data payload containing all raw readings
    */
-  void updateAdcConverted(std::string &projectName, std::string &payload);
+  void updateAdcConverted(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update a converted ADC reading for a all ADC Channel
    * @param   projectName Project name for which data is updated
    * @param   payload Serialized data payload containing all raw readings
    */
-  void updateAdcConvertedAll(std::string &projectName, std::string &payload);
+  void updateAdcConvertedAll(std::string &projectName, std::string_view payload);
 
   /**
    * @brief Create an ADC command for raw or converted readings
@@ -14,6 +14,7 @@
 
 /* Inter-component Headers */
 #include "json_manager.h"
+#include "time_master.h"
 
 /* Intra-component Headers */
 #include "adbms_afe_manager.h"
@@ -35,6 +36,11 @@
 #define USE_NETWORK_TIME_PROTOCOL 0U
 #endif
 
+#ifndef VIRTUAL_TIME_QUANTUM_TICKS
+/** @brief  Number of virtual-time ticks lockstep clients advance between barriers */
+#define VIRTUAL_TIME_QUANTUM_TICKS 10U
+#endif
+
 extern JSONManager serverJSONManager; /**< Global JSON Manager */
 extern GpioManager serverGpioManager; /**< Global GPIO Manager */
 extern AfeManager serverAfeManager;   /**< Global AFE Manager */
@@ -44,4 +50,5 @@ extern SPIManager serverSPIManager;   /**< Global SPI Manager */
 
 extern CanListener serverCanListener;   /**< Global CAN Listener */
 extern CanScheduler serverCanScheduler; /**< Global CAN Scheduler */
+extern TimeMaster serverTimeMaster;     /**< Global virtual-time master */
 /** @} */
@@ -11,6 +11,7 @@
 
 /* Standard library Headers */
 #include <string>
+#include <string_view>
 
 /* Inter-component Headers */
 #include "client_connection.h"
@@ -31,9 +32,9 @@
  *          based on the CommandCode
  * @param   server Pointer to the server
  * @param   client Pointer to the connected clientConnection instance
- * @param   message String message value that has been received
+ * @param   message Complete frame that has been received, only valid during the call
  */
-void applicationMessageCallback(Server *server, ClientConnection *client, std::string &message);
+void applicationMessageCallback(Server *server, ClientConnection *client, std::string_view message);
 
 /**
  * @brief   Handle connecting to a new client
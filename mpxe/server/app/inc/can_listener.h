@@ -21,6 +21,7 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <linux/can.h>
+#include <linux/net_tstamp.h>
 #include <linux/can/bcm.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
@@ -45,27 +46,61 @@
  *          This class shall cache the latest data and update the JSON every UPDATE_CAN_JSON_PERIOD_MS
  */
 class CanListener {
+ public:
+  /**
+   * @brief   CAN bus receive mode
+   */
+  enum class ReceiveMode {
+    SINGLE,  /**< One read() and one lock acquisition per CAN frame */
+    BATCHED, /**< Up to CAN_RX_BATCH_SIZE frames per recvmmsg() with one lock acquisition per batch */
+  };
+
  private:
   const std::string CAN_INTERFACE_NAME = "vcan0";  /**< SocketCAN interface name */
   const std::string CAN_JSON_NAME = "CANListener"; /**< CAN JSON file name */
 
   static const constexpr unsigned int UPDATE_CAN_JSON_PERIOD_MS = 1000U; /**< JSON Update period in milliseconds */
+  static const constexpr unsigned int CAN_RX_BATCH_SIZE = 64U;          /**< Maximum number of CAN frames read per recvmmsg() call */
 
-  std::unordered_map<std::string, nlohmann::json> m_canInfo; /**< Hash-map to cache the latest CAN data */
+  std::unordered_map<std::string, nlohmann::json> m_canInfo;  /**< Hash-map to cache the latest CAN data */
+  std::unordered_map<std::string, uint64_t> m_canTimestamps; /**< Hash-map to cache the latest receive timestamp in nanoseconds */
 
-  pthread_mutex_t m_mutex;    /**< Mutex to protect m_canInfo */
+  pthread_mutex_t m_mutex;    /**< Mutex to protect m_canInfo and the decoded CAN messages */
   pthread_t m_listenCanBusId; /**< Thread Id for listening to the CAN bus */
   pthread_t m_updateJSONId;   /**< Thread Id for updating the CAN JSON */
 
   int m_rawCanSocket;              /**< Raw SocketCAN FD */
   std::atomic<bool> m_isListening; /** Boolean flag to track the CAN bus connection status */
 
+  ReceiveMode m_receiveMode; /**< Receive mode used by listenCanBusProcedure */
+
+  /**
+   * @brief   Receive CAN frames one at a time with read()
+   * @details Frames are timestamped with the time they were read from the socket
+   */
+  void receiveSingle();
+
+  /**
+   * @brief   Receive CAN frames in batches with recvmmsg()
+   * @details Frames are timestamped by the kernel using SO_TIMESTAMPING. Hardware timestamps
+   *          are preferred when the interface provides them
+   */
+  void receiveBatched();
+
   /**
    * @brief   Handles receiving new CAN messages
    * @details This function is called by the listeningCanBusProcedure
+   *          The data is decoded in place into statically allocated storage and the message is
+   *          marked as dirty. This function is autogenerated
+   */
+  void canMessageHandler(uint32_t id, const uint8_t *data, uint64_t timestampNs);
+
+  /**
+   * @brief   Converts all dirty CAN messages to JSON and stores them in m_canInfo and m_canTimestamps
+   * @details This function is called by the updateJSONProcedure with m_mutex held
    *          This function is autogenerated
    */
-  void canMessageHandler(uint32_t id, const uint8_t *data);
+  void updateCanInfo();
 
  public:
   /**
@@ -82,6 +117,13 @@ class CanListener {
    */
   ~CanListener();
 
+  /**
+   * @brief   Set the receive mode used by the CAN bus listener
+   * @details This shall be called before listenCanBus(). Defaults to ReceiveMode::BATCHED
+   * @param   mode Receive mode to be used
+   */
+  void setReceiveMode(ReceiveMode mode);
+
   /**
    * @brief   Initiate the CAN Bus listener on a Raw SocketCAN port
    * @details This shall start the listenCanBusProcedure and updateJSONProcedure
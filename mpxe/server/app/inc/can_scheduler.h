@@ -15,6 +15,8 @@
 #include <atomic>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /* Inter-component Headers */
 #include <arpa/inet.h>
@@ -22,6 +24,7 @@
 #include <linux/can.h>
 #include <linux/can/bcm.h>
 #include <net/if.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -35,90 +38,104 @@
  * @{
  */
 
-#define NUM_FAST_CYCLE_MESSAGES 1U    /**< Number of fast cycle messages */
-#define NUM_MEDIUM_CYCLE_MESSAGES 24U /**< Number of medium cycle messages */
-#define NUM_SLOW_CYCLE_MESSAGES 4U    /**< Number of slow cycle messages */
-
 /**
- * @brief   Fast cycle Broadcast Manager message for the Linux Kernel
+ * @brief   Broadcast Manager job for a single CAN message
+ * @details The Linux Broadcast Manager identifies TX jobs by CAN ID, so every message owns its
+ *          own job. Updating a signal only rewrites the frame of its message
+ *          bcm_msg_head ends in a flexible array member, so it is stored last and the head and frame
+ *          are written to the socket with a two element iovec
  */
-struct {
-  struct can_frame frame[NUM_FAST_CYCLE_MESSAGES]; /**< CAN message frames that shall be scheduled for fast cycle */
-  struct bcm_msg_head msg_head;                    /**< Broadcast Manager message head containing metadata */
-} canFastCycleBCM;
-
-/**
- * @brief   Medium cycle Broadcast Manager message for the Linux Kernel
- */
-struct {
-  struct can_frame frame[NUM_MEDIUM_CYCLE_MESSAGES]; /**< CAN message frames that shall be scheduled for medium cycle */
-  struct bcm_msg_head msg_head;                      /**< Broadcast Manager message head containing metadata */
-} canMediumCycleBCM;
-
-/**
- * @brief   Slow cycle Broadcast Manager message for the Linux Kernel
- */
-struct {
-  struct can_frame frame[NUM_SLOW_CYCLE_MESSAGES]; /**< CAN message frames that shall be scheduled for slow cycle */
-  struct bcm_msg_head msg_head;                    /**< Broadcast Manager message head containing metadata */
-} canSlowCycleBCM;
+struct CanBcmJob {
+  unsigned int periodMs;        /**< Cycle period in milliseconds, 0 if the message is not cyclic */
+  bool isPending;               /**< Job was updated since beginUpdate() and is not yet committed */
+  struct can_frame frame;       /**< CAN message frame that shall be scheduled */
+  struct bcm_msg_head msg_head; /**< Broadcast Manager message head containing metadata */
+};
 
 /**
  * @class   CanScheduler
  * @brief   Class that handles message scheduling over a SocketCAN interface
- * @details This class is responsible scheduling CAN messages based on their cycle speed
- *          Only 3 cycle speeds are supported, Fast (1kHz), medium (10Hz) and slow (1Hz)
- *          The class shall support message updating during run-time for further bus simulation
+ * @details This class is responsible scheduling CAN messages based on their cycle period
+ *          Every message is scheduled at the period from its board YAML, which may be changed,
+ *          registered or unregistered at run-time for further bus simulation
+ *          Signal updates between beginUpdate() and commit() are coalesced into a single syscall
+ *          Signal setters pack with SYSTEM_CAN_SIGNAL_PACK like the firmware tx_all, so injected frames match the board bit-for-bit
  */
 class CanScheduler {
  private:
   const std::string CAN_INTERFACE_NAME = "vcan0"; /**< SocketCAN interface name */
 
-  static const constexpr unsigned int FAST_CYCLE_SPEED_MS = 1U;     /**< CAN fast cycle period in milliseconds */
-  static const constexpr unsigned int MEDIUM_CYCLE_SPEED_MS = 100U; /**< CAN medium cycle period in milliseconds */
-  static const constexpr unsigned int SLOW_CYCLE_SPEED_MS = 1000U;  /**< CAN slow cycle period in milliseconds */
+  static const constexpr unsigned int MAX_MESSAGE_LENGTH = 8U; /**< Max message length in bytes */
 
-  static const constexpr unsigned int SLOW_CYCLE_BCM_ID = 0U;   /**< Linux Broadcast Manager Id for tracking fast cycle messages */
-  static const constexpr unsigned int MEDIUM_CYCLE_BCM_ID = 1U; /**< Linux Broadcast Manager Id for tracking medium cycle messages */
-  static const constexpr unsigned int FAST_CYCLE_BCM_ID = 2U;   /**< Linux Broadcast Manager Id for tracking slow cycle messages */
+  static const constexpr unsigned int CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_PERIOD_MS = 1U; /**< Default fast_one_shot_msg period in milliseconds */
+  static const constexpr unsigned int CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_PERIOD_MS = 100U; /**< Default medium_one_shot_msg period in milliseconds */
+  static const constexpr unsigned int CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_PERIOD_MS = 1000U; /**< Default slow_one_shot_msg period in milliseconds */
+  static const constexpr unsigned int FRONT_CONTROLLER_DRIVE_STATUS_PERIOD_MS = 100U; /**< Default drive_status period in milliseconds */
+  static const constexpr unsigned int FRONT_CONTROLLER_FC_POWER_GROUP_A_PERIOD_MS = 1000U; /**< Default fc_power_group_a period in milliseconds */
+  static const constexpr unsigned int FRONT_CONTROLLER_FC_POWER_GROUP_B_PERIOD_MS = 1000U; /**< Default fc_power_group_b period in milliseconds */
+  static const constexpr unsigned int FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_PERIOD_MS = 1000U; /**< Default fc_power_lights_group period in milliseconds */
+  static const constexpr unsigned int TELEMETRY_IMU_DATA_PERIOD_MS = 100U; /**< Default imu_data period in milliseconds */
+  static const constexpr unsigned int STEERING_STEERING_PERIOD_MS = 100U; /**< Default steering period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_REAR_CONTROLLER_STATUS_PERIOD_MS = 100U; /**< Default rear_controller_status period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_BATTERY_STATS_A_PERIOD_MS = 100U; /**< Default battery_stats_a period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_BATTERY_STATS_B_PERIOD_MS = 100U; /**< Default battery_stats_b period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_POWER_INPUT_STATS_PERIOD_MS = 100U; /**< Default power_input_stats period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE_DISCHARGE_BITSET_PERIOD_MS = 100U; /**< Default afe_discharge_bitset period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_A_PERIOD_MS = 100U; /**< Default afe1_status_a period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_B_PERIOD_MS = 100U; /**< Default afe1_status_b period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_C_PERIOD_MS = 100U; /**< Default afe1_status_c period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_D_PERIOD_MS = 100U; /**< Default afe1_status_d period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_E_PERIOD_MS = 100U; /**< Default afe1_status_e period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE1_STATUS_F_PERIOD_MS = 100U; /**< Default afe1_status_f period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_A_PERIOD_MS = 100U; /**< Default afe2_status_a period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_B_PERIOD_MS = 100U; /**< Default afe2_status_b period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_C_PERIOD_MS = 100U; /**< Default afe2_status_c period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_D_PERIOD_MS = 100U; /**< Default afe2_status_d period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_E_PERIOD_MS = 100U; /**< Default afe2_status_e period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE2_STATUS_F_PERIOD_MS = 100U; /**< Default afe2_status_f period in milliseconds */
+  static const constexpr unsigned int REAR_CONTROLLER_AFE_TEMPERATURE_PERIOD_MS = 100U; /**< Default afe_temperature period in milliseconds */
+  static const constexpr unsigned int IMU_GYRO_DATA_PERIOD_MS = 100U; /**< Default gyro_data period in milliseconds */
+  static const constexpr unsigned int IMU_ACCEL_DATA_PERIOD_MS = 100U; /**< Default accel_data period in milliseconds */
 
-  static const constexpr unsigned int NUM_TOTAL_MESSAGES = 29U; /**< Total number of messages */
-  static const constexpr unsigned int MAX_MESSAGE_LENGTH = 8U;  /**< Max message length in bytes */
+  std::unordered_map<uint32_t, CanBcmJob> m_bcmJobs; /**< Broadcast Manager jobs, keyed by CAN ID */
+  std::vector<uint32_t> m_pendingJobs;              /**< CAN IDs updated since beginUpdate() that are not yet committed */
+  unsigned int m_batchDepth;                        /**< Nesting depth of beginUpdate() calls */
 
-  static const constexpr unsigned int FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX = 0U; /**< Broadcast Manager fast_one_shot_msg to Frame index mapping */
+  pthread_mutex_t m_mutex;         /**< Recursive mutex to protect the jobs, held between beginUpdate() and commit() */
+  int m_bcmCanSocket;              /**< The CAN schedulers Broadcast Manager socket FD */
+  std::atomic<bool> m_isConnected; /**< Boolean flag to track the CAN schedulers connection status */
 
-  static const constexpr unsigned int MEDIUM_STEERING_STEERING_FRAME_INDEX = 0U;                      /**< Broadcast Manager steering to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX = 1U; /**< Broadcast Manager rear_controller_status to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX = 2U;        /**< Broadcast Manager battery_stats_a to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX = 3U;        /**< Broadcast Manager battery_stats_b to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX = 4U;      /**< Broadcast Manager power_input_stats to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX = 5U;   /**< Broadcast Manager afe_discharge_bitset to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX = 6U;          /**< Broadcast Manager afe1_status_a to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX = 7U;          /**< Broadcast Manager afe1_status_b to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX = 8U;          /**< Broadcast Manager afe1_status_c to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX = 9U;          /**< Broadcast Manager afe1_status_d to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX = 10U;         /**< Broadcast Manager afe1_status_e to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX = 11U;         /**< Broadcast Manager afe1_status_f to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX = 12U;         /**< Broadcast Manager afe2_status_a to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX = 13U;         /**< Broadcast Manager afe2_status_b to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX = 14U;         /**< Broadcast Manager afe2_status_c to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX = 15U;         /**< Broadcast Manager afe2_status_d to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX = 16U;         /**< Broadcast Manager afe2_status_e to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX = 17U;         /**< Broadcast Manager afe2_status_f to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX = 18U;       /**< Broadcast Manager afe_temperature to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX = 19U; /**< Broadcast Manager medium_one_shot_msg to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_IMU_GYRO_DATA_FRAME_INDEX = 20U;                         /**< Broadcast Manager gyro_data to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX = 21U;                        /**< Broadcast Manager accel_data to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX = 22U;                    /**< Broadcast Manager imu_data to Frame index mapping */
-  static const constexpr unsigned int MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX = 23U;         /**< Broadcast Manager drive_status to Frame index mapping */
+  /**
+   * @brief   Find the job of a registered CAN message
+   * @details This shall throw an exception if the message is not registered
+   * @param   canId CAN message ID
+   * @return  Reference to the job
+   */
+  CanBcmJob &findJob(uint32_t canId);
 
-  static const constexpr unsigned int SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX = 0U;    /**< Broadcast Manager slow_one_shot_msg to Frame index mapping */
-  static const constexpr unsigned int SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX = 1U;      /**< Broadcast Manager fc_power_group_a to Frame index mapping */
-  static const constexpr unsigned int SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX = 2U;      /**< Broadcast Manager fc_power_group_b to Frame index mapping */
-  static const constexpr unsigned int SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX = 3U; /**< Broadcast Manager fc_power_lights_group to Frame index mapping */
+  /**
+   * @brief   Write a signal update for a job to the Broadcast Manager
+   * @details The job is only marked as pending if an update batch is open
+   *          Otherwise a single frame TX_SETUP is written without restarting the cycle timer
+   * @param   job The updated job
+   */
+  void updateJob(CanBcmJob &job);
 
-  int m_bcmCanSocket;              /**< The CAN schedulers Broadcast Manager socket FD */
-  std::atomic<bool> m_isConnected; /**< Boolean flag to track the CAN schedulers connection status */
+  /**
+   * @brief   Write a job to the Broadcast Manager socket
+   * @details This shall throw an exception if the write fails
+   * @param   job The job to be written
+   */
+  void writeJob(CanBcmJob &job);
+
+  /**
+   * @brief   Write a job with new timer settings to the Broadcast Manager socket
+   * @details The job timers are restarted. Later writes only replace the frame data
+   * @param   job The job to be written
+   * @param   count Number of frames sent at burstIntervalUs before the cycle period is used
+   * @param   burstIntervalUs Interval between burst frames in microseconds
+   */
+  void startJob(CanBcmJob &job, uint32_t count, unsigned int burstIntervalUs);
 
   /**
    * @brief   Schedules all CAN data by updating the Broacast Manager socket
@@ -134,12 +151,192 @@ class CanScheduler {
    */
   CanScheduler();
 
+  /**
+   * @brief   Destructs a CanScheduler object
+   * @details The destructor shall release the mutex
+   */
+  ~CanScheduler();
+
+  /**
+   * @brief   Begin a batch of signal updates
+   * @details Signal updates are held back until the matching commit() call
+   *          Batches may be nested, only the outermost commit() writes to the socket
+   *          Other threads are blocked from updating signals until the batch is committed
+   */
+  void beginUpdate();
+
+  /**
+   * @brief   Commit a batch of signal updates
+   * @details All messages updated since beginUpdate() are written with a single sendmmsg() call
+   */
+  void commit();
+
   /**
    * @brief   Starts the CAN scheduler and sets all messages to 0. Must only be called once
    * @details This function will connect to the Linux Broadcast Manager
    *          This function must only be called once, and it will set all messages to 0
    */
   void startCanScheduler();
+
+  /**
+   * @brief   Register a CAN message, or replace an already registered message
+   * @details The message is scheduled immediately if the scheduler is running
+   *          This shall throw an exception if the length is invalid or the write fails
+   * @param   canId CAN message ID
+   * @param   dlc CAN message length in bytes
+   * @param   periodMs Cycle period in milliseconds, 0 to only send the message with sendBurst()
+   * @param   data Initial CAN data of dlc bytes, or nullptr to set the data to 0
+   */
+  void registerMessage(uint32_t canId, uint8_t dlc, unsigned int periodMs, const uint8_t *data = nullptr);
+
+  /**
+   * @brief   Unregister a CAN message and stop its transmission
+   * @details This shall throw an exception if the message is not registered
+   * @param   canId CAN message ID
+   */
+  void unregisterMessage(uint32_t canId);
+
+  /**
+   * @brief   Change the cycle period of a registered CAN message
+   * @details This shall throw an exception if the message is not registered
+   * @param   canId CAN message ID
+   * @param   periodMs New cycle period in milliseconds, 0 to stop cyclic transmission
+   */
+  void setMessagePeriod(uint32_t canId, unsigned int periodMs);
+
+  /**
+   * @brief   Send a burst of a registered CAN message with its current data
+   * @details The message is sent count times at burstIntervalUs and then returns to its cycle period
+   *          This shall throw an exception if the message is not registered
+   * @param   canId CAN message ID
+   * @param   count Number of frames in the burst
+   * @param   burstIntervalUs Interval between burst frames in microseconds
+   */
+  void sendBurst(uint32_t canId, uint32_t count, unsigned int burstIntervalUs);
+
+  /**
+   * @brief   Send a single CAN frame immediately without changing any scheduled message
+   * @details This shall throw an exception if the length is invalid or the write fails
+   * @param   canId CAN message ID
+   * @param   dlc CAN message length in bytes
+   * @param   data CAN data of dlc bytes
+   */
+  void sendOneShot(uint32_t canId, uint8_t dlc, const uint8_t *data);
+  /**
+   * @brief   Update the CAN value for fast_one_shot_msg sig1
+   * @param   sig1_value New value for the signal
+   */
+  void update_fast_one_shot_msg_sig1(uint16_t sig1_value);
+  /**
+   * @brief   Update the CAN value for fast_one_shot_msg sig2
+   * @param   sig2_value New value for the signal
+   */
+  void update_fast_one_shot_msg_sig2(uint16_t sig2_value);
+  /**
+   * @brief   Update the CAN value for medium_one_shot_msg sig1
+   * @param   sig1_value New value for the signal
+   */
+  void update_medium_one_shot_msg_sig1(uint16_t sig1_value);
+  /**
+   * @brief   Update the CAN value for medium_one_shot_msg sig2
+   * @param   sig2_value New value for the signal
+   */
+  void update_medium_one_shot_msg_sig2(uint16_t sig2_value);
+  /**
+   * @brief   Update the CAN value for slow_one_shot_msg sig1
+   * @param   sig1_value New value for the signal
+   */
+  void update_slow_one_shot_msg_sig1(uint16_t sig1_value);
+  /**
+   * @brief   Update the CAN value for slow_one_shot_msg sig2
+   * @param   sig2_value New value for the signal
+   */
+  void update_slow_one_shot_msg_sig2(uint16_t sig2_value);
+  /**
+   * @brief   Update the CAN value for drive_status pedal_percentage
+   * @param   pedal_percentage_value New value for the signal
+   */
+  void update_drive_status_pedal_percentage(uint16_t pedal_percentage_value);
+  /**
+   * @brief   Update the CAN value for drive_status brake_percentage
+   * @param   brake_percentage_value New value for the signal
+   */
+  void update_drive_status_brake_percentage(uint16_t brake_percentage_value);
+  /**
+   * @brief   Update the CAN value for drive_status state_data
+   * @param   state_data_value New value for the signal
+   */
+  void update_drive_status_state_data(uint8_t state_data_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_a rev_cam_current
+   * @param   rev_cam_current_value New value for the signal
+   */
+  void update_fc_power_group_a_rev_cam_current(uint16_t rev_cam_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_a telem_current
+   * @param   telem_current_value New value for the signal
+   */
+  void update_fc_power_group_a_telem_current(uint16_t telem_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_a steering_current
+   * @param   steering_current_value New value for the signal
+   */
+  void update_fc_power_group_a_steering_current(uint16_t steering_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_a driver_fan_current
+   * @param   driver_fan_current_value New value for the signal
+   */
+  void update_fc_power_group_a_driver_fan_current(uint16_t driver_fan_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_b horn_current
+   * @param   horn_current_value New value for the signal
+   */
+  void update_fc_power_group_b_horn_current(uint16_t horn_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_group_b spare_current
+   * @param   spare_current_value New value for the signal
+   */
+  void update_fc_power_group_b_spare_current(uint16_t spare_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_lights_group brake_light_sig_current
+   * @param   brake_light_sig_current_value New value for the signal
+   */
+  void update_fc_power_lights_group_brake_light_sig_current(uint16_t brake_light_sig_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_lights_group bps_light_sig_current
+   * @param   bps_light_sig_current_value New value for the signal
+   */
+  void update_fc_power_lights_group_bps_light_sig_current(uint16_t bps_light_sig_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_lights_group right_sig_current
+   * @param   right_sig_current_value New value for the signal
+   */
+  void update_fc_power_lights_group_right_sig_current(uint16_t right_sig_current_value);
+  /**
+   * @brief   Update the CAN value for fc_power_lights_group left_sig_current
+   * @param   left_sig_current_value New value for the signal
+   */
+  void update_fc_power_lights_group_left_sig_current(uint16_t left_sig_current_value);
+  /**
+   * @brief   Update the CAN value for imu_data g_force
+   * @param   g_force_value New value for the signal
+   */
+  void update_imu_data_g_force(uint16_t g_force_value);
+  /**
+   * @brief   Update the CAN value for imu_data roll
+   * @param   roll_value New value for the signal
+   */
+  void update_imu_data_roll(uint16_t roll_value);
+  /**
+   * @brief   Update the CAN value for imu_data pitch
+   * @param   pitch_value New value for the signal
+   */
+  void update_imu_data_pitch(uint16_t pitch_value);
+  /**
+   * @brief   Update the CAN value for imu_data yaw
+   * @param   yaw_value New value for the signal
+   */
+  void update_imu_data_yaw(uint16_t yaw_value);
   /**
    * @brief   Update the CAN value for steering cruise_control_target_velocity
    * @param   cruise_control_target_velocity_value New value for the signal
@@ -172,14 +369,14 @@ class CanScheduler {
   void update_battery_stats_a_pack_soc(uint16_t pack_soc_value);
   /**
    * @brief   Update the CAN value for battery_stats_b max_cell_voltage
-   * @param   max_cell_voltage_value New value for the signal
+   * @param   max_cell_voltage_value New physical value for the signal
    */
-  void update_battery_stats_b_max_cell_voltage(uint16_t max_cell_voltage_value);
+  void update_battery_stats_b_max_cell_voltage(float max_cell_voltage_value);
   /**
    * @brief   Update the CAN value for battery_stats_b min_cell_voltage
-   * @param   min_cell_voltage_value New value for the signal
+   * @param   min_cell_voltage_value New physical value for the signal
    */
-  void update_battery_stats_b_min_cell_voltage(uint16_t min_cell_voltage_value);
+  void update_battery_stats_b_min_cell_voltage(float min_cell_voltage_value);
   /**
    * @brief   Update the CAN value for battery_stats_b max_temperature
    * @param   max_temperature_value New value for the signal
@@ -222,19 +419,19 @@ class CanScheduler {
   void update_afe1_status_a_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_a voltage_0
-   * @param   voltage_0_value New value for the signal
+   * @param   voltage_0_value New physical value for the signal
    */
-  void update_afe1_status_a_voltage_0(uint16_t voltage_0_value);
+  void update_afe1_status_a_voltage_0(float voltage_0_value);
   /**
    * @brief   Update the CAN value for afe1_status_a voltage_1
-   * @param   voltage_1_value New value for the signal
+   * @param   voltage_1_value New physical value for the signal
    */
-  void update_afe1_status_a_voltage_1(uint16_t voltage_1_value);
+  void update_afe1_status_a_voltage_1(float voltage_1_value);
   /**
    * @brief   Update the CAN value for afe1_status_a voltage_2
-   * @param   voltage_2_value New value for the signal
+   * @param   voltage_2_value New physical value for the signal
    */
-  void update_afe1_status_a_voltage_2(uint16_t voltage_2_value);
+  void update_afe1_status_a_voltage_2(float voltage_2_value);
   /**
    * @brief   Update the CAN value for afe1_status_b id
    * @param   id_value New value for the signal
@@ -242,19 +439,19 @@ class CanScheduler {
   void update_afe1_status_b_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_b voltage_3
-   * @param   voltage_3_value New value for the signal
+   * @param   voltage_3_value New physical value for the signal
    */
-  void update_afe1_status_b_voltage_3(uint16_t voltage_3_value);
+  void update_afe1_status_b_voltage_3(float voltage_3_value);
   /**
    * @brief   Update the CAN value for afe1_status_b voltage_4
-   * @param   voltage_4_value New value for the signal
+   * @param   voltage_4_value New physical value for the signal
    */
-  void update_afe1_status_b_voltage_4(uint16_t voltage_4_value);
+  void update_afe1_status_b_voltage_4(float voltage_4_value);
   /**
    * @brief   Update the CAN value for afe1_status_b voltage_5
-   * @param   voltage_5_value New value for the signal
+   * @param   voltage_5_value New physical value for the signal
    */
-  void update_afe1_status_b_voltage_5(uint16_t voltage_5_value);
+  void update_afe1_status_b_voltage_5(float voltage_5_value);
   /**
    * @brief   Update the CAN value for afe1_status_c id
    * @param   id_value New value for the signal
@@ -262,19 +459,19 @@ class CanScheduler {
   void update_afe1_status_c_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_c voltage_6
-   * @param   voltage_6_value New value for the signal
+   * @param   voltage_6_value New physical value for the signal
    */
-  void update_afe1_status_c_voltage_6(uint16_t voltage_6_value);
+  void update_afe1_status_c_voltage_6(float voltage_6_value);
   /**
    * @brief   Update the CAN value for afe1_status_c voltage_7
-   * @param   voltage_7_value New value for the signal
+   * @param   voltage_7_value New physical value for the signal
    */
-  void update_afe1_status_c_voltage_7(uint16_t voltage_7_value);
+  void update_afe1_status_c_voltage_7(float voltage_7_value);
   /**
    * @brief   Update the CAN value for afe1_status_c voltage_8
-   * @param   voltage_8_value New value for the signal
+   * @param   voltage_8_value New physical value for the signal
    */
-  void update_afe1_status_c_voltage_8(uint16_t voltage_8_value);
+  void update_afe1_status_c_voltage_8(float voltage_8_value);
   /**
    * @brief   Update the CAN value for afe1_status_d id
    * @param   id_value New value for the signal
@@ -282,19 +479,19 @@ class CanScheduler {
   void update_afe1_status_d_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_d voltage_9
-   * @param   voltage_9_value New value for the signal
+   * @param   voltage_9_value New physical value for the signal
    */
-  void update_afe1_status_d_voltage_9(uint16_t voltage_9_value);
+  void update_afe1_status_d_voltage_9(float voltage_9_value);
   /**
    * @brief   Update the CAN value for afe1_status_d voltage_10
-   * @param   voltage_10_value New value for the signal
+   * @param   voltage_10_value New physical value for the signal
    */
-  void update_afe1_status_d_voltage_10(uint16_t voltage_10_value);
+  void update_afe1_status_d_voltage_10(float voltage_10_value);
   /**
    * @brief   Update the CAN value for afe1_status_d voltage_11
-   * @param   voltage_11_value New value for the signal
+   * @param   voltage_11_value New physical value for the signal
    */
-  void update_afe1_status_d_voltage_11(uint16_t voltage_11_value);
+  void update_afe1_status_d_voltage_11(float voltage_11_value);
   /**
    * @brief   Update the CAN value for afe1_status_e id
    * @param   id_value New value for the signal
@@ -302,19 +499,19 @@ class CanScheduler {
   void update_afe1_status_e_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_e voltage_12
-   * @param   voltage_12_value New value for the signal
+   * @param   voltage_12_value New physical value for the signal
    */
-  void update_afe1_status_e_voltage_12(uint16_t voltage_12_value);
+  void update_afe1_status_e_voltage_12(float voltage_12_value);
   /**
    * @brief   Update the CAN value for afe1_status_e voltage_13
-   * @param   voltage_13_value New value for the signal
+   * @param   voltage_13_value New physical value for the signal
    */
-  void update_afe1_status_e_voltage_13(uint16_t voltage_13_value);
+  void update_afe1_status_e_voltage_13(float voltage_13_value);
   /**
    * @brief   Update the CAN value for afe1_status_e voltage_14
-   * @param   voltage_14_value New value for the signal
+   * @param   voltage_14_value New physical value for the signal
    */
-  void update_afe1_status_e_voltage_14(uint16_t voltage_14_value);
+  void update_afe1_status_e_voltage_14(float voltage_14_value);
   /**
    * @brief   Update the CAN value for afe1_status_f id
    * @param   id_value New value for the signal
@@ -322,19 +519,19 @@ class CanScheduler {
   void update_afe1_status_f_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe1_status_f voltage_15
-   * @param   voltage_15_value New value for the signal
+   * @param   voltage_15_value New physical value for the signal
    */
-  void update_afe1_status_f_voltage_15(uint16_t voltage_15_value);
+  void update_afe1_status_f_voltage_15(float voltage_15_value);
   /**
    * @brief   Update the CAN value for afe1_status_f voltage_16
-   * @param   voltage_16_value New value for the signal
+   * @param   voltage_16_value New physical value for the signal
    */
-  void update_afe1_status_f_voltage_16(uint16_t voltage_16_value);
+  void update_afe1_status_f_voltage_16(float voltage_16_value);
   /**
    * @brief   Update the CAN value for afe1_status_f voltage_17
-   * @param   voltage_17_value New value for the signal
+   * @param   voltage_17_value New physical value for the signal
    */
-  void update_afe1_status_f_voltage_17(uint16_t voltage_17_value);
+  void update_afe1_status_f_voltage_17(float voltage_17_value);
   /**
    * @brief   Update the CAN value for afe2_status_a id
    * @param   id_value New value for the signal
@@ -342,19 +539,19 @@ class CanScheduler {
   void update_afe2_status_a_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_a voltage_0
-   * @param   voltage_0_value New value for the signal
+   * @param   voltage_0_value New physical value for the signal
    */
-  void update_afe2_status_a_voltage_0(uint16_t voltage_0_value);
+  void update_afe2_status_a_voltage_0(float voltage_0_value);
   /**
    * @brief   Update the CAN value for afe2_status_a voltage_1
-   * @param   voltage_1_value New value for the signal
+   * @param   voltage_1_value New physical value for the signal
    */
-  void update_afe2_status_a_voltage_1(uint16_t voltage_1_value);
+  void update_afe2_status_a_voltage_1(float voltage_1_value);
   /**
    * @brief   Update the CAN value for afe2_status_a voltage_2
-   * @param   voltage_2_value New value for the signal
+   * @param   voltage_2_value New physical value for the signal
    */
-  void update_afe2_status_a_voltage_2(uint16_t voltage_2_value);
+  void update_afe2_status_a_voltage_2(float voltage_2_value);
   /**
    * @brief   Update the CAN value for afe2_status_b id
    * @param   id_value New value for the signal
@@ -362,19 +559,19 @@ class CanScheduler {
   void update_afe2_status_b_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_b voltage_3
-   * @param   voltage_3_value New value for the signal
+   * @param   voltage_3_value New physical value for the signal
    */
-  void update_afe2_status_b_voltage_3(uint16_t voltage_3_value);
+  void update_afe2_status_b_voltage_3(float voltage_3_value);
   /**
    * @brief   Update the CAN value for afe2_status_b voltage_4
-   * @param   voltage_4_value New value for the signal
+   * @param   voltage_4_value New physical value for the signal
    */
-  void update_afe2_status_b_voltage_4(uint16_t voltage_4_value);
+  void update_afe2_status_b_voltage_4(float voltage_4_value);
   /**
    * @brief   Update the CAN value for afe2_status_b voltage_5
-   * @param   voltage_5_value New value for the signal
+   * @param   voltage_5_value New physical value for the signal
    */
-  void update_afe2_status_b_voltage_5(uint16_t voltage_5_value);
+  void update_afe2_status_b_voltage_5(float voltage_5_value);
   /**
    * @brief   Update the CAN value for afe2_status_c id
    * @param   id_value New value for the signal
@@ -382,19 +579,19 @@ class CanScheduler {
   void update_afe2_status_c_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_c voltage_6
-   * @param   voltage_6_value New value for the signal
+   * @param   voltage_6_value New physical value for the signal
    */
-  void update_afe2_status_c_voltage_6(uint16_t voltage_6_value);
+  void update_afe2_status_c_voltage_6(float voltage_6_value);
   /**
    * @brief   Update the CAN value for afe2_status_c voltage_7
-   * @param   voltage_7_value New value for the signal
+   * @param   voltage_7_value New physical value for the signal
    */
-  void update_afe2_status_c_voltage_7(uint16_t voltage_7_value);
+  void update_afe2_status_c_voltage_7(float voltage_7_value);
   /**
    * @brief   Update the CAN value for afe2_status_c voltage_8
-   * @param   voltage_8_value New value for the signal
+   * @param   voltage_8_value New physical value for the signal
    */
-  void update_afe2_status_c_voltage_8(uint16_t voltage_8_value);
+  void update_afe2_status_c_voltage_8(float voltage_8_value);
   /**
    * @brief   Update the CAN value for afe2_status_d id
    * @param   id_value New value for the signal
@@ -402,19 +599,19 @@ class CanScheduler {
   void update_afe2_status_d_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_d voltage_9
-   * @param   voltage_9_value New value for the signal
+   * @param   voltage_9_value New physical value for the signal
    */
-  void update_afe2_status_d_voltage_9(uint16_t voltage_9_value);
+  void update_afe2_status_d_voltage_9(float voltage_9_value);
   /**
    * @brief   Update the CAN value for afe2_status_d voltage_10
-   * @param   voltage_10_value New value for the signal
+   * @param   voltage_10_value New physical value for the signal
    */
-  void update_afe2_status_d_voltage_10(uint16_t voltage_10_value);
+  void update_afe2_status_d_voltage_10(float voltage_10_value);
   /**
    * @brief   Update the CAN value for afe2_status_d voltage_11
-   * @param   voltage_11_value New value for the signal
+   * @param   voltage_11_value New physical value for the signal
    */
-  void update_afe2_status_d_voltage_11(uint16_t voltage_11_value);
+  void update_afe2_status_d_voltage_11(float voltage_11_value);
   /**
    * @brief   Update the CAN value for afe2_status_e id
    * @param   id_value New value for the signal
@@ -422,19 +619,19 @@ class CanScheduler {
   void update_afe2_status_e_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_e voltage_12
-   * @param   voltage_12_value New value for the signal
+   * @param   voltage_12_value New physical value for the signal
    */
-  void update_afe2_status_e_voltage_12(uint16_t voltage_12_value);
+  void update_afe2_status_e_voltage_12(float voltage_12_value);
   /**
    * @brief   Update the CAN value for afe2_status_e voltage_13
-   * @param   voltage_13_value New value for the signal
+   * @param   voltage_13_value New physical value for the signal
    */
-  void update_afe2_status_e_voltage_13(uint16_t voltage_13_value);
+  void update_afe2_status_e_voltage_13(float voltage_13_value);
   /**
    * @brief   Update the CAN value for afe2_status_e voltage_14
-   * @param   voltage_14_value New value for the signal
+   * @param   voltage_14_value New physical value for the signal
    */
-  void update_afe2_status_e_voltage_14(uint16_t voltage_14_value);
+  void update_afe2_status_e_voltage_14(float voltage_14_value);
   /**
    * @brief   Update the CAN value for afe2_status_f id
    * @param   id_value New value for the signal
@@ -442,19 +639,19 @@ class CanScheduler {
   void update_afe2_status_f_id(uint8_t id_value);
   /**
    * @brief   Update the CAN value for afe2_status_f voltage_15
-   * @param   voltage_15_value New value for the signal
+   * @param   voltage_15_value New physical value for the signal
    */
-  void update_afe2_status_f_voltage_15(uint16_t voltage_15_value);
+  void update_afe2_status_f_voltage_15(float voltage_15_value);
   /**
    * @brief   Update the CAN value for afe2_status_f voltage_16
-   * @param   voltage_16_value New value for the signal
+   * @param   voltage_16_value New physical value for the signal
    */
-  void update_afe2_status_f_voltage_16(uint16_t voltage_16_value);
+  void update_afe2_status_f_voltage_16(float voltage_16_value);
   /**
    * @brief   Update the CAN value for afe2_status_f voltage_17
-   * @param   voltage_17_value New value for the signal
+   * @param   voltage_17_value New physical value for the signal
    */
-  void update_afe2_status_f_voltage_17(uint16_t voltage_17_value);
+  void update_afe2_status_f_voltage_17(float voltage_17_value);
   /**
    * @brief   Update the CAN value for afe_temperature id
    * @param   id_value New value for the signal
@@ -495,36 +692,6 @@ class CanScheduler {
    * @param   temperature_6_value New value for the signal
    */
   void update_afe_temperature_temperature_6(uint8_t temperature_6_value);
-  /**
-   * @brief   Update the CAN value for fast_one_shot_msg sig1
-   * @param   sig1_value New value for the signal
-   */
-  void update_fast_one_shot_msg_sig1(uint16_t sig1_value);
-  /**
-   * @brief   Update the CAN value for fast_one_shot_msg sig2
-   * @param   sig2_value New value for the signal
-   */
-  void update_fast_one_shot_msg_sig2(uint16_t sig2_value);
-  /**
-   * @brief   Update the CAN value for medium_one_shot_msg sig1
-   * @param   sig1_value New value for the signal
-   */
-  void update_medium_one_shot_msg_sig1(uint16_t sig1_value);
-  /**
-   * @brief   Update the CAN value for medium_one_shot_msg sig2
-   * @param   sig2_value New value for the signal
-   */
-  void update_medium_one_shot_msg_sig2(uint16_t sig2_value);
-  /**
-   * @brief   Update the CAN value for slow_one_shot_msg sig1
-   * @param   sig1_value New value for the signal
-   */
-  void update_slow_one_shot_msg_sig1(uint16_t sig1_value);
-  /**
-   * @brief   Update the CAN value for slow_one_shot_msg sig2
-   * @param   sig2_value New value for the signal
-   */
-  void update_slow_one_shot_msg_sig2(uint16_t sig2_value);
   /**
    * @brief   Update the CAN value for gyro_data x_axis
    * @param   x_axis_value New value for the signal
@@ -555,91 +722,6 @@ class CanScheduler {
    * @param   z_axis_value New value for the signal
    */
   void update_accel_data_z_axis(uint16_t z_axis_value);
-  /**
-   * @brief   Update the CAN value for imu_data g_force
-   * @param   g_force_value New value for the signal
-   */
-  void update_imu_data_g_force(uint16_t g_force_value);
-  /**
-   * @brief   Update the CAN value for imu_data roll
-   * @param   roll_value New value for the signal
-   */
-  void update_imu_data_roll(uint16_t roll_value);
-  /**
-   * @brief   Update the CAN value for imu_data pitch
-   * @param   pitch_value New value for the signal
-   */
-  void update_imu_data_pitch(uint16_t pitch_value);
-  /**
-   * @brief   Update the CAN value for imu_data yaw
-   * @param   yaw_value New value for the signal
-   */
-  void update_imu_data_yaw(uint16_t yaw_value);
-  /**
-   * @brief   Update the CAN value for drive_status pedal_percentage
-   * @param   pedal_percentage_value New value for the signal
-   */
-  void update_drive_status_pedal_percentage(uint16_t pedal_percentage_value);
-  /**
-   * @brief   Update the CAN value for drive_status brake_percentage
-   * @param   brake_percentage_value New value for the signal
-   */
-  void update_drive_status_brake_percentage(uint16_t brake_percentage_value);
-  /**
-   * @brief   Update the CAN value for drive_status state_data
-   * @param   state_data_value New value for the signal
-   */
-  void update_drive_status_state_data(uint8_t state_data_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_a rev_cam_current
-   * @param   rev_cam_current_value New value for the signal
-   */
-  void update_fc_power_group_a_rev_cam_current(uint16_t rev_cam_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_a telem_current
-   * @param   telem_current_value New value for the signal
-   */
-  void update_fc_power_group_a_telem_current(uint16_t telem_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_a steering_current
-   * @param   steering_current_value New value for the signal
-   */
-  void update_fc_power_group_a_steering_current(uint16_t steering_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_a driver_fan_current
-   * @param   driver_fan_current_value New value for the signal
-   */
-  void update_fc_power_group_a_driver_fan_current(uint16_t driver_fan_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_b horn_current
-   * @param   horn_current_value New value for the signal
-   */
-  void update_fc_power_group_b_horn_current(uint16_t horn_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_group_b spare_current
-   * @param   spare_current_value New value for the signal
-   */
-  void update_fc_power_group_b_spare_current(uint16_t spare_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_lights_group brake_light_sig_current
-   * @param   brake_light_sig_current_value New value for the signal
-   */
-  void update_fc_power_lights_group_brake_light_sig_current(uint16_t brake_light_sig_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_lights_group bps_light_sig_current
-   * @param   bps_light_sig_current_value New value for the signal
-   */
-  void update_fc_power_lights_group_bps_light_sig_current(uint16_t bps_light_sig_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_lights_group right_sig_current
-   * @param   right_sig_current_value New value for the signal
-   */
-  void update_fc_power_lights_group_right_sig_current(uint16_t right_sig_current_value);
-  /**
-   * @brief   Update the CAN value for fc_power_lights_group left_sig_current
-   * @param   left_sig_current_value New value for the signal
-   */
-  void update_fc_power_lights_group_left_sig_current(uint16_t left_sig_current_value);
 };
 
-/** @} */
+/** @} */
\ No newline at end of file
@@ -81,7 +81,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioPinState(std::string &projectName, std::string &payload);
+  void updateGpioPinState(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update all Gpio Pin states for a provided project given the data payload
@@ -90,7 +90,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioAllStates(std::string &projectName, std::string &payload);
+  void updateGpioAllStates(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update a Gpio Pin mode for a provided project given the data payload
@@ -99,7 +99,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioPinMode(std::string &projectName, std::string &payload);
+  void updateGpioPinMode(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update all Gpio Pin modes for a provided project given the data payload
@@ -108,7 +108,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioAllModes(std::string &projectName, std::string &payload);
+  void updateGpioAllModes(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update a Gpio Pin alternate function for a provided project given the data payload
@@ -117,7 +117,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioPinAltFunction(std::string &projectName, std::string &payload);
+  void updateGpioPinAltFunction(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Update all Gpio Pin alternate functions for a provided project given the data payload
@@ -126,7 +126,7 @@ class GpioManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateGpioAllAltFunctions(std::string &projectName, std::string &payload);
+  void updateGpioAllAltFunctions(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Create a Gpio command given a CommandCode and if required, a specific Port/Pin map and data
@@ -74,7 +74,7 @@ class I2CManager {
    * @param   projectName Name of the project to be updated
    * @param   payload Message data payload to be parsed
    */
-  void updateI2CData(std::string &projectName, std::string &payload);
+  void updateI2CData(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Create an I2C command given a CommandCode and if required, specific port and data
@@ -81,7 +81,7 @@ class SPIManager {
    * @param   projectName Project name for which data is updated
    * @param   payload Serialized data payload containing the buffer
    */
-  void updateSpiReadBuffer(std::string &projectName, std::string &payload);
+  void updateSpiReadBuffer(std::string &projectName, std::string_view payload);
 
   /**
    * @brief   Create a serialized SPI command message
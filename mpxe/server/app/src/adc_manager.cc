@@ -67,7 +67,7 @@ void AdcManager::saveAdcInfo(std::string &projectName) {
   m_adcInfo.clear();
 }
 
-void AdcManager::updateAdcRaw(std::string &projectName, std::string &payload) {
+void AdcManager::updateAdcRaw(std::string &projectName, std::string_view payload) {
   loadAdcInfo(projectName);
   m_adcDatagram.deserialize(payload);
 
@@ -87,7 +87,7 @@ void AdcManager::updateAdcRaw(std::string &projectName, std::string &payload) {
   saveAdcInfo(projectName);
 }
 
-void AdcManager::updateAdcRawAll(std::string &projectName, std::string &payload) {
+void AdcManager::updateAdcRawAll(std::string &projectName, std::string_view payload) {
   loadAdcInfo(projectName);
   m_adcDatagram.deserialize(payload);
 
@@ -104,7 +104,7 @@ void AdcManager::updateAdcRawAll(std::string &projectName, std::string &payload)
   saveAdcInfo(projectName);
 }
 
-void AdcManager::updateAdcConverted(std::string &projectName, std::string &payload) {
+void AdcManager::updateAdcConverted(std::string &projectName, std::string_view payload) {
   loadAdcInfo(projectName);
   m_adcDatagram.deserialize(payload);
 
@@ -123,7 +123,7 @@ void AdcManager::updateAdcConverted(std::string &projectName, std::string &paylo
   saveAdcInfo(projectName);
 }
 
-void AdcManager::updateAdcConvertedAll(std::string &projectName, std::string &payload) {
+void AdcManager::updateAdcConvertedAll(std::string &projectName, std::string_view payload) {
   loadAdcInfo(projectName);
   m_adcDatagram.deserialize(payload);
 
@@ -24,7 +24,7 @@
 #include "app.h"
 #include "app_callback.h"
 
-void applicationMessageCallback(Server *server, ClientConnection *client, std::string &message) {
+void applicationMessageCallback(Server *server, ClientConnection *client, std::string_view message) {
   std::string clientName = client->getClientName();
   auto [commandCode, payload] = decodeCommand(message);
   switch (commandCode) {
@@ -41,6 +41,10 @@ void applicationMessageCallback(Server *server, ClientConnection *client, std::s
       serverJSONManager.setProjectValue(client->getClientName(), "hardware_model", clientMetadata.getHardwareModel());
       break;
     }
+    case CommandCode::TIME_ACK: {
+      serverTimeMaster.handleAck(client, payload);
+      break;
+    }
     case CommandCode::GPIO_GET_PIN_STATE: {
       serverGpioManager.updateGpioPinState(clientName, payload);
       break;
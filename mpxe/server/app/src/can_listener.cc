@@ -8,10 +8,14 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <array>
+#include <cerrno>
 #include <cstring>
+#include <ctime>
 #include <iostream>
 
 /* Inter-component Headers */
+#include <linux/errqueue.h>
 #include <unistd.h>
 
 #include "system_can.h"
@@ -22,10 +26,38 @@
 #include "can_listener.h"
 
 #define CAN_MESSAGE_JSON_KEY "messages"
+#define CAN_TIMESTAMP_JSON_KEY "timestamps"
+
+/** @brief  Timestamp sources requested from the kernel for every received CAN frame */
+#define CAN_RX_TIMESTAMPING_FLAGS (SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE)
+
+static uint64_t timespecToNs(const struct timespec &ts) {
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static uint64_t extractTimestampNs(struct msghdr *msg) {
+  for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SO_TIMESTAMPING) {
+      continue;
+    }
+
+    struct scm_timestamping timestamps;
+    memcpy(&timestamps, CMSG_DATA(cmsg), sizeof(timestamps));
+
+    /* ts[2] holds the raw hardware timestamp, ts[0] the software timestamp */
+    if (timestamps.ts[2].tv_sec != 0 || timestamps.ts[2].tv_nsec != 0) {
+      return timespecToNs(timestamps.ts[2]);
+    }
+    return timespecToNs(timestamps.ts[0]);
+  }
+
+  return 0U;
+}
 
 CanListener::CanListener() {
   m_isListening = false;
   m_rawCanSocket = -1;
+  m_receiveMode = ReceiveMode::BATCHED;
   pthread_mutex_init(&m_mutex, nullptr);
 }
 
@@ -54,9 +86,29 @@ void CanListener::listenCanBusProcedure() {
     throw std::runtime_error("Error binding raw CAN socket");
   }
 
+  if (m_receiveMode == ReceiveMode::BATCHED) {
+    int timestampingFlags = CAN_RX_TIMESTAMPING_FLAGS;
+
+    if (setsockopt(m_rawCanSocket, SOL_SOCKET, SO_TIMESTAMPING, &timestampingFlags, sizeof(timestampingFlags)) < 0) {
+      throw std::runtime_error("Error enabling CAN receive timestamps");
+    }
+  }
+
   m_isListening = true;
 
+  if (m_receiveMode == ReceiveMode::BATCHED) {
+    receiveBatched();
+  } else {
+    receiveSingle();
+  }
+
+  close(m_rawCanSocket);
+  m_isListening = false;
+}
+
+void CanListener::receiveSingle() {
   struct can_frame canFrame;
+  struct timespec rxTime;
   int numBytes;
 
   while (m_isListening) {
@@ -67,19 +119,62 @@ void CanListener::listenCanBusProcedure() {
       break;
     }
 
+    clock_gettime(CLOCK_REALTIME, &rxTime);
+
     pthread_mutex_lock(&m_mutex);
-    canMessageHandler(canFrame.can_id, canFrame.data);
+    canMessageHandler(canFrame.can_id, canFrame.data, timespecToNs(rxTime));
     pthread_mutex_unlock(&m_mutex);
   }
+}
 
-  close(m_rawCanSocket);
-  m_isListening = false;
+void CanListener::receiveBatched() {
+  std::array<struct can_frame, CAN_RX_BATCH_SIZE> canFrames;
+  std::array<struct iovec, CAN_RX_BATCH_SIZE> iovecs;
+  std::array<struct mmsghdr, CAN_RX_BATCH_SIZE> messages;
+  alignas(struct cmsghdr) std::array<std::array<char, CMSG_SPACE(sizeof(struct scm_timestamping))>, CAN_RX_BATCH_SIZE> controlBuffers;
+
+  for (unsigned int i = 0U; i < CAN_RX_BATCH_SIZE; i++) {
+    iovecs[i].iov_base = &canFrames[i];
+    iovecs[i].iov_len = sizeof(struct can_frame);
+  }
+
+  while (m_isListening) {
+    /* recvmmsg() overwrites the lengths, so the headers are reset before every batch */
+    for (unsigned int i = 0U; i < CAN_RX_BATCH_SIZE; i++) {
+      messages[i].msg_hdr = {};
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1U;
+      messages[i].msg_hdr.msg_control = controlBuffers[i].data();
+      messages[i].msg_hdr.msg_controllen = controlBuffers[i].size();
+      messages[i].msg_len = 0U;
+    }
+
+    int numFrames = recvmmsg(m_rawCanSocket, messages.data(), CAN_RX_BATCH_SIZE, MSG_WAITFORONE, nullptr);
+
+    if (numFrames < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error("Error reading CAN data");
+    }
+
+    pthread_mutex_lock(&m_mutex);
+    for (int i = 0; i < numFrames; i++) {
+      if (messages[i].msg_len < sizeof(struct can_frame)) {
+        continue;
+      }
+      canMessageHandler(canFrames[i].can_id, canFrames[i].data, extractTimestampNs(&messages[i].msg_hdr));
+    }
+    pthread_mutex_unlock(&m_mutex);
+  }
 }
 
 void CanListener::updateJSONProcedure() {
   while (m_isListening) {
     pthread_mutex_lock(&m_mutex);
+    updateCanInfo();
     serverJSONManager.setProjectValue(CAN_JSON_NAME, CAN_MESSAGE_JSON_KEY, m_canInfo);
+    serverJSONManager.setProjectValue(CAN_JSON_NAME, CAN_TIMESTAMP_JSON_KEY, m_canTimestamps);
     pthread_mutex_unlock(&m_mutex);
 
     thread_sleep_ms(UPDATE_CAN_JSON_PERIOD_MS);
@@ -110,6 +205,12 @@ void *updateJSONWrapper(void *param) {
   return nullptr;
 }
 
+void CanListener::setReceiveMode(ReceiveMode mode) {
+  if (m_isListening) return;
+
+  m_receiveMode = mode;
+}
+
 void CanListener::listenCanBus() {
   if (m_isListening) return;
 
@@ -3,14 +3,16 @@
  *
  * @brief  Source file defining the Can Message Handler function
  *
- * @date   2026-06-14
+ * @date   2026-10-17
  * @author Aryan Kashem
  ************************************************************************************************/
 
 /** @warning  This file is autogenerated */
 
 /* Standard library Headers */
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <unordered_map>
@@ -23,1928 +25,1089 @@
 /* Intra-component Headers */
 #include "can_listener.h"
 
+namespace {
+/** @brief  Marker for CAN IDs that do not belong to any known message */
+constexpr uint16_t CAN_MESSAGE_INDEX_NONE = 0xFFFFU;
+
+/** @brief  Number of entries in the CAN ID lookup table, one per standard 11-bit ID */
+constexpr size_t CAN_MESSAGE_LOOKUP_SIZE = CAN_SFF_MASK + 1U;
+
+/** @brief  Number of messages in the CAN message table */
+constexpr size_t NUM_CAN_MESSAGES = 29U;
+
 /**
- * @brief   Storage class for steering CAN message
+ * @brief   Storage class for fast_one_shot_msg CAN message
  */
-struct steering {
-  uint32_t cruise_control_target_velocity; /**< CAN signal 'cruise_control_target_velocity' defined in *.yaml */
-  uint8_t buttons;                         /**< CAN signal 'buttons' defined in *.yaml */
+struct fast_one_shot_msg {
+  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
+  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for steering
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for fast_one_shot_msg
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 2]) << 16U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 3]) << 24U;
-
-      cruise_control_target_velocity = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      buttons = raw_val;
-    }
+  void decode(uint64_t data) {
+    sig1 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG1));
+    sig2 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG2));
   }
 
   /**
-   * @brief   Create a JSON object for steering using the storage
+   * @brief   Create a JSON object for fast_one_shot_msg using the storage
    */
   nlohmann::json to_json() const {
-    return { { "cruise_control_target_velocity", cruise_control_target_velocity }, { "buttons", buttons } };
-  }
-
-  /**
-   * @brief   Get the message name: steering
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "steering";
+    return {
+      {"sig1", sig1},
+      {"sig2", sig2}
+    };
   }
 };
+
+fast_one_shot_msg s_fast_one_shot_msg; /**< Decode storage for fast_one_shot_msg */
 /**
- * @brief   Storage class for rear_controller_status CAN message
+ * @brief   Storage class for medium_one_shot_msg CAN message
  */
-struct rear_controller_status {
-  uint32_t triggers; /**< CAN signal 'triggers' defined in *.yaml */
+struct medium_one_shot_msg {
+  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
+  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for rear_controller_status
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for medium_one_shot_msg
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 2]) << 16U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 3]) << 24U;
-
-      triggers = raw_val;
-    }
+  void decode(uint64_t data) {
+    sig1 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG1));
+    sig2 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG2));
   }
 
   /**
-   * @brief   Create a JSON object for rear_controller_status using the storage
+   * @brief   Create a JSON object for medium_one_shot_msg using the storage
    */
   nlohmann::json to_json() const {
-    return { { "triggers", triggers } };
-  }
-
-  /**
-   * @brief   Get the message name: rear_controller_status
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "rear_controller_status";
+    return {
+      {"sig1", sig1},
+      {"sig2", sig2}
+    };
   }
 };
+
+medium_one_shot_msg s_medium_one_shot_msg; /**< Decode storage for medium_one_shot_msg */
 /**
- * @brief   Storage class for battery_stats_a CAN message
+ * @brief   Storage class for slow_one_shot_msg CAN message
  */
-struct battery_stats_a {
-  uint16_t pack_voltage; /**< CAN signal 'pack_voltage' defined in *.yaml */
-  uint16_t pack_current; /**< CAN signal 'pack_current' defined in *.yaml */
-  uint16_t pack_soc;     /**< CAN signal 'pack_soc' defined in *.yaml */
+struct slow_one_shot_msg {
+  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
+  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for battery_stats_A
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for slow_one_shot_msg
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      pack_voltage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      pack_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      pack_soc = raw_val;
-    }
+  void decode(uint64_t data) {
+    sig1 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG1));
+    sig2 = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG2));
   }
 
   /**
-   * @brief   Create a JSON object for battery_stats_A using the storage
+   * @brief   Create a JSON object for slow_one_shot_msg using the storage
    */
   nlohmann::json to_json() const {
-    return { { "pack_voltage", pack_voltage }, { "pack_current", pack_current }, { "pack_soc", pack_soc } };
-  }
-
-  /**
-   * @brief   Get the message name: battery_stats_A
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "battery_stats_A";
+    return {
+      {"sig1", sig1},
+      {"sig2", sig2}
+    };
   }
 };
+
+slow_one_shot_msg s_slow_one_shot_msg; /**< Decode storage for slow_one_shot_msg */
 /**
- * @brief   Storage class for battery_stats_b CAN message
+ * @brief   Storage class for drive_status CAN message
  */
-struct battery_stats_b {
-  uint16_t max_cell_voltage; /**< CAN signal 'max_cell_voltage' defined in *.yaml */
-  uint16_t min_cell_voltage; /**< CAN signal 'min_cell_voltage' defined in *.yaml */
-  uint16_t max_temperature;  /**< CAN signal 'max_temperature' defined in *.yaml */
+struct drive_status {
+  uint16_t pedal_percentage; /**< CAN signal 'pedal_percentage' defined in *.yaml */
+  uint16_t brake_percentage; /**< CAN signal 'brake_percentage' defined in *.yaml */
+  uint8_t state_data; /**< CAN signal 'state_data' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for battery_stats_B
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for drive_status
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      max_cell_voltage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      min_cell_voltage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      max_temperature = raw_val;
-    }
+  void decode(uint64_t data) {
+    pedal_percentage = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_PEDAL_PERCENTAGE));
+    brake_percentage = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_BRAKE_PERCENTAGE));
+    state_data = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_STATE_DATA));
   }
 
   /**
-   * @brief   Create a JSON object for battery_stats_B using the storage
+   * @brief   Create a JSON object for drive_status using the storage
    */
   nlohmann::json to_json() const {
-    return { { "max_cell_voltage", max_cell_voltage }, { "min_cell_voltage", min_cell_voltage }, { "max_temperature", max_temperature } };
-  }
-
-  /**
-   * @brief   Get the message name: battery_stats_B
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "battery_stats_B";
+    return {
+      {"pedal_percentage", pedal_percentage},
+      {"brake_percentage", brake_percentage},
+      {"state_data", state_data}
+    };
   }
 };
+
+drive_status s_drive_status; /**< Decode storage for drive_status */
 /**
- * @brief   Storage class for power_input_stats CAN message
+ * @brief   Storage class for fc_power_group_a CAN message
  */
-struct power_input_stats {
-  uint16_t input_dcdc_voltage; /**< CAN signal 'input_dcdc_voltage' defined in *.yaml */
-  uint16_t input_dcdc_current; /**< CAN signal 'input_dcdc_current' defined in *.yaml */
-  uint16_t input_aux_voltage;  /**< CAN signal 'input_aux_voltage' defined in *.yaml */
-  uint16_t input_aux_current;  /**< CAN signal 'input_aux_current' defined in *.yaml */
+struct fc_power_group_a {
+  uint16_t rev_cam_current; /**< CAN signal 'rev_cam_current' defined in *.yaml */
+  uint16_t telem_current; /**< CAN signal 'telem_current' defined in *.yaml */
+  uint16_t steering_current; /**< CAN signal 'steering_current' defined in *.yaml */
+  uint16_t driver_fan_current; /**< CAN signal 'driver_fan_current' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for power_input_stats
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for fc_power_group_A
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      input_dcdc_voltage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      input_dcdc_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      input_aux_voltage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 6;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      input_aux_current = raw_val;
-    }
+  void decode(uint64_t data) {
+    rev_cam_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_REV_CAM_CURRENT));
+    telem_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_TELEM_CURRENT));
+    steering_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_STEERING_CURRENT));
+    driver_fan_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_DRIVER_FAN_CURRENT));
   }
 
   /**
-   * @brief   Create a JSON object for power_input_stats using the storage
+   * @brief   Create a JSON object for fc_power_group_A using the storage
    */
   nlohmann::json to_json() const {
-    return { { "input_dcdc_voltage", input_dcdc_voltage }, { "input_dcdc_current", input_dcdc_current }, { "input_aux_voltage", input_aux_voltage }, { "input_aux_current", input_aux_current } };
-  }
-
-  /**
-   * @brief   Get the message name: power_input_stats
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "power_input_stats";
+    return {
+      {"rev_cam_current", rev_cam_current},
+      {"telem_current", telem_current},
+      {"steering_current", steering_current},
+      {"driver_fan_current", driver_fan_current}
+    };
   }
 };
+
+fc_power_group_a s_fc_power_group_a; /**< Decode storage for fc_power_group_A */
 /**
- * @brief   Storage class for afe_discharge_bitset CAN message
+ * @brief   Storage class for fc_power_group_b CAN message
  */
-struct afe_discharge_bitset {
-  uint32_t AFE1; /**< CAN signal 'AFE1' defined in *.yaml */
-  uint32_t AFE2; /**< CAN signal 'AFE2' defined in *.yaml */
+struct fc_power_group_b {
+  uint16_t horn_current; /**< CAN signal 'horn_current' defined in *.yaml */
+  uint16_t spare_current; /**< CAN signal 'spare_current' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE_discharge_bitset
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for fc_power_group_B
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 2]) << 16U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 3]) << 24U;
-
-      AFE1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 2]) << 16U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 3]) << 24U;
-
-      AFE2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    horn_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_HORN_CURRENT));
+    spare_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_SPARE_CURRENT));
   }
 
   /**
-   * @brief   Create a JSON object for AFE_discharge_bitset using the storage
+   * @brief   Create a JSON object for fc_power_group_B using the storage
    */
   nlohmann::json to_json() const {
-    return { { "AFE1", AFE1 }, { "AFE2", AFE2 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE_discharge_bitset
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE_discharge_bitset";
+    return {
+      {"horn_current", horn_current},
+      {"spare_current", spare_current}
+    };
   }
 };
+
+fc_power_group_b s_fc_power_group_b; /**< Decode storage for fc_power_group_B */
 /**
- * @brief   Storage class for afe1_status_a CAN message
+ * @brief   Storage class for fc_power_lights_group CAN message
  */
-struct afe1_status_a {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_0; /**< CAN signal 'voltage_0' defined in *.yaml */
-  uint16_t voltage_1; /**< CAN signal 'voltage_1' defined in *.yaml */
-  uint16_t voltage_2; /**< CAN signal 'voltage_2' defined in *.yaml */
+struct fc_power_lights_group {
+  uint16_t brake_light_sig_current; /**< CAN signal 'brake_light_sig_current' defined in *.yaml */
+  uint16_t bps_light_sig_current; /**< CAN signal 'bps_light_sig_current' defined in *.yaml */
+  uint16_t right_sig_current; /**< CAN signal 'right_sig_current' defined in *.yaml */
+  uint16_t left_sig_current; /**< CAN signal 'left_sig_current' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_A
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for fc_power_lights_group
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_0 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    brake_light_sig_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BRAKE_LIGHT_SIG_CURRENT));
+    bps_light_sig_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BPS_LIGHT_SIG_CURRENT));
+    right_sig_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_RIGHT_SIG_CURRENT));
+    left_sig_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_LEFT_SIG_CURRENT));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_A using the storage
+   * @brief   Create a JSON object for fc_power_lights_group using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_0", voltage_0 }, { "voltage_1", voltage_1 }, { "voltage_2", voltage_2 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_A
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_A";
+    return {
+      {"brake_light_sig_current", brake_light_sig_current},
+      {"bps_light_sig_current", bps_light_sig_current},
+      {"right_sig_current", right_sig_current},
+      {"left_sig_current", left_sig_current}
+    };
   }
 };
+
+fc_power_lights_group s_fc_power_lights_group; /**< Decode storage for fc_power_lights_group */
 /**
- * @brief   Storage class for afe1_status_b CAN message
+ * @brief   Storage class for imu_data CAN message
  */
-struct afe1_status_b {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_3; /**< CAN signal 'voltage_3' defined in *.yaml */
-  uint16_t voltage_4; /**< CAN signal 'voltage_4' defined in *.yaml */
-  uint16_t voltage_5; /**< CAN signal 'voltage_5' defined in *.yaml */
+struct imu_data {
+  uint16_t g_force; /**< CAN signal 'g_force' defined in *.yaml */
+  uint16_t roll; /**< CAN signal 'roll' defined in *.yaml */
+  uint16_t pitch; /**< CAN signal 'pitch' defined in *.yaml */
+  uint16_t yaw; /**< CAN signal 'yaw' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_B
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for imu_data
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_3 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_4 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_5 = raw_val;
-    }
+  void decode(uint64_t data) {
+    g_force = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_G_FORCE));
+    roll = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_ROLL));
+    pitch = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_PITCH));
+    yaw = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_YAW));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_B using the storage
+   * @brief   Create a JSON object for imu_data using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_3", voltage_3 }, { "voltage_4", voltage_4 }, { "voltage_5", voltage_5 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_B
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_B";
+    return {
+      {"g_force", g_force},
+      {"roll", roll},
+      {"pitch", pitch},
+      {"yaw", yaw}
+    };
   }
 };
+
+imu_data s_imu_data; /**< Decode storage for imu_data */
 /**
- * @brief   Storage class for afe1_status_c CAN message
+ * @brief   Storage class for steering CAN message
  */
-struct afe1_status_c {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_6; /**< CAN signal 'voltage_6' defined in *.yaml */
-  uint16_t voltage_7; /**< CAN signal 'voltage_7' defined in *.yaml */
-  uint16_t voltage_8; /**< CAN signal 'voltage_8' defined in *.yaml */
+struct steering {
+  uint32_t cruise_control_target_velocity; /**< CAN signal 'cruise_control_target_velocity' defined in *.yaml */
+  uint8_t buttons; /**< CAN signal 'buttons' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_C
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for steering
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_6 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_7 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_8 = raw_val;
-    }
+  void decode(uint64_t data) {
+    cruise_control_target_velocity = static_cast<uint32_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_STEERING_STEERING_CRUISE_CONTROL_TARGET_VELOCITY));
+    buttons = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_STEERING_STEERING_BUTTONS));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_C using the storage
+   * @brief   Create a JSON object for steering using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_6", voltage_6 }, { "voltage_7", voltage_7 }, { "voltage_8", voltage_8 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_C
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_C";
+    return {
+      {"cruise_control_target_velocity", cruise_control_target_velocity},
+      {"buttons", buttons}
+    };
   }
 };
+
+steering s_steering; /**< Decode storage for steering */
 /**
- * @brief   Storage class for afe1_status_d CAN message
+ * @brief   Storage class for rear_controller_status CAN message
  */
-struct afe1_status_d {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_9;  /**< CAN signal 'voltage_9' defined in *.yaml */
-  uint16_t voltage_10; /**< CAN signal 'voltage_10' defined in *.yaml */
-  uint16_t voltage_11; /**< CAN signal 'voltage_11' defined in *.yaml */
+struct rear_controller_status {
+  uint32_t triggers; /**< CAN signal 'triggers' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_D
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for rear_controller_status
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_9 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_10 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_11 = raw_val;
-    }
+  void decode(uint64_t data) {
+    triggers = static_cast<uint32_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_TRIGGERS));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_D using the storage
+   * @brief   Create a JSON object for rear_controller_status using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_9", voltage_9 }, { "voltage_10", voltage_10 }, { "voltage_11", voltage_11 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_D
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_D";
+    return {
+      {"triggers", triggers}
+    };
   }
 };
+
+rear_controller_status s_rear_controller_status; /**< Decode storage for rear_controller_status */
 /**
- * @brief   Storage class for afe1_status_e CAN message
+ * @brief   Storage class for battery_stats_a CAN message
  */
-struct afe1_status_e {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_12; /**< CAN signal 'voltage_12' defined in *.yaml */
-  uint16_t voltage_13; /**< CAN signal 'voltage_13' defined in *.yaml */
-  uint16_t voltage_14; /**< CAN signal 'voltage_14' defined in *.yaml */
+struct battery_stats_a {
+  uint16_t pack_voltage; /**< CAN signal 'pack_voltage' defined in *.yaml */
+  uint16_t pack_current; /**< CAN signal 'pack_current' defined in *.yaml */
+  uint16_t pack_soc; /**< CAN signal 'pack_soc' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_E
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for battery_stats_A
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_12 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_13 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_14 = raw_val;
-    }
+  void decode(uint64_t data) {
+    pack_voltage = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_VOLTAGE));
+    pack_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_CURRENT));
+    pack_soc = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_SOC));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_E using the storage
+   * @brief   Create a JSON object for battery_stats_A using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_12", voltage_12 }, { "voltage_13", voltage_13 }, { "voltage_14", voltage_14 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_E
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_E";
+    return {
+      {"pack_voltage", pack_voltage},
+      {"pack_current", pack_current},
+      {"pack_soc", pack_soc}
+    };
   }
 };
+
+battery_stats_a s_battery_stats_a; /**< Decode storage for battery_stats_A */
 /**
- * @brief   Storage class for afe1_status_f CAN message
+ * @brief   Storage class for battery_stats_b CAN message
  */
-struct afe1_status_f {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_15; /**< CAN signal 'voltage_15' defined in *.yaml */
-  uint16_t voltage_16; /**< CAN signal 'voltage_16' defined in *.yaml */
-  uint16_t voltage_17; /**< CAN signal 'voltage_17' defined in *.yaml */
+struct battery_stats_b {
+  float max_cell_voltage; /**< CAN signal 'max_cell_voltage' defined in *.yaml */
+  float min_cell_voltage; /**< CAN signal 'min_cell_voltage' defined in *.yaml */
+  uint16_t max_temperature; /**< CAN signal 'max_temperature' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE1_status_F
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for battery_stats_B
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_15 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_16 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_17 = raw_val;
-    }
+  void decode(uint64_t data) {
+    max_cell_voltage = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE_OFFSET);
+    min_cell_voltage = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE_OFFSET);
+    max_temperature = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_TEMPERATURE));
   }
 
   /**
-   * @brief   Create a JSON object for AFE1_status_F using the storage
+   * @brief   Create a JSON object for battery_stats_B using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_15", voltage_15 }, { "voltage_16", voltage_16 }, { "voltage_17", voltage_17 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE1_status_F
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE1_status_F";
+    return {
+      {"max_cell_voltage", max_cell_voltage},
+      {"min_cell_voltage", min_cell_voltage},
+      {"max_temperature", max_temperature}
+    };
   }
 };
+
+battery_stats_b s_battery_stats_b; /**< Decode storage for battery_stats_B */
 /**
- * @brief   Storage class for afe2_status_a CAN message
+ * @brief   Storage class for power_input_stats CAN message
  */
-struct afe2_status_a {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_0; /**< CAN signal 'voltage_0' defined in *.yaml */
-  uint16_t voltage_1; /**< CAN signal 'voltage_1' defined in *.yaml */
-  uint16_t voltage_2; /**< CAN signal 'voltage_2' defined in *.yaml */
+struct power_input_stats {
+  uint16_t input_dcdc_voltage; /**< CAN signal 'input_dcdc_voltage' defined in *.yaml */
+  uint16_t input_dcdc_current; /**< CAN signal 'input_dcdc_current' defined in *.yaml */
+  uint16_t input_aux_voltage; /**< CAN signal 'input_aux_voltage' defined in *.yaml */
+  uint16_t input_aux_current; /**< CAN signal 'input_aux_current' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_A
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for power_input_stats
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_0 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    input_dcdc_voltage = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_VOLTAGE));
+    input_dcdc_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_CURRENT));
+    input_aux_voltage = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_VOLTAGE));
+    input_aux_current = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_CURRENT));
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_A using the storage
+   * @brief   Create a JSON object for power_input_stats using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_0", voltage_0 }, { "voltage_1", voltage_1 }, { "voltage_2", voltage_2 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_A
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_A";
+    return {
+      {"input_dcdc_voltage", input_dcdc_voltage},
+      {"input_dcdc_current", input_dcdc_current},
+      {"input_aux_voltage", input_aux_voltage},
+      {"input_aux_current", input_aux_current}
+    };
   }
 };
+
+power_input_stats s_power_input_stats; /**< Decode storage for power_input_stats */
 /**
- * @brief   Storage class for afe2_status_b CAN message
+ * @brief   Storage class for afe_discharge_bitset CAN message
  */
-struct afe2_status_b {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_3; /**< CAN signal 'voltage_3' defined in *.yaml */
-  uint16_t voltage_4; /**< CAN signal 'voltage_4' defined in *.yaml */
-  uint16_t voltage_5; /**< CAN signal 'voltage_5' defined in *.yaml */
+struct afe_discharge_bitset {
+  uint32_t AFE1; /**< CAN signal 'AFE1' defined in *.yaml */
+  uint32_t AFE2; /**< CAN signal 'AFE2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_B
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE_discharge_bitset
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_3 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_4 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_5 = raw_val;
-    }
+  void decode(uint64_t data) {
+    AFE1 = static_cast<uint32_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE1));
+    AFE2 = static_cast<uint32_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE2));
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_B using the storage
+   * @brief   Create a JSON object for AFE_discharge_bitset using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_3", voltage_3 }, { "voltage_4", voltage_4 }, { "voltage_5", voltage_5 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_B
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_B";
+    return {
+      {"AFE1", AFE1},
+      {"AFE2", AFE2}
+    };
   }
 };
+
+afe_discharge_bitset s_afe_discharge_bitset; /**< Decode storage for AFE_discharge_bitset */
 /**
- * @brief   Storage class for afe2_status_c CAN message
+ * @brief   Storage class for afe1_status_a CAN message
  */
-struct afe2_status_c {
-  uint8_t id;         /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_6; /**< CAN signal 'voltage_6' defined in *.yaml */
-  uint16_t voltage_7; /**< CAN signal 'voltage_7' defined in *.yaml */
-  uint16_t voltage_8; /**< CAN signal 'voltage_8' defined in *.yaml */
+struct afe1_status_a {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_0; /**< CAN signal 'voltage_0' defined in *.yaml */
+  float voltage_1; /**< CAN signal 'voltage_1' defined in *.yaml */
+  float voltage_2; /**< CAN signal 'voltage_2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_C
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_A
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_6 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_7 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_8 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_ID));
+    voltage_0 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0_OFFSET);
+    voltage_1 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1_OFFSET);
+    voltage_2 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_C using the storage
+   * @brief   Create a JSON object for AFE1_status_A using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_6", voltage_6 }, { "voltage_7", voltage_7 }, { "voltage_8", voltage_8 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_C
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_C";
+    return {
+      {"id", id},
+      {"voltage_0", voltage_0},
+      {"voltage_1", voltage_1},
+      {"voltage_2", voltage_2}
+    };
   }
 };
+
+afe1_status_a s_afe1_status_a; /**< Decode storage for AFE1_status_A */
 /**
- * @brief   Storage class for afe2_status_d CAN message
+ * @brief   Storage class for afe1_status_b CAN message
  */
-struct afe2_status_d {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_9;  /**< CAN signal 'voltage_9' defined in *.yaml */
-  uint16_t voltage_10; /**< CAN signal 'voltage_10' defined in *.yaml */
-  uint16_t voltage_11; /**< CAN signal 'voltage_11' defined in *.yaml */
+struct afe1_status_b {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_3; /**< CAN signal 'voltage_3' defined in *.yaml */
+  float voltage_4; /**< CAN signal 'voltage_4' defined in *.yaml */
+  float voltage_5; /**< CAN signal 'voltage_5' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_D
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_B
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_9 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_10 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_11 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_ID));
+    voltage_3 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3_OFFSET);
+    voltage_4 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4_OFFSET);
+    voltage_5 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_D using the storage
+   * @brief   Create a JSON object for AFE1_status_B using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_9", voltage_9 }, { "voltage_10", voltage_10 }, { "voltage_11", voltage_11 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_D
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_D";
+    return {
+      {"id", id},
+      {"voltage_3", voltage_3},
+      {"voltage_4", voltage_4},
+      {"voltage_5", voltage_5}
+    };
   }
 };
+
+afe1_status_b s_afe1_status_b; /**< Decode storage for AFE1_status_B */
 /**
- * @brief   Storage class for afe2_status_e CAN message
+ * @brief   Storage class for afe1_status_c CAN message
  */
-struct afe2_status_e {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_12; /**< CAN signal 'voltage_12' defined in *.yaml */
-  uint16_t voltage_13; /**< CAN signal 'voltage_13' defined in *.yaml */
-  uint16_t voltage_14; /**< CAN signal 'voltage_14' defined in *.yaml */
+struct afe1_status_c {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_6; /**< CAN signal 'voltage_6' defined in *.yaml */
+  float voltage_7; /**< CAN signal 'voltage_7' defined in *.yaml */
+  float voltage_8; /**< CAN signal 'voltage_8' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_E
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_C
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_12 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_13 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_14 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_ID));
+    voltage_6 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6_OFFSET);
+    voltage_7 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7_OFFSET);
+    voltage_8 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_E using the storage
+   * @brief   Create a JSON object for AFE1_status_C using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_12", voltage_12 }, { "voltage_13", voltage_13 }, { "voltage_14", voltage_14 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_E
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_E";
+    return {
+      {"id", id},
+      {"voltage_6", voltage_6},
+      {"voltage_7", voltage_7},
+      {"voltage_8", voltage_8}
+    };
   }
 };
+
+afe1_status_c s_afe1_status_c; /**< Decode storage for AFE1_status_C */
 /**
- * @brief   Storage class for afe2_status_f CAN message
+ * @brief   Storage class for afe1_status_d CAN message
  */
-struct afe2_status_f {
-  uint8_t id;          /**< CAN signal 'id' defined in *.yaml */
-  uint16_t voltage_15; /**< CAN signal 'voltage_15' defined in *.yaml */
-  uint16_t voltage_16; /**< CAN signal 'voltage_16' defined in *.yaml */
-  uint16_t voltage_17; /**< CAN signal 'voltage_17' defined in *.yaml */
+struct afe1_status_d {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_9; /**< CAN signal 'voltage_9' defined in *.yaml */
+  float voltage_10; /**< CAN signal 'voltage_10' defined in *.yaml */
+  float voltage_11; /**< CAN signal 'voltage_11' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE2_status_F
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_D
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_15 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_16 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      voltage_17 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_ID));
+    voltage_9 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9_OFFSET);
+    voltage_10 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10_OFFSET);
+    voltage_11 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for AFE2_status_F using the storage
+   * @brief   Create a JSON object for AFE1_status_D using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id }, { "voltage_15", voltage_15 }, { "voltage_16", voltage_16 }, { "voltage_17", voltage_17 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE2_status_F
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE2_status_F";
+    return {
+      {"id", id},
+      {"voltage_9", voltage_9},
+      {"voltage_10", voltage_10},
+      {"voltage_11", voltage_11}
+    };
   }
 };
+
+afe1_status_d s_afe1_status_d; /**< Decode storage for AFE1_status_D */
 /**
- * @brief   Storage class for afe_temperature CAN message
+ * @brief   Storage class for afe1_status_e CAN message
  */
-struct afe_temperature {
-  uint8_t id;            /**< CAN signal 'id' defined in *.yaml */
-  uint8_t temperature_0; /**< CAN signal 'temperature_0' defined in *.yaml */
-  uint8_t temperature_1; /**< CAN signal 'temperature_1' defined in *.yaml */
-  uint8_t temperature_2; /**< CAN signal 'temperature_2' defined in *.yaml */
-  uint8_t temperature_3; /**< CAN signal 'temperature_3' defined in *.yaml */
-  uint8_t temperature_4; /**< CAN signal 'temperature_4' defined in *.yaml */
-  uint8_t temperature_5; /**< CAN signal 'temperature_5' defined in *.yaml */
-  uint8_t temperature_6; /**< CAN signal 'temperature_6' defined in *.yaml */
+struct afe1_status_e {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_12; /**< CAN signal 'voltage_12' defined in *.yaml */
+  float voltage_13; /**< CAN signal 'voltage_13' defined in *.yaml */
+  float voltage_14; /**< CAN signal 'voltage_14' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for AFE_temperature
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_E
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      id = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 1;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_0 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 3;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_2 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_3 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 5;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_4 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 6;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_5 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 7;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      temperature_6 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_ID));
+    voltage_12 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12_OFFSET);
+    voltage_13 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13_OFFSET);
+    voltage_14 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for AFE_temperature using the storage
+   * @brief   Create a JSON object for AFE1_status_E using the storage
    */
   nlohmann::json to_json() const {
-    return { { "id", id },
-             { "temperature_0", temperature_0 },
-             { "temperature_1", temperature_1 },
-             { "temperature_2", temperature_2 },
-             { "temperature_3", temperature_3 },
-             { "temperature_4", temperature_4 },
-             { "temperature_5", temperature_5 },
-             { "temperature_6", temperature_6 } };
-  }
-
-  /**
-   * @brief   Get the message name: AFE_temperature
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "AFE_temperature";
+    return {
+      {"id", id},
+      {"voltage_12", voltage_12},
+      {"voltage_13", voltage_13},
+      {"voltage_14", voltage_14}
+    };
   }
 };
+
+afe1_status_e s_afe1_status_e; /**< Decode storage for AFE1_status_E */
 /**
- * @brief   Storage class for fast_one_shot_msg CAN message
+ * @brief   Storage class for afe1_status_f CAN message
  */
-struct fast_one_shot_msg {
-  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
-  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
+struct afe1_status_f {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_15; /**< CAN signal 'voltage_15' defined in *.yaml */
+  float voltage_16; /**< CAN signal 'voltage_16' defined in *.yaml */
+  float voltage_17; /**< CAN signal 'voltage_17' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for fast_one_shot_msg
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE1_status_F
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_ID));
+    voltage_15 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15_OFFSET);
+    voltage_16 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16_OFFSET);
+    voltage_17 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for fast_one_shot_msg using the storage
+   * @brief   Create a JSON object for AFE1_status_F using the storage
    */
   nlohmann::json to_json() const {
-    return { { "sig1", sig1 }, { "sig2", sig2 } };
-  }
-
-  /**
-   * @brief   Get the message name: fast_one_shot_msg
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "fast_one_shot_msg";
+    return {
+      {"id", id},
+      {"voltage_15", voltage_15},
+      {"voltage_16", voltage_16},
+      {"voltage_17", voltage_17}
+    };
   }
 };
+
+afe1_status_f s_afe1_status_f; /**< Decode storage for AFE1_status_F */
 /**
- * @brief   Storage class for medium_one_shot_msg CAN message
+ * @brief   Storage class for afe2_status_a CAN message
  */
-struct medium_one_shot_msg {
-  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
-  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
+struct afe2_status_a {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_0; /**< CAN signal 'voltage_0' defined in *.yaml */
+  float voltage_1; /**< CAN signal 'voltage_1' defined in *.yaml */
+  float voltage_2; /**< CAN signal 'voltage_2' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for medium_one_shot_msg
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_A
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_ID));
+    voltage_0 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0_OFFSET);
+    voltage_1 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1_OFFSET);
+    voltage_2 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for medium_one_shot_msg using the storage
+   * @brief   Create a JSON object for AFE2_status_A using the storage
    */
   nlohmann::json to_json() const {
-    return { { "sig1", sig1 }, { "sig2", sig2 } };
-  }
-
-  /**
-   * @brief   Get the message name: medium_one_shot_msg
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "medium_one_shot_msg";
+    return {
+      {"id", id},
+      {"voltage_0", voltage_0},
+      {"voltage_1", voltage_1},
+      {"voltage_2", voltage_2}
+    };
   }
 };
+
+afe2_status_a s_afe2_status_a; /**< Decode storage for AFE2_status_A */
 /**
- * @brief   Storage class for slow_one_shot_msg CAN message
+ * @brief   Storage class for afe2_status_b CAN message
  */
-struct slow_one_shot_msg {
-  uint16_t sig1; /**< CAN signal 'sig1' defined in *.yaml */
-  uint16_t sig2; /**< CAN signal 'sig2' defined in *.yaml */
+struct afe2_status_b {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_3; /**< CAN signal 'voltage_3' defined in *.yaml */
+  float voltage_4; /**< CAN signal 'voltage_4' defined in *.yaml */
+  float voltage_5; /**< CAN signal 'voltage_5' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for slow_one_shot_msg
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_B
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig1 = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      sig2 = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_ID));
+    voltage_3 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3_OFFSET);
+    voltage_4 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4_OFFSET);
+    voltage_5 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for slow_one_shot_msg using the storage
+   * @brief   Create a JSON object for AFE2_status_B using the storage
    */
   nlohmann::json to_json() const {
-    return { { "sig1", sig1 }, { "sig2", sig2 } };
-  }
-
-  /**
-   * @brief   Get the message name: slow_one_shot_msg
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "slow_one_shot_msg";
+    return {
+      {"id", id},
+      {"voltage_3", voltage_3},
+      {"voltage_4", voltage_4},
+      {"voltage_5", voltage_5}
+    };
   }
 };
+
+afe2_status_b s_afe2_status_b; /**< Decode storage for AFE2_status_B */
 /**
- * @brief   Storage class for gyro_data CAN message
+ * @brief   Storage class for afe2_status_c CAN message
  */
-struct gyro_data {
-  uint16_t x_axis; /**< CAN signal 'x_axis' defined in *.yaml */
-  uint16_t y_axis; /**< CAN signal 'y_axis' defined in *.yaml */
-  uint16_t z_axis; /**< CAN signal 'z_axis' defined in *.yaml */
+struct afe2_status_c {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_6; /**< CAN signal 'voltage_6' defined in *.yaml */
+  float voltage_7; /**< CAN signal 'voltage_7' defined in *.yaml */
+  float voltage_8; /**< CAN signal 'voltage_8' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for gyro_data
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_C
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      x_axis = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      y_axis = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      z_axis = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_ID));
+    voltage_6 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6_OFFSET);
+    voltage_7 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7_OFFSET);
+    voltage_8 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for gyro_data using the storage
+   * @brief   Create a JSON object for AFE2_status_C using the storage
    */
   nlohmann::json to_json() const {
-    return { { "x_axis", x_axis }, { "y_axis", y_axis }, { "z_axis", z_axis } };
-  }
-
-  /**
-   * @brief   Get the message name: gyro_data
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "gyro_data";
+    return {
+      {"id", id},
+      {"voltage_6", voltage_6},
+      {"voltage_7", voltage_7},
+      {"voltage_8", voltage_8}
+    };
   }
 };
+
+afe2_status_c s_afe2_status_c; /**< Decode storage for AFE2_status_C */
 /**
- * @brief   Storage class for accel_data CAN message
+ * @brief   Storage class for afe2_status_d CAN message
  */
-struct accel_data {
-  uint16_t x_axis; /**< CAN signal 'x_axis' defined in *.yaml */
-  uint16_t y_axis; /**< CAN signal 'y_axis' defined in *.yaml */
-  uint16_t z_axis; /**< CAN signal 'z_axis' defined in *.yaml */
+struct afe2_status_d {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_9; /**< CAN signal 'voltage_9' defined in *.yaml */
+  float voltage_10; /**< CAN signal 'voltage_10' defined in *.yaml */
+  float voltage_11; /**< CAN signal 'voltage_11' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for accel_data
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_D
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      x_axis = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      y_axis = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      z_axis = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_ID));
+    voltage_9 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9_OFFSET);
+    voltage_10 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10_OFFSET);
+    voltage_11 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for accel_data using the storage
+   * @brief   Create a JSON object for AFE2_status_D using the storage
    */
   nlohmann::json to_json() const {
-    return { { "x_axis", x_axis }, { "y_axis", y_axis }, { "z_axis", z_axis } };
-  }
-
-  /**
-   * @brief   Get the message name: accel_data
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "accel_data";
+    return {
+      {"id", id},
+      {"voltage_9", voltage_9},
+      {"voltage_10", voltage_10},
+      {"voltage_11", voltage_11}
+    };
   }
 };
+
+afe2_status_d s_afe2_status_d; /**< Decode storage for AFE2_status_D */
 /**
- * @brief   Storage class for imu_data CAN message
+ * @brief   Storage class for afe2_status_e CAN message
  */
-struct imu_data {
-  uint16_t g_force; /**< CAN signal 'g_force' defined in *.yaml */
-  uint16_t roll;    /**< CAN signal 'roll' defined in *.yaml */
-  uint16_t pitch;   /**< CAN signal 'pitch' defined in *.yaml */
-  uint16_t yaw;     /**< CAN signal 'yaw' defined in *.yaml */
+struct afe2_status_e {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_12; /**< CAN signal 'voltage_12' defined in *.yaml */
+  float voltage_13; /**< CAN signal 'voltage_13' defined in *.yaml */
+  float voltage_14; /**< CAN signal 'voltage_14' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for imu_data
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_E
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      g_force = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      roll = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      pitch = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 6;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      yaw = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_ID));
+    voltage_12 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12_OFFSET);
+    voltage_13 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13_OFFSET);
+    voltage_14 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for imu_data using the storage
+   * @brief   Create a JSON object for AFE2_status_E using the storage
    */
   nlohmann::json to_json() const {
-    return { { "g_force", g_force }, { "roll", roll }, { "pitch", pitch }, { "yaw", yaw } };
-  }
-
-  /**
-   * @brief   Get the message name: imu_data
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "imu_data";
+    return {
+      {"id", id},
+      {"voltage_12", voltage_12},
+      {"voltage_13", voltage_13},
+      {"voltage_14", voltage_14}
+    };
   }
 };
+
+afe2_status_e s_afe2_status_e; /**< Decode storage for AFE2_status_E */
 /**
- * @brief   Storage class for drive_status CAN message
+ * @brief   Storage class for afe2_status_f CAN message
  */
-struct drive_status {
-  uint16_t pedal_percentage; /**< CAN signal 'pedal_percentage' defined in *.yaml */
-  uint16_t brake_percentage; /**< CAN signal 'brake_percentage' defined in *.yaml */
-  uint8_t state_data;        /**< CAN signal 'state_data' defined in *.yaml */
+struct afe2_status_f {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  float voltage_15; /**< CAN signal 'voltage_15' defined in *.yaml */
+  float voltage_16; /**< CAN signal 'voltage_16' defined in *.yaml */
+  float voltage_17; /**< CAN signal 'voltage_17' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for drive_status
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE2_status_F
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      pedal_percentage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      brake_percentage = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-
-      state_data = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_ID));
+    voltage_15 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15_OFFSET);
+    voltage_16 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16_OFFSET);
+    voltage_17 = system_can_signal_to_float(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17_SCALE, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17_OFFSET);
   }
 
   /**
-   * @brief   Create a JSON object for drive_status using the storage
+   * @brief   Create a JSON object for AFE2_status_F using the storage
    */
   nlohmann::json to_json() const {
-    return { { "pedal_percentage", pedal_percentage }, { "brake_percentage", brake_percentage }, { "state_data", state_data } };
-  }
-
-  /**
-   * @brief   Get the message name: drive_status
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "drive_status";
+    return {
+      {"id", id},
+      {"voltage_15", voltage_15},
+      {"voltage_16", voltage_16},
+      {"voltage_17", voltage_17}
+    };
   }
 };
+
+afe2_status_f s_afe2_status_f; /**< Decode storage for AFE2_status_F */
 /**
- * @brief   Storage class for fc_power_group_a CAN message
+ * @brief   Storage class for afe_temperature CAN message
  */
-struct fc_power_group_a {
-  uint16_t rev_cam_current;    /**< CAN signal 'rev_cam_current' defined in *.yaml */
-  uint16_t telem_current;      /**< CAN signal 'telem_current' defined in *.yaml */
-  uint16_t steering_current;   /**< CAN signal 'steering_current' defined in *.yaml */
-  uint16_t driver_fan_current; /**< CAN signal 'driver_fan_current' defined in *.yaml */
+struct afe_temperature {
+  uint8_t id; /**< CAN signal 'id' defined in *.yaml */
+  uint8_t temperature_0; /**< CAN signal 'temperature_0' defined in *.yaml */
+  uint8_t temperature_1; /**< CAN signal 'temperature_1' defined in *.yaml */
+  uint8_t temperature_2; /**< CAN signal 'temperature_2' defined in *.yaml */
+  uint8_t temperature_3; /**< CAN signal 'temperature_3' defined in *.yaml */
+  uint8_t temperature_4; /**< CAN signal 'temperature_4' defined in *.yaml */
+  uint8_t temperature_5; /**< CAN signal 'temperature_5' defined in *.yaml */
+  uint8_t temperature_6; /**< CAN signal 'temperature_6' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for fc_power_group_A
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for AFE_temperature
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      rev_cam_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      telem_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      steering_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 6;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      driver_fan_current = raw_val;
-    }
+  void decode(uint64_t data) {
+    id = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_ID));
+    temperature_0 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_0));
+    temperature_1 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_1));
+    temperature_2 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_2));
+    temperature_3 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_3));
+    temperature_4 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_4));
+    temperature_5 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_5));
+    temperature_6 = static_cast<uint8_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_6));
   }
 
   /**
-   * @brief   Create a JSON object for fc_power_group_A using the storage
+   * @brief   Create a JSON object for AFE_temperature using the storage
    */
   nlohmann::json to_json() const {
-    return { { "rev_cam_current", rev_cam_current }, { "telem_current", telem_current }, { "steering_current", steering_current }, { "driver_fan_current", driver_fan_current } };
-  }
-
-  /**
-   * @brief   Get the message name: fc_power_group_A
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "fc_power_group_A";
+    return {
+      {"id", id},
+      {"temperature_0", temperature_0},
+      {"temperature_1", temperature_1},
+      {"temperature_2", temperature_2},
+      {"temperature_3", temperature_3},
+      {"temperature_4", temperature_4},
+      {"temperature_5", temperature_5},
+      {"temperature_6", temperature_6}
+    };
   }
 };
+
+afe_temperature s_afe_temperature; /**< Decode storage for AFE_temperature */
 /**
- * @brief   Storage class for fc_power_group_b CAN message
+ * @brief   Storage class for gyro_data CAN message
  */
-struct fc_power_group_b {
-  uint16_t horn_current;  /**< CAN signal 'horn_current' defined in *.yaml */
-  uint16_t spare_current; /**< CAN signal 'spare_current' defined in *.yaml */
+struct gyro_data {
+  uint16_t x_axis; /**< CAN signal 'x_axis' defined in *.yaml */
+  uint16_t y_axis; /**< CAN signal 'y_axis' defined in *.yaml */
+  uint16_t z_axis; /**< CAN signal 'z_axis' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for fc_power_group_B
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for gyro_data
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      horn_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      spare_current = raw_val;
-    }
+  void decode(uint64_t data) {
+    x_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_X_AXIS));
+    y_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Y_AXIS));
+    z_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Z_AXIS));
   }
 
   /**
-   * @brief   Create a JSON object for fc_power_group_B using the storage
+   * @brief   Create a JSON object for gyro_data using the storage
    */
   nlohmann::json to_json() const {
-    return { { "horn_current", horn_current }, { "spare_current", spare_current } };
-  }
-
-  /**
-   * @brief   Get the message name: fc_power_group_B
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "fc_power_group_B";
+    return {
+      {"x_axis", x_axis},
+      {"y_axis", y_axis},
+      {"z_axis", z_axis}
+    };
   }
 };
+
+gyro_data s_gyro_data; /**< Decode storage for gyro_data */
 /**
- * @brief   Storage class for fc_power_lights_group CAN message
+ * @brief   Storage class for accel_data CAN message
  */
-struct fc_power_lights_group {
-  uint16_t brake_light_sig_current; /**< CAN signal 'brake_light_sig_current' defined in *.yaml */
-  uint16_t bps_light_sig_current;   /**< CAN signal 'bps_light_sig_current' defined in *.yaml */
-  uint16_t right_sig_current;       /**< CAN signal 'right_sig_current' defined in *.yaml */
-  uint16_t left_sig_current;        /**< CAN signal 'left_sig_current' defined in *.yaml */
+struct accel_data {
+  uint16_t x_axis; /**< CAN signal 'x_axis' defined in *.yaml */
+  uint16_t y_axis; /**< CAN signal 'y_axis' defined in *.yaml */
+  uint16_t z_axis; /**< CAN signal 'z_axis' defined in *.yaml */
 
   /**
-   * @brief   Decode new CAN data and update the storage for fc_power_lights_group
-   * @param   data Pointer to the CAN message to be decoded
+   * @brief   Decode new CAN data and update the storage for accel_data
+   * @param   data 64-bit little-endian CAN message data
    */
-  void decode(const uint8_t *data) {
-    uint64_t raw_val = 0U;
-    uint8_t start_byte = 0U;
-    {
-      raw_val = 0U;
-      start_byte = 0;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      brake_light_sig_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 2;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      bps_light_sig_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 4;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      right_sig_current = raw_val;
-    }
-    {
-      raw_val = 0U;
-      start_byte = 6;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 0]) << 0U;
-      raw_val |= static_cast<uint64_t>(data[start_byte + 1]) << 8U;
-
-      left_sig_current = raw_val;
-    }
+  void decode(uint64_t data) {
+    x_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_X_AXIS));
+    y_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Y_AXIS));
+    z_axis = static_cast<uint16_t>(SYSTEM_CAN_SIGNAL_EXTRACT(data, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Z_AXIS));
   }
 
   /**
-   * @brief   Create a JSON object for fc_power_lights_group using the storage
+   * @brief   Create a JSON object for accel_data using the storage
    */
   nlohmann::json to_json() const {
     return {
-      { "brake_light_sig_current", brake_light_sig_current }, { "bps_light_sig_current", bps_light_sig_current }, { "right_sig_current", right_sig_current }, { "left_sig_current", left_sig_current }
+      {"x_axis", x_axis},
+      {"y_axis", y_axis},
+      {"z_axis", z_axis}
     };
   }
+};
 
-  /**
-   * @brief   Get the message name: fc_power_lights_group
-   * @return  Returns the message name
-   */
-  std::string get_message_name() const {
-    return "fc_power_lights_group";
-  }
+accel_data s_accel_data; /**< Decode storage for accel_data */
+
+/**
+ * @brief   CAN message table entry
+ */
+struct CanMessageEntry {
+  uint32_t id;                   /**< CAN message ID */
+  const char *name;              /**< CAN message name, used as the JSON key */
+  void (*decode)(uint64_t);      /**< Decode CAN data into the static message storage */
+  nlohmann::json (*to_json)();   /**< Create a JSON object from the static message storage */
+  uint64_t timestampNs;          /**< Receive timestamp of the latest frame in nanoseconds */
+  bool dirty;                    /**< Message was received since the last JSON update */
+};
+
+/** @brief  Table of every CAN message, decoded in place into the static message storage */
+CanMessageEntry s_canMessageTable[NUM_CAN_MESSAGES] = {
+  { SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG, "fast_one_shot_msg", [](uint64_t data) { s_fast_one_shot_msg.decode(data); }, []() { return s_fast_one_shot_msg.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG, "medium_one_shot_msg", [](uint64_t data) { s_medium_one_shot_msg.decode(data); }, []() { return s_medium_one_shot_msg.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG, "slow_one_shot_msg", [](uint64_t data) { s_slow_one_shot_msg.decode(data); }, []() { return s_slow_one_shot_msg.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS, "drive_status", [](uint64_t data) { s_drive_status.decode(data); }, []() { return s_drive_status.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A, "fc_power_group_A", [](uint64_t data) { s_fc_power_group_a.decode(data); }, []() { return s_fc_power_group_a.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B, "fc_power_group_B", [](uint64_t data) { s_fc_power_group_b.decode(data); }, []() { return s_fc_power_group_b.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP, "fc_power_lights_group", [](uint64_t data) { s_fc_power_lights_group.decode(data); }, []() { return s_fc_power_lights_group.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA, "imu_data", [](uint64_t data) { s_imu_data.decode(data); }, []() { return s_imu_data.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_STEERING_STEERING, "steering", [](uint64_t data) { s_steering.decode(data); }, []() { return s_steering.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS, "rear_controller_status", [](uint64_t data) { s_rear_controller_status.decode(data); }, []() { return s_rear_controller_status.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A, "battery_stats_A", [](uint64_t data) { s_battery_stats_a.decode(data); }, []() { return s_battery_stats_a.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B, "battery_stats_B", [](uint64_t data) { s_battery_stats_b.decode(data); }, []() { return s_battery_stats_b.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS, "power_input_stats", [](uint64_t data) { s_power_input_stats.decode(data); }, []() { return s_power_input_stats.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET, "AFE_discharge_bitset", [](uint64_t data) { s_afe_discharge_bitset.decode(data); }, []() { return s_afe_discharge_bitset.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A, "AFE1_status_A", [](uint64_t data) { s_afe1_status_a.decode(data); }, []() { return s_afe1_status_a.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B, "AFE1_status_B", [](uint64_t data) { s_afe1_status_b.decode(data); }, []() { return s_afe1_status_b.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C, "AFE1_status_C", [](uint64_t data) { s_afe1_status_c.decode(data); }, []() { return s_afe1_status_c.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D, "AFE1_status_D", [](uint64_t data) { s_afe1_status_d.decode(data); }, []() { return s_afe1_status_d.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E, "AFE1_status_E", [](uint64_t data) { s_afe1_status_e.decode(data); }, []() { return s_afe1_status_e.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F, "AFE1_status_F", [](uint64_t data) { s_afe1_status_f.decode(data); }, []() { return s_afe1_status_f.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A, "AFE2_status_A", [](uint64_t data) { s_afe2_status_a.decode(data); }, []() { return s_afe2_status_a.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B, "AFE2_status_B", [](uint64_t data) { s_afe2_status_b.decode(data); }, []() { return s_afe2_status_b.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C, "AFE2_status_C", [](uint64_t data) { s_afe2_status_c.decode(data); }, []() { return s_afe2_status_c.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D, "AFE2_status_D", [](uint64_t data) { s_afe2_status_d.decode(data); }, []() { return s_afe2_status_d.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E, "AFE2_status_E", [](uint64_t data) { s_afe2_status_e.decode(data); }, []() { return s_afe2_status_e.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F, "AFE2_status_F", [](uint64_t data) { s_afe2_status_f.decode(data); }, []() { return s_afe2_status_f.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE, "AFE_temperature", [](uint64_t data) { s_afe_temperature.decode(data); }, []() { return s_afe_temperature.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA, "gyro_data", [](uint64_t data) { s_gyro_data.decode(data); }, []() { return s_gyro_data.to_json(); }, 0U, false },
+  { SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA, "accel_data", [](uint64_t data) { s_accel_data.decode(data); }, []() { return s_accel_data.to_json(); }, 0U, false },
 };
 
+/**
+ * @brief   Build the lookup table from CAN ID to CAN message table index
+ * @return  Lookup table with CAN_MESSAGE_INDEX_NONE for unknown IDs
+ */
+constexpr std::array<uint16_t, CAN_MESSAGE_LOOKUP_SIZE> buildCanMessageLookup() {
+  constexpr uint32_t ids[NUM_CAN_MESSAGES] = {
+    SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG,
+    SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG,
+    SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG,
+    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS,
+    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A,
+    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B,
+    SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP,
+    SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA,
+    SYSTEM_CAN_MESSAGE_STEERING_STEERING,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F,
+    SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE,
+    SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA,
+    SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA,
+  };
+
+  std::array<uint16_t, CAN_MESSAGE_LOOKUP_SIZE> lookup{};
+  for (size_t i = 0U; i < CAN_MESSAGE_LOOKUP_SIZE; i++) {
+    lookup[i] = CAN_MESSAGE_INDEX_NONE;
+  }
+  for (size_t i = 0U; i < NUM_CAN_MESSAGES; i++) {
+    lookup[ids[i]] = static_cast<uint16_t>(i);
+  }
+  return lookup;
+}
+
+/** @brief  Lookup table from CAN ID to CAN message table index */
+constexpr std::array<uint16_t, CAN_MESSAGE_LOOKUP_SIZE> s_canMessageLookup = buildCanMessageLookup();
+
+}  // namespace
+
 /**
  * @brief   Main CAN message Handler
- * @details This function shall dynamically allocate a struct based on the CAN ID
- *          This function shall decode the data, then update the CAN Cache 'm_canInfo' with JSON data
+ * @details This function shall look up the CAN message table entry by CAN ID
+ *          This function shall load the data once and extract every signal with the shared
+ *          system_can.h signal layer, then mark the message as dirty
+ *          No memory is allocated, the JSON data is only created by updateCanInfo()
  * @param   id Can message ID
- * @param   data Pointer to the CAN message data
+ * @param   data Pointer to the 8-byte CAN message data
+ * @param   timestampNs Receive timestamp of the CAN frame in nanoseconds
  */
-void CanListener::canMessageHandler(uint32_t id, const uint8_t *data) {
-  switch (id) {
-    case SYSTEM_CAN_MESSAGE_STEERING_STEERING: {
-      steering *message = new steering();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS: {
-      rear_controller_status *message = new rear_controller_status();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A: {
-      battery_stats_a *message = new battery_stats_a();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B: {
-      battery_stats_b *message = new battery_stats_b();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS: {
-      power_input_stats *message = new power_input_stats();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET: {
-      afe_discharge_bitset *message = new afe_discharge_bitset();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A: {
-      afe1_status_a *message = new afe1_status_a();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B: {
-      afe1_status_b *message = new afe1_status_b();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C: {
-      afe1_status_c *message = new afe1_status_c();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D: {
-      afe1_status_d *message = new afe1_status_d();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E: {
-      afe1_status_e *message = new afe1_status_e();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F: {
-      afe1_status_f *message = new afe1_status_f();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A: {
-      afe2_status_a *message = new afe2_status_a();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B: {
-      afe2_status_b *message = new afe2_status_b();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C: {
-      afe2_status_c *message = new afe2_status_c();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D: {
-      afe2_status_d *message = new afe2_status_d();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E: {
-      afe2_status_e *message = new afe2_status_e();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F: {
-      afe2_status_f *message = new afe2_status_f();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE: {
-      afe_temperature *message = new afe_temperature();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG: {
-      fast_one_shot_msg *message = new fast_one_shot_msg();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG: {
-      medium_one_shot_msg *message = new medium_one_shot_msg();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG: {
-      slow_one_shot_msg *message = new slow_one_shot_msg();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA: {
-      gyro_data *message = new gyro_data();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA: {
-      accel_data *message = new accel_data();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA: {
-      imu_data *message = new imu_data();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS: {
-      drive_status *message = new drive_status();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A: {
-      fc_power_group_a *message = new fc_power_group_a();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B: {
-      fc_power_group_b *message = new fc_power_group_b();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    case SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP: {
-      fc_power_lights_group *message = new fc_power_lights_group();
-      message->decode(data);
-      m_canInfo[message->get_message_name()] = message->to_json();
-      break;
-    }
-    default: {
-      std::cout << "Unknown message ID: " << static_cast<int>(id) << std::endl;
-    }
+void CanListener::canMessageHandler(uint32_t id, const uint8_t *data, uint64_t timestampNs) {
+  uint16_t index = (id < CAN_MESSAGE_LOOKUP_SIZE) ? s_canMessageLookup[id] : CAN_MESSAGE_INDEX_NONE;
+
+  if (index == CAN_MESSAGE_INDEX_NONE) {
+    std::cout << "Unknown message ID: " << static_cast<int>(id) << std::endl;
+    return;
   }
+
+  uint64_t payload = 0U;
+  std::memcpy(&payload, data, sizeof(payload));
+
+  CanMessageEntry &entry = s_canMessageTable[index];
+  entry.decode(payload);
+  entry.timestampNs = timestampNs;
+  entry.dirty = true;
 }
+
+/**
+ * @brief   Update the CAN Cache 'm_canInfo' and 'm_canTimestamps' with the latest data
+ * @details Only messages that were received since the last update are converted to JSON
+ */
+void CanListener::updateCanInfo() {
+  for (CanMessageEntry &entry : s_canMessageTable) {
+    if (entry.dirty) {
+      m_canInfo[entry.name] = entry.to_json();
+      m_canTimestamps[entry.name] = entry.timestampNs;
+      entry.dirty = false;
+    }
+  }
+}
\ No newline at end of file
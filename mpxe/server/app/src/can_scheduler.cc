@@ -3,7 +3,7 @@
  *
  * @brief  Source file defining the CanScheduler class
  *
- * @date   2026-06-14
+ * @date   2026-10-17
  * @author Aryan Kashem
  ************************************************************************************************/
 
@@ -12,8 +12,12 @@
 /* Standard library Headers */
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <vector>
 
 /* Inter-component Headers */
+#include <sys/uio.h>
+
 #include "system_can.h"
 
 /* Intra-component Headers */
@@ -22,142 +26,289 @@
 CanScheduler::CanScheduler() {
   m_isConnected = false;
   m_bcmCanSocket = -1;
+  m_batchDepth = 0U;
+
+  pthread_mutexattr_t mutexAttributes;
+  pthread_mutexattr_init(&mutexAttributes);
+  pthread_mutexattr_settype(&mutexAttributes, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&m_mutex, &mutexAttributes);
+  pthread_mutexattr_destroy(&mutexAttributes);
+
+  registerMessage(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG, 4U, CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG, 4U, CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG, 4U, CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS, 5U, FRONT_CONTROLLER_DRIVE_STATUS_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A, 8U, FRONT_CONTROLLER_FC_POWER_GROUP_A_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B, 4U, FRONT_CONTROLLER_FC_POWER_GROUP_B_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP, 8U, FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA, 8U, TELEMETRY_IMU_DATA_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_STEERING_STEERING, 5U, STEERING_STEERING_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS, 4U, REAR_CONTROLLER_REAR_CONTROLLER_STATUS_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A, 6U, REAR_CONTROLLER_BATTERY_STATS_A_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B, 4U, REAR_CONTROLLER_BATTERY_STATS_B_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS, 8U, REAR_CONTROLLER_POWER_INPUT_STATS_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET, 8U, REAR_CONTROLLER_AFE_DISCHARGE_BITSET_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A, 4U, REAR_CONTROLLER_AFE1_STATUS_A_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B, 4U, REAR_CONTROLLER_AFE1_STATUS_B_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C, 4U, REAR_CONTROLLER_AFE1_STATUS_C_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D, 4U, REAR_CONTROLLER_AFE1_STATUS_D_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E, 4U, REAR_CONTROLLER_AFE1_STATUS_E_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F, 4U, REAR_CONTROLLER_AFE1_STATUS_F_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A, 4U, REAR_CONTROLLER_AFE2_STATUS_A_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B, 4U, REAR_CONTROLLER_AFE2_STATUS_B_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C, 4U, REAR_CONTROLLER_AFE2_STATUS_C_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D, 4U, REAR_CONTROLLER_AFE2_STATUS_D_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E, 4U, REAR_CONTROLLER_AFE2_STATUS_E_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F, 4U, REAR_CONTROLLER_AFE2_STATUS_F_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE, 8U, REAR_CONTROLLER_AFE_TEMPERATURE_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA, 6U, IMU_GYRO_DATA_PERIOD_MS);
+  registerMessage(SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA, 6U, IMU_ACCEL_DATA_PERIOD_MS);
+}
+
+CanScheduler::~CanScheduler() {
+  pthread_mutex_destroy(&m_mutex);
+}
+
+/**
+ * @brief   Convert a duration in microseconds to a Broadcast Manager interval
+ * @param   interval Broadcast Manager interval to be set
+ * @param   durationUs Duration in microseconds
+ */
+static void setBcmInterval(struct bcm_timeval &interval, uint64_t durationUs) {
+  interval.tv_sec = durationUs / 1000000U;
+  interval.tv_usec = durationUs % 1000000U;
+}
+
+CanBcmJob &CanScheduler::findJob(uint32_t canId) {
+  auto job = m_bcmJobs.find(canId);
+
+  if (job == m_bcmJobs.end()) {
+    throw std::runtime_error("CAN message " + std::to_string(canId) + " is not registered");
+  }
+
+  return job->second;
+}
+
+void CanScheduler::writeJob(CanBcmJob &job) {
+  struct iovec iov[2U] = {
+    { &job.msg_head, sizeof(struct bcm_msg_head) },
+    { &job.frame, sizeof(struct can_frame) },
+  };
+
+  if (writev(m_bcmCanSocket, iov, 2U) < 0) {
+    throw std::runtime_error("Failed to write CAN BCM message " + std::to_string(job.frame.can_id));
+  }
+}
+
+void CanScheduler::startJob(CanBcmJob &job, uint32_t count, unsigned int burstIntervalUs) {
+  job.msg_head.flags = SETTIMER | STARTTIMER;
+  job.msg_head.count = count;
+  setBcmInterval(job.msg_head.ival1, count > 0U ? burstIntervalUs : 0U);
+  setBcmInterval(job.msg_head.ival2, static_cast<uint64_t>(job.periodMs) * 1000U);
+
+  if (m_isConnected) {
+    writeJob(job);
+  }
+
+  /* Later TX_SETUP writes only replace the frame data and keep the running cycle timer */
+  job.msg_head.flags = 0U;
+  job.msg_head.count = 0U;
 }
 
 void CanScheduler::scheduleCanMessages() {
-  canFastCycleBCM.msg_head.opcode = TX_SETUP;
-  canFastCycleBCM.msg_head.can_id = FAST_CYCLE_BCM_ID;
-  canFastCycleBCM.msg_head.flags = SETTIMER | STARTTIMER;
-  canFastCycleBCM.msg_head.nframes = NUM_FAST_CYCLE_MESSAGES;
-  canFastCycleBCM.msg_head.count = 0;
-
-  canFastCycleBCM.msg_head.ival1.tv_sec = 0U;
-  canFastCycleBCM.msg_head.ival1.tv_usec = 0U;
-  canFastCycleBCM.msg_head.ival2.tv_sec = FAST_CYCLE_SPEED_MS / 1000U;
-  canFastCycleBCM.msg_head.ival2.tv_usec = (FAST_CYCLE_SPEED_MS % 1000U) * 1000U;
-
-  canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG;
-  canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].can_dlc = 4U;
-  memset(canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-
-  if (write(m_bcmCanSocket, &canFastCycleBCM, sizeof(canFastCycleBCM)) < 0) {
-    throw std::runtime_error("Failed to schedule CAN BCM Fast cycle messages");
-  }
-
-  canMediumCycleBCM.msg_head.opcode = TX_SETUP;
-  canMediumCycleBCM.msg_head.can_id = MEDIUM_CYCLE_BCM_ID;
-  canMediumCycleBCM.msg_head.flags = SETTIMER | STARTTIMER;
-  canMediumCycleBCM.msg_head.nframes = NUM_MEDIUM_CYCLE_MESSAGES;
-  canMediumCycleBCM.msg_head.count = 0;
-
-  canMediumCycleBCM.msg_head.ival1.tv_sec = 0U;
-  canMediumCycleBCM.msg_head.ival1.tv_usec = 0U;
-  canMediumCycleBCM.msg_head.ival2.tv_sec = MEDIUM_CYCLE_SPEED_MS / 1000U;
-  canMediumCycleBCM.msg_head.ival2.tv_usec = (MEDIUM_CYCLE_SPEED_MS % 1000U) * 1000U;
-
-  canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_STEERING_STEERING;
-  canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].can_dlc = 5U;
-  memset(canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].can_dlc = 4U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].can_dlc = 6U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].can_dlc = 6U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].can_dlc = 8U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].can_dlc = 8U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].can_dlc = 7U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE;
-  canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].can_dlc = 8U;
-  memset(canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG;
-  canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].can_dlc = 4U;
-  memset(canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA;
-  canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].can_dlc = 6U;
-  memset(canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA;
-  canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].can_dlc = 6U;
-  memset(canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA;
-  canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].can_dlc = 8U;
-  memset(canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS;
-  canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].can_dlc = 5U;
-  memset(canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-
-  if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-    throw std::runtime_error("Failed to schedule CAN BCM Medium cycle messages");
-  }
-
-  canSlowCycleBCM.msg_head.opcode = TX_SETUP;
-  canSlowCycleBCM.msg_head.can_id = SLOW_CYCLE_BCM_ID;
-  canSlowCycleBCM.msg_head.flags = SETTIMER | STARTTIMER;
-  canSlowCycleBCM.msg_head.nframes = NUM_SLOW_CYCLE_MESSAGES;
-  canSlowCycleBCM.msg_head.count = 0;
-
-  canSlowCycleBCM.msg_head.ival1.tv_sec = 0U;
-  canSlowCycleBCM.msg_head.ival1.tv_usec = 0U;
-  canSlowCycleBCM.msg_head.ival2.tv_sec = SLOW_CYCLE_SPEED_MS / 1000U;
-  canSlowCycleBCM.msg_head.ival2.tv_usec = (SLOW_CYCLE_SPEED_MS % 1000U) * 1000U;
-
-  canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG;
-  canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].can_dlc = 4U;
-  memset(canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A;
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].can_dlc = 8U;
-  memset(canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B;
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].can_dlc = 4U;
-  memset(canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].can_id = SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP;
-  canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].can_dlc = 8U;
-  memset(canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data, 0U, MAX_MESSAGE_LENGTH);
-
-  if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-    throw std::runtime_error("Failed to schedule CAN BCM Slow cycle messages");
+  pthread_mutex_lock(&m_mutex);
+
+  try {
+    m_isConnected = true;
+
+    for (auto &entry : m_bcmJobs) {
+      startJob(entry.second, 0U, 0U);
+    }
+  } catch (...) {
+    m_isConnected = false;
+    pthread_mutex_unlock(&m_mutex);
+    throw;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::updateJob(CanBcmJob &job) {
+  if (m_batchDepth > 0U) {
+    if (!job.isPending) {
+      job.isPending = true;
+      m_pendingJobs.push_back(job.frame.can_id);
+    }
+    return;
+  }
+
+  if (!m_isConnected) {
+    return;
+  }
+
+  writeJob(job);
+}
+
+void CanScheduler::beginUpdate() {
+  pthread_mutex_lock(&m_mutex);
+  m_batchDepth++;
+}
+
+void CanScheduler::commit() {
+  if (m_batchDepth == 0U) {
+    return;
+  }
+
+  m_batchDepth--;
+
+  try {
+    if (m_batchDepth == 0U && !m_pendingJobs.empty()) {
+      std::vector<struct iovec> iovecs(m_pendingJobs.size() * 2U);
+      std::vector<struct mmsghdr> messages(m_pendingJobs.size());
+      unsigned int numPending = 0U;
+
+      for (uint32_t canId : m_pendingJobs) {
+        auto job = m_bcmJobs.find(canId);
+
+        /* The message may have been unregistered during the batch */
+        if (job == m_bcmJobs.end()) {
+          continue;
+        }
+
+        job->second.isPending = false;
+        iovecs[numPending * 2U] = { &job->second.msg_head, sizeof(struct bcm_msg_head) };
+        iovecs[numPending * 2U + 1U] = { &job->second.frame, sizeof(struct can_frame) };
+        messages[numPending] = {};
+        messages[numPending].msg_hdr.msg_iov = &iovecs[numPending * 2U];
+        messages[numPending].msg_hdr.msg_iovlen = 2U;
+        numPending++;
+      }
+
+      m_pendingJobs.clear();
+
+      unsigned int numSent = 0U;
+      while (m_isConnected && numSent < numPending) {
+        int result = sendmmsg(m_bcmCanSocket, messages.data() + numSent, numPending - numSent, 0);
+
+        if (result < 0) {
+          throw std::runtime_error("Failed to commit CAN BCM updates");
+        }
+
+        numSent += static_cast<unsigned int>(result);
+      }
+    }
+  } catch (std::exception &e) {
+    std::cerr << e.what() << std::endl;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::registerMessage(uint32_t canId, uint8_t dlc, unsigned int periodMs, const uint8_t *data) {
+  if (dlc > MAX_MESSAGE_LENGTH) {
+    throw std::runtime_error("Invalid length for CAN message " + std::to_string(canId));
+  }
+
+  pthread_mutex_lock(&m_mutex);
+
+  CanBcmJob &job = m_bcmJobs[canId];
+  memset(&job, 0, sizeof(job));
+
+  job.periodMs = periodMs;
+  job.msg_head.opcode = TX_SETUP;
+  job.msg_head.can_id = canId;
+  job.msg_head.nframes = 1U;
+  job.frame.can_id = canId;
+  job.frame.can_dlc = dlc;
+
+  if (data != nullptr) {
+    memcpy(job.frame.data, data, dlc);
+  }
+
+  try {
+    startJob(job, 0U, 0U);
+  } catch (...) {
+    pthread_mutex_unlock(&m_mutex);
+    throw;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::unregisterMessage(uint32_t canId) {
+  pthread_mutex_lock(&m_mutex);
+
+  try {
+    findJob(canId);
+    m_bcmJobs.erase(canId);
+
+    if (m_isConnected) {
+      struct bcm_msg_head deleteHead = {};
+      deleteHead.opcode = TX_DELETE;
+      deleteHead.can_id = canId;
+
+      if (write(m_bcmCanSocket, &deleteHead, sizeof(deleteHead)) < 0) {
+        throw std::runtime_error("Failed to delete CAN BCM message " + std::to_string(canId));
+      }
+    }
+  } catch (...) {
+    pthread_mutex_unlock(&m_mutex);
+    throw;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::setMessagePeriod(uint32_t canId, unsigned int periodMs) {
+  pthread_mutex_lock(&m_mutex);
+
+  try {
+    CanBcmJob &job = findJob(canId);
+    job.periodMs = periodMs;
+    startJob(job, 0U, 0U);
+  } catch (...) {
+    pthread_mutex_unlock(&m_mutex);
+    throw;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::sendBurst(uint32_t canId, uint32_t count, unsigned int burstIntervalUs) {
+  pthread_mutex_lock(&m_mutex);
+
+  try {
+    startJob(findJob(canId), count, burstIntervalUs);
+  } catch (...) {
+    pthread_mutex_unlock(&m_mutex);
+    throw;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
+
+void CanScheduler::sendOneShot(uint32_t canId, uint8_t dlc, const uint8_t *data) {
+  if (dlc > MAX_MESSAGE_LENGTH) {
+    throw std::runtime_error("Invalid length for CAN message " + std::to_string(canId));
+  }
+
+  struct bcm_msg_head sendHead = {};
+  sendHead.opcode = TX_SEND;
+  sendHead.can_id = canId;
+  sendHead.nframes = 1U;
+
+  struct can_frame frame = {};
+  frame.can_id = canId;
+  frame.can_dlc = dlc;
+  memcpy(frame.data, data, dlc);
+
+  struct iovec iov[2U] = {
+    { &sendHead, sizeof(struct bcm_msg_head) },
+    { &frame, sizeof(struct can_frame) },
+  };
+
+  if (writev(m_bcmCanSocket, iov, 2U) < 0) {
+    throw std::runtime_error("Failed to send CAN message " + std::to_string(canId));
   }
 }
 
@@ -188,1289 +339,2003 @@ void CanScheduler::startCanScheduler() {
     std::cerr << "Error running CAN Scheduler: " << e.what() << std::endl;
   }
 }
-void CanScheduler::update_steering_cruise_control_target_velocity(uint32_t cruise_control_target_velocity_value) {
+
+void CanScheduler::update_fast_one_shot_msg_sig1(uint16_t sig1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data[start_byte + 0U] = (cruise_control_target_velocity_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data[start_byte + 1U] = (cruise_control_target_velocity_value >> 8U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data[start_byte + 2U] = (cruise_control_target_velocity_value >> 16U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data[start_byte + 3U] = (cruise_control_target_velocity_value >> 24U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update steering cruise_control_target_velocity}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig1_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_steering_buttons(uint8_t buttons_value) {
+
+void CanScheduler::update_fast_one_shot_msg_sig2(uint16_t sig2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_STEERING_STEERING_FRAME_INDEX].data[start_byte + 0U] = (buttons_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update steering buttons}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig2_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_SIG2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_rear_controller_status_triggers(uint32_t triggers_value) {
+
+void CanScheduler::update_medium_one_shot_msg_sig1(uint16_t sig1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].data[start_byte + 0U] = (triggers_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].data[start_byte + 1U] = (triggers_value >> 8U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].data[start_byte + 2U] = (triggers_value >> 16U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_FRAME_INDEX].data[start_byte + 3U] = (triggers_value >> 24U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update rear_controller_status triggers}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig1_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_a_pack_voltage(uint16_t pack_voltage_value) {
+
+void CanScheduler::update_medium_one_shot_msg_sig2(uint16_t sig2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 0U] = (pack_voltage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 1U] = (pack_voltage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_a pack_voltage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig2_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_SIG2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_a_pack_current(uint16_t pack_current_value) {
+
+void CanScheduler::update_slow_one_shot_msg_sig1(uint16_t sig1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 0U] = (pack_current_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 1U] = (pack_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_a pack_current}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig1_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_a_pack_soc(uint16_t pack_soc_value) {
+
+void CanScheduler::update_slow_one_shot_msg_sig2(uint16_t sig2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 0U] = (pack_soc_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_A_FRAME_INDEX].data[start_byte + 1U] = (pack_soc_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_a pack_soc}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(sig2_value, SYSTEM_CAN_SIGNAL_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_SIG2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_b_max_cell_voltage(uint16_t max_cell_voltage_value) {
+
+void CanScheduler::update_drive_status_pedal_percentage(uint16_t pedal_percentage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 0U] = (max_cell_voltage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 1U] = (max_cell_voltage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_b max_cell_voltage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_PEDAL_PERCENTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(pedal_percentage_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_PEDAL_PERCENTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_b_min_cell_voltage(uint16_t min_cell_voltage_value) {
+
+void CanScheduler::update_drive_status_brake_percentage(uint16_t brake_percentage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 0U] = (min_cell_voltage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 1U] = (min_cell_voltage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_b min_cell_voltage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_BRAKE_PERCENTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(brake_percentage_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_BRAKE_PERCENTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_battery_stats_b_max_temperature(uint16_t max_temperature_value) {
+
+void CanScheduler::update_drive_status_state_data(uint8_t state_data_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_DRIVE_STATUS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 0U] = (max_temperature_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_BATTERY_STATS_B_FRAME_INDEX].data[start_byte + 1U] = (max_temperature_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update battery_stats_b max_temperature}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_STATE_DATA);
+    data |= SYSTEM_CAN_SIGNAL_PACK(state_data_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_DRIVE_STATUS_STATE_DATA);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_power_input_stats_input_dcdc_voltage(uint16_t input_dcdc_voltage_value) {
+
+void CanScheduler::update_fc_power_group_a_rev_cam_current(uint16_t rev_cam_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 0U] = (input_dcdc_voltage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 1U] = (input_dcdc_voltage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update power_input_stats input_dcdc_voltage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_REV_CAM_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(rev_cam_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_REV_CAM_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_power_input_stats_input_dcdc_current(uint16_t input_dcdc_current_value) {
+
+void CanScheduler::update_fc_power_group_a_telem_current(uint16_t telem_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 0U] = (input_dcdc_current_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 1U] = (input_dcdc_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update power_input_stats input_dcdc_current}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_TELEM_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(telem_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_TELEM_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_power_input_stats_input_aux_voltage(uint16_t input_aux_voltage_value) {
+
+void CanScheduler::update_fc_power_group_a_steering_current(uint16_t steering_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 0U] = (input_aux_voltage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 1U] = (input_aux_voltage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update power_input_stats input_aux_voltage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_STEERING_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(steering_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_STEERING_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_power_input_stats_input_aux_current(uint16_t input_aux_current_value) {
+
+void CanScheduler::update_fc_power_group_a_driver_fan_current(uint16_t driver_fan_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 6;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 0U] = (input_aux_current_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_POWER_INPUT_STATS_FRAME_INDEX].data[start_byte + 1U] = (input_aux_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update power_input_stats input_aux_current}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_DRIVER_FAN_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(driver_fan_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_A_DRIVER_FAN_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_discharge_bitset_afe1(uint32_t afe1_value) {
+
+void CanScheduler::update_fc_power_group_b_horn_current(uint16_t horn_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 0U] = (afe1_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 1U] = (afe1_value >> 8U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 2U] = (afe1_value >> 16U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 3U] = (afe1_value >> 24U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_discharge_bitset afe1}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_HORN_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(horn_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_HORN_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_discharge_bitset_afe2(uint32_t afe2_value) {
+
+void CanScheduler::update_fc_power_group_b_spare_current(uint16_t spare_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_GROUP_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 0U] = (afe2_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 1U] = (afe2_value >> 8U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 2U] = (afe2_value >> 16U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_FRAME_INDEX].data[start_byte + 3U] = (afe2_value >> 24U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_discharge_bitset afe2}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_SPARE_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(spare_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_GROUP_B_SPARE_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_a_id(uint8_t id_value) {
+
+void CanScheduler::update_fc_power_lights_group_brake_light_sig_current(uint16_t brake_light_sig_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_a id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BRAKE_LIGHT_SIG_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(brake_light_sig_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BRAKE_LIGHT_SIG_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_a_voltage_0(uint16_t voltage_0_value) {
+
+void CanScheduler::update_fc_power_lights_group_bps_light_sig_current(uint16_t bps_light_sig_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_0_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_0_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_a voltage_0}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BPS_LIGHT_SIG_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(bps_light_sig_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_BPS_LIGHT_SIG_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_a_voltage_1(uint16_t voltage_1_value) {
+
+void CanScheduler::update_fc_power_lights_group_right_sig_current(uint16_t right_sig_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_1_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_1_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_a voltage_1}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_RIGHT_SIG_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(right_sig_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_RIGHT_SIG_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_a_voltage_2(uint16_t voltage_2_value) {
+
+void CanScheduler::update_fc_power_lights_group_left_sig_current(uint16_t left_sig_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_2_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_2_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_a voltage_2}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_LEFT_SIG_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(left_sig_current_value, SYSTEM_CAN_SIGNAL_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_LEFT_SIG_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_b_id(uint8_t id_value) {
+
+void CanScheduler::update_imu_data_g_force(uint16_t g_force_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_b id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_G_FORCE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(g_force_value, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_G_FORCE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_b_voltage_3(uint16_t voltage_3_value) {
+
+void CanScheduler::update_imu_data_roll(uint16_t roll_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_3_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_3_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_b voltage_3}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_ROLL);
+    data |= SYSTEM_CAN_SIGNAL_PACK(roll_value, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_ROLL);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_b_voltage_4(uint16_t voltage_4_value) {
+
+void CanScheduler::update_imu_data_pitch(uint16_t pitch_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_4_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_4_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_b voltage_4}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_PITCH);
+    data |= SYSTEM_CAN_SIGNAL_PACK(pitch_value, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_PITCH);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_b_voltage_5(uint16_t voltage_5_value) {
+
+void CanScheduler::update_imu_data_yaw(uint16_t yaw_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_TELEMETRY_IMU_DATA);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_5_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_5_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_b voltage_5}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_YAW);
+    data |= SYSTEM_CAN_SIGNAL_PACK(yaw_value, SYSTEM_CAN_SIGNAL_TELEMETRY_IMU_DATA_YAW);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_c_id(uint8_t id_value) {
+
+void CanScheduler::update_steering_cruise_control_target_velocity(uint32_t cruise_control_target_velocity_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_STEERING_STEERING);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_c id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_STEERING_STEERING_CRUISE_CONTROL_TARGET_VELOCITY);
+    data |= SYSTEM_CAN_SIGNAL_PACK(cruise_control_target_velocity_value, SYSTEM_CAN_SIGNAL_STEERING_STEERING_CRUISE_CONTROL_TARGET_VELOCITY);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_c_voltage_6(uint16_t voltage_6_value) {
+
+void CanScheduler::update_steering_buttons(uint8_t buttons_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_STEERING_STEERING);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_6_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_6_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_c voltage_6}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_STEERING_STEERING_BUTTONS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(buttons_value, SYSTEM_CAN_SIGNAL_STEERING_STEERING_BUTTONS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_c_voltage_7(uint16_t voltage_7_value) {
+
+void CanScheduler::update_rear_controller_status_triggers(uint32_t triggers_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_REAR_CONTROLLER_STATUS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_7_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_7_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_c voltage_7}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_TRIGGERS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(triggers_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_REAR_CONTROLLER_STATUS_TRIGGERS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_c_voltage_8(uint16_t voltage_8_value) {
+
+void CanScheduler::update_battery_stats_a_pack_voltage(uint16_t pack_voltage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_8_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_8_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_c voltage_8}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_VOLTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(pack_voltage_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_VOLTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_d_id(uint8_t id_value) {
+
+void CanScheduler::update_battery_stats_a_pack_current(uint16_t pack_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_d id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(pack_current_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_d_voltage_9(uint16_t voltage_9_value) {
+
+void CanScheduler::update_battery_stats_a_pack_soc(uint16_t pack_soc_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_9_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_9_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_d voltage_9}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_SOC);
+    data |= SYSTEM_CAN_SIGNAL_PACK(pack_soc_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_A_PACK_SOC);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_d_voltage_10(uint16_t voltage_10_value) {
+
+void CanScheduler::update_battery_stats_b_max_cell_voltage(float max_cell_voltage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_10_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_10_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_d voltage_10}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(max_cell_voltage_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_CELL_VOLTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_d_voltage_11(uint16_t voltage_11_value) {
+
+void CanScheduler::update_battery_stats_b_min_cell_voltage(float min_cell_voltage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_11_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_11_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_d voltage_11}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(min_cell_voltage_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MIN_CELL_VOLTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_e_id(uint8_t id_value) {
+
+void CanScheduler::update_battery_stats_b_max_temperature(uint16_t max_temperature_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_BATTERY_STATS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_e id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_TEMPERATURE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(max_temperature_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_BATTERY_STATS_B_MAX_TEMPERATURE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_e_voltage_12(uint16_t voltage_12_value) {
+
+void CanScheduler::update_power_input_stats_input_dcdc_voltage(uint16_t input_dcdc_voltage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_12_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_12_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_e voltage_12}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_VOLTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(input_dcdc_voltage_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_VOLTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_e_voltage_13(uint16_t voltage_13_value) {
+
+void CanScheduler::update_power_input_stats_input_dcdc_current(uint16_t input_dcdc_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_13_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_13_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_e voltage_13}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(input_dcdc_current_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_DCDC_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_e_voltage_14(uint16_t voltage_14_value) {
+
+void CanScheduler::update_power_input_stats_input_aux_voltage(uint16_t input_aux_voltage_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_14_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_14_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_e voltage_14}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_VOLTAGE);
+    data |= SYSTEM_CAN_SIGNAL_PACK(input_aux_voltage_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_VOLTAGE);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_f_id(uint8_t id_value) {
+
+void CanScheduler::update_power_input_stats_input_aux_current(uint16_t input_aux_current_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_POWER_INPUT_STATS);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_f id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_CURRENT);
+    data |= SYSTEM_CAN_SIGNAL_PACK(input_aux_current_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_POWER_INPUT_STATS_INPUT_AUX_CURRENT);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_f_voltage_15(uint16_t voltage_15_value) {
+
+void CanScheduler::update_afe_discharge_bitset_afe1(uint32_t afe1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_15_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_15_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_f voltage_15}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(afe1_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_f_voltage_16(uint16_t voltage_16_value) {
+
+void CanScheduler::update_afe_discharge_bitset_afe2(uint32_t afe2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_DISCHARGE_BITSET);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_16_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_16_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_f voltage_16}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(afe2_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_DISCHARGE_BITSET_AFE2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe1_status_f_voltage_17(uint16_t voltage_17_value) {
+
+void CanScheduler::update_afe1_status_a_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_17_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE1_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_17_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe1_status_f voltage_17}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_a_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_a_voltage_0(float voltage_0_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_a id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_0_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_0);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_a_voltage_0(uint16_t voltage_0_value) {
+
+void CanScheduler::update_afe1_status_a_voltage_1(float voltage_1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_0_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_0_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_a voltage_0}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_1_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_a_voltage_1(uint16_t voltage_1_value) {
+
+void CanScheduler::update_afe1_status_a_voltage_2(float voltage_2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_1_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_1_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_a voltage_1}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_2_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_A_VOLTAGE_2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_a_voltage_2(uint16_t voltage_2_value) {
+
+void CanScheduler::update_afe1_status_b_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 0U] = (voltage_2_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_A_FRAME_INDEX].data[start_byte + 1U] = (voltage_2_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_a voltage_2}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_b_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_b_voltage_3(float voltage_3_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_b id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_3_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_3);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_b_voltage_3(uint16_t voltage_3_value) {
+
+void CanScheduler::update_afe1_status_b_voltage_4(float voltage_4_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_3_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_3_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_b voltage_3}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_4_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_4);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_b_voltage_4(uint16_t voltage_4_value) {
+
+void CanScheduler::update_afe1_status_b_voltage_5(float voltage_5_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_4_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_4_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_b voltage_4}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_5_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_B_VOLTAGE_5);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_b_voltage_5(uint16_t voltage_5_value) {
+
+void CanScheduler::update_afe1_status_c_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 0U] = (voltage_5_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_B_FRAME_INDEX].data[start_byte + 1U] = (voltage_5_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_b voltage_5}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_c_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_c_voltage_6(float voltage_6_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_c id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_6_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_6);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_c_voltage_6(uint16_t voltage_6_value) {
+
+void CanScheduler::update_afe1_status_c_voltage_7(float voltage_7_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_6_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_6_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_c voltage_6}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_7_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_7);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_c_voltage_7(uint16_t voltage_7_value) {
+
+void CanScheduler::update_afe1_status_c_voltage_8(float voltage_8_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_7_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_7_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_c voltage_7}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_8_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_C_VOLTAGE_8);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_c_voltage_8(uint16_t voltage_8_value) {
+
+void CanScheduler::update_afe1_status_d_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 0U] = (voltage_8_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_C_FRAME_INDEX].data[start_byte + 1U] = (voltage_8_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_c voltage_8}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_d_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_d_voltage_9(float voltage_9_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_d id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_9_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_9);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_d_voltage_9(uint16_t voltage_9_value) {
+
+void CanScheduler::update_afe1_status_d_voltage_10(float voltage_10_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_9_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_9_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_d voltage_9}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_10_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_10);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_d_voltage_10(uint16_t voltage_10_value) {
+
+void CanScheduler::update_afe1_status_d_voltage_11(float voltage_11_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_10_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_10_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_d voltage_10}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_11_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_D_VOLTAGE_11);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_d_voltage_11(uint16_t voltage_11_value) {
+
+void CanScheduler::update_afe1_status_e_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 0U] = (voltage_11_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_D_FRAME_INDEX].data[start_byte + 1U] = (voltage_11_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_d voltage_11}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_e_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_e_voltage_12(float voltage_12_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_e id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_12_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_12);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_e_voltage_12(uint16_t voltage_12_value) {
+
+void CanScheduler::update_afe1_status_e_voltage_13(float voltage_13_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_12_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_12_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_e voltage_12}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_13_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_13);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_e_voltage_13(uint16_t voltage_13_value) {
+
+void CanScheduler::update_afe1_status_e_voltage_14(float voltage_14_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_13_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_13_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_e voltage_13}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_14_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_E_VOLTAGE_14);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_e_voltage_14(uint16_t voltage_14_value) {
+
+void CanScheduler::update_afe1_status_f_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 0U] = (voltage_14_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_E_FRAME_INDEX].data[start_byte + 1U] = (voltage_14_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_e voltage_14}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_f_id(uint8_t id_value) {
+
+void CanScheduler::update_afe1_status_f_voltage_15(float voltage_15_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_f id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_15_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_15);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_f_voltage_15(uint16_t voltage_15_value) {
+
+void CanScheduler::update_afe1_status_f_voltage_16(float voltage_16_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_15_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_15_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_f voltage_15}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_16_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_16);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_f_voltage_16(uint16_t voltage_16_value) {
+
+void CanScheduler::update_afe1_status_f_voltage_17(float voltage_17_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE1_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_16_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_16_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_f voltage_16}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_17_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE1_STATUS_F_VOLTAGE_17);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe2_status_f_voltage_17(uint16_t voltage_17_value) {
+
+void CanScheduler::update_afe2_status_a_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 0U] = (voltage_17_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE2_STATUS_F_FRAME_INDEX].data[start_byte + 1U] = (voltage_17_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe2_status_f voltage_17}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_id(uint8_t id_value) {
+
+void CanScheduler::update_afe2_status_a_voltage_0(float voltage_0_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (id_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature id}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_0_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_0);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_0(uint8_t temperature_0_value) {
+
+void CanScheduler::update_afe2_status_a_voltage_1(float voltage_1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 1;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_0_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_0}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_1_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_1(uint8_t temperature_1_value) {
+
+void CanScheduler::update_afe2_status_a_voltage_2(float voltage_2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_A);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_1_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_1}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_2_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_A_VOLTAGE_2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_2(uint8_t temperature_2_value) {
+
+void CanScheduler::update_afe2_status_b_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 3;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_2_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_2}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_3(uint8_t temperature_3_value) {
+
+void CanScheduler::update_afe2_status_b_voltage_3(float voltage_3_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_3_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_3}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_3_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_3);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_4(uint8_t temperature_4_value) {
+
+void CanScheduler::update_afe2_status_b_voltage_4(float voltage_4_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 5;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_4_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_4}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_4_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_4);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_5(uint8_t temperature_5_value) {
+
+void CanScheduler::update_afe2_status_b_voltage_5(float voltage_5_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 6;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_B);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_5_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_5}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_5_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_B_VOLTAGE_5);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_afe_temperature_temperature_6(uint8_t temperature_6_value) {
+
+void CanScheduler::update_afe2_status_c_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 7;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_REAR_CONTROLLER_AFE_TEMPERATURE_FRAME_INDEX].data[start_byte + 0U] = (temperature_6_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update afe_temperature temperature_6}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fast_one_shot_msg_sig1(uint16_t sig1_value) {
+
+void CanScheduler::update_afe2_status_c_voltage_6(float voltage_6_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C);
 
-    canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig1_value >> 0U) & 0xFFU;
-    canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig1_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canFastCycleBCM, sizeof(canFastCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fast_one_shot_msg sig1");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_6_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_6);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fast_one_shot_msg_sig2(uint16_t sig2_value) {
+
+void CanScheduler::update_afe2_status_c_voltage_7(float voltage_7_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C);
 
-    canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig2_value >> 0U) & 0xFFU;
-    canFastCycleBCM.frame[FAST_CAN_COMMUNICATION_FAST_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig2_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canFastCycleBCM, sizeof(canFastCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fast_one_shot_msg sig2");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_7_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_7);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_medium_one_shot_msg_sig1(uint16_t sig1_value) {
+
+void CanScheduler::update_afe2_status_c_voltage_8(float voltage_8_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_C);
 
-    canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig1_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig1_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update medium_one_shot_msg sig1}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_8_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_C_VOLTAGE_8);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_medium_one_shot_msg_sig2(uint16_t sig2_value) {
+
+void CanScheduler::update_afe2_status_d_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig2_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_CAN_COMMUNICATION_MEDIUM_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig2_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update medium_one_shot_msg sig2}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_slow_one_shot_msg_sig1(uint16_t sig1_value) {
+
+void CanScheduler::update_afe2_status_d_voltage_9(float voltage_9_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D);
 
-    canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig1_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig1_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update slow_one_shot_msg sig1");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_9_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_9);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_slow_one_shot_msg_sig2(uint16_t sig2_value) {
+
+void CanScheduler::update_afe2_status_d_voltage_10(float voltage_10_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D);
 
-    canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 0U] = (sig2_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_CAN_COMMUNICATION_SLOW_ONE_SHOT_MSG_FRAME_INDEX].data[start_byte + 1U] = (sig2_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update slow_one_shot_msg sig2");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_10_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_10);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_gyro_data_x_axis(uint16_t x_axis_value) {
+
+void CanScheduler::update_afe2_status_d_voltage_11(float voltage_11_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_D);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 0U] = (x_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 1U] = (x_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update gyro_data x_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_11_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_D_VOLTAGE_11);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_gyro_data_y_axis(uint16_t y_axis_value) {
+
+void CanScheduler::update_afe2_status_e_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 0U] = (y_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 1U] = (y_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update gyro_data y_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_gyro_data_z_axis(uint16_t z_axis_value) {
+
+void CanScheduler::update_afe2_status_e_voltage_12(float voltage_12_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 0U] = (z_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_GYRO_DATA_FRAME_INDEX].data[start_byte + 1U] = (z_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update gyro_data z_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_12_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_12);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_accel_data_x_axis(uint16_t x_axis_value) {
+
+void CanScheduler::update_afe2_status_e_voltage_13(float voltage_13_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 0U] = (x_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 1U] = (x_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update accel_data x_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_13_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_13);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_accel_data_y_axis(uint16_t y_axis_value) {
+
+void CanScheduler::update_afe2_status_e_voltage_14(float voltage_14_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_E);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 0U] = (y_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 1U] = (y_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update accel_data y_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_14_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_E_VOLTAGE_14);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_accel_data_z_axis(uint16_t z_axis_value) {
+
+void CanScheduler::update_afe2_status_f_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 0U] = (z_axis_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_IMU_ACCEL_DATA_FRAME_INDEX].data[start_byte + 1U] = (z_axis_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update accel_data z_axis}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_imu_data_g_force(uint16_t g_force_value) {
+
+void CanScheduler::update_afe2_status_f_voltage_15(float voltage_15_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 0U] = (g_force_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 1U] = (g_force_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update imu_data g_force}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_15_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_15);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_imu_data_roll(uint16_t roll_value) {
+
+void CanScheduler::update_afe2_status_f_voltage_16(float voltage_16_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 0U] = (roll_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 1U] = (roll_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update imu_data roll}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_16_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_16);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_imu_data_pitch(uint16_t pitch_value) {
+
+void CanScheduler::update_afe2_status_f_voltage_17(float voltage_17_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE2_STATUS_F);
 
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 0U] = (pitch_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 1U] = (pitch_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update imu_data pitch}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17);
+    data |= SYSTEM_CAN_SIGNAL_PACK(system_can_signal_from_float(voltage_17_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17_MIN, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17_MASK), SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE2_STATUS_F_VOLTAGE_17);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_imu_data_yaw(uint16_t yaw_value) {
+
+void CanScheduler::update_afe_temperature_id(uint8_t id_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 6;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 0U] = (yaw_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_TELEMETRY_IMU_DATA_FRAME_INDEX].data[start_byte + 1U] = (yaw_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update imu_data yaw}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_ID);
+    data |= SYSTEM_CAN_SIGNAL_PACK(id_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_ID);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_drive_status_pedal_percentage(uint16_t pedal_percentage_value) {
+
+void CanScheduler::update_afe_temperature_temperature_0(uint8_t temperature_0_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data[start_byte + 0U] = (pedal_percentage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data[start_byte + 1U] = (pedal_percentage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update drive_status pedal_percentage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_0);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_0_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_0);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_drive_status_brake_percentage(uint16_t brake_percentage_value) {
+
+void CanScheduler::update_afe_temperature_temperature_1(uint8_t temperature_1_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data[start_byte + 0U] = (brake_percentage_value >> 0U) & 0xFFU;
-    canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data[start_byte + 1U] = (brake_percentage_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update drive_status brake_percentage}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_1);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_1_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_1);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_drive_status_state_data(uint8_t state_data_value) {
+
+void CanScheduler::update_afe_temperature_temperature_2(uint8_t temperature_2_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canMediumCycleBCM.frame[MEDIUM_FRONT_CONTROLLER_DRIVE_STATUS_FRAME_INDEX].data[start_byte + 0U] = (state_data_value >> 0U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canMediumCycleBCM, sizeof(canMediumCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update drive_status state_data}");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_2);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_2_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_2);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_a_rev_cam_current(uint16_t rev_cam_current_value) {
+
+void CanScheduler::update_afe_temperature_temperature_3(uint8_t temperature_3_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 0U] = (rev_cam_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 1U] = (rev_cam_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_a rev_cam_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_3);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_3_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_3);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_a_telem_current(uint16_t telem_current_value) {
+
+void CanScheduler::update_afe_temperature_temperature_4(uint8_t temperature_4_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 0U] = (telem_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 1U] = (telem_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_a telem_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_4);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_4_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_4);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_a_steering_current(uint16_t steering_current_value) {
+
+void CanScheduler::update_afe_temperature_temperature_5(uint8_t temperature_5_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 0U] = (steering_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 1U] = (steering_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_a steering_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_5);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_5_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_5);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_a_driver_fan_current(uint16_t driver_fan_current_value) {
+
+void CanScheduler::update_afe_temperature_temperature_6(uint8_t temperature_6_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 6;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_REAR_CONTROLLER_AFE_TEMPERATURE);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 0U] = (driver_fan_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_A_FRAME_INDEX].data[start_byte + 1U] = (driver_fan_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_a driver_fan_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_6);
+    data |= SYSTEM_CAN_SIGNAL_PACK(temperature_6_value, SYSTEM_CAN_SIGNAL_REAR_CONTROLLER_AFE_TEMPERATURE_TEMPERATURE_6);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_b_horn_current(uint16_t horn_current_value) {
+
+void CanScheduler::update_gyro_data_x_axis(uint16_t x_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].data[start_byte + 0U] = (horn_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].data[start_byte + 1U] = (horn_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_b horn_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_X_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(x_axis_value, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_X_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_group_b_spare_current(uint16_t spare_current_value) {
+
+void CanScheduler::update_gyro_data_y_axis(uint16_t y_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].data[start_byte + 0U] = (spare_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_GROUP_B_FRAME_INDEX].data[start_byte + 1U] = (spare_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_group_b spare_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Y_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(y_axis_value, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Y_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_lights_group_brake_light_sig_current(uint16_t brake_light_sig_current_value) {
+
+void CanScheduler::update_gyro_data_z_axis(uint16_t z_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 0;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_GYRO_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 0U] = (brake_light_sig_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 1U] = (brake_light_sig_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_lights_group brake_light_sig_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Z_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(z_axis_value, SYSTEM_CAN_SIGNAL_IMU_GYRO_DATA_Z_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_lights_group_bps_light_sig_current(uint16_t bps_light_sig_current_value) {
+
+void CanScheduler::update_accel_data_x_axis(uint16_t x_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 2;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 0U] = (bps_light_sig_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 1U] = (bps_light_sig_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_lights_group bps_light_sig_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_X_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(x_axis_value, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_X_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_lights_group_right_sig_current(uint16_t right_sig_current_value) {
+
+void CanScheduler::update_accel_data_y_axis(uint16_t y_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 4;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 0U] = (right_sig_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 1U] = (right_sig_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_lights_group right_sig_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Y_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(y_axis_value, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Y_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
+
+  pthread_mutex_unlock(&m_mutex);
 }
-void CanScheduler::update_fc_power_lights_group_left_sig_current(uint16_t left_sig_current_value) {
+
+void CanScheduler::update_accel_data_z_axis(uint16_t z_axis_value) {
+  pthread_mutex_lock(&m_mutex);
+
   try {
-    unsigned int start_byte = 6;
+    CanBcmJob &job = findJob(SYSTEM_CAN_MESSAGE_IMU_ACCEL_DATA);
 
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 0U] = (left_sig_current_value >> 0U) & 0xFFU;
-    canSlowCycleBCM.frame[SLOW_FRONT_CONTROLLER_FC_POWER_LIGHTS_GROUP_FRAME_INDEX].data[start_byte + 1U] = (left_sig_current_value >> 8U) & 0xFFU;
-    if (write(m_bcmCanSocket, &canSlowCycleBCM, sizeof(canSlowCycleBCM)) < 0) {
-      throw std::runtime_error("Failed to update fc_power_lights_group left_sig_current");
-    }
+    uint64_t data = 0U;
+    memcpy(&data, job.frame.data, sizeof(data));
+    data &= ~SYSTEM_CAN_SIGNAL_PACK(UINT64_MAX, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Z_AXIS);
+    data |= SYSTEM_CAN_SIGNAL_PACK(z_axis_value, SYSTEM_CAN_SIGNAL_IMU_ACCEL_DATA_Z_AXIS);
+    memcpy(job.frame.data, &data, sizeof(data));
+
+    updateJob(job);
   } catch (std::exception &e) {
     std::cerr << e.what() << std::endl;
   }
-}
+
+  pthread_mutex_unlock(&m_mutex);
+}
\ No newline at end of file
@@ -132,7 +132,7 @@ void GpioManager::saveGpioInfo(std::string &projectName) {
   m_gpioInfo.clear();
 }
 
-void GpioManager::updateGpioPinState(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioPinState(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
@@ -152,7 +152,7 @@ void GpioManager::updateGpioPinState(std::string &projectName, std::string &payl
   saveGpioInfo(projectName);
 }
 
-void GpioManager::updateGpioAllStates(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioAllStates(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
@@ -176,7 +176,7 @@ void GpioManager::updateGpioAllStates(std::string &projectName, std::string &pay
   saveGpioInfo(projectName);
 }
 
-void GpioManager::updateGpioPinMode(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioPinMode(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
@@ -191,7 +191,7 @@ void GpioManager::updateGpioPinMode(std::string &projectName, std::string &paylo
   saveGpioInfo(projectName);
 }
 
-void GpioManager::updateGpioAllModes(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioAllModes(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
@@ -213,7 +213,7 @@ void GpioManager::updateGpioAllModes(std::string &projectName, std::string &payl
   saveGpioInfo(projectName);
 }
 
-void GpioManager::updateGpioPinAltFunction(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioPinAltFunction(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
@@ -228,7 +228,7 @@ void GpioManager::updateGpioPinAltFunction(std::string &projectName, std::string
   saveGpioInfo(projectName);
 }
 
-void GpioManager::updateGpioAllAltFunctions(std::string &projectName, std::string &payload) {
+void GpioManager::updateGpioAllAltFunctions(std::string &projectName, std::string_view payload) {
   loadGpioInfo(projectName);
 
   m_gpioDatagram.deserialize(payload);
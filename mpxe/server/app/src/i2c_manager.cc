@@ -56,7 +56,7 @@ void I2CManager::saveI2CInfo(std::string &projectName) {
   m_i2cInfo.clear();
 }
 
-void I2CManager::updateI2CData(std::string &projectName, std::string &payload) {
+void I2CManager::updateI2CData(std::string &projectName, std::string_view payload) {
   loadI2CInfo(projectName);
 
   m_I2CDatagram.deserialize(payload);
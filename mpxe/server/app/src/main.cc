@@ -16,6 +16,7 @@
 #include "json_manager.h"
 #include "ntp_server.h"
 #include "server.h"
+#include "time_master.h"
 
 /* Intra-component Headers */
 #include "adbms_afe_manager.h"
@@ -37,6 +38,7 @@ I2CManager serverI2CManager;
 CanListener serverCanListener;
 CanScheduler serverCanScheduler;
 SPIManager serverSPIManager;
+TimeMaster serverTimeMaster;
 
 int main(int argc, char **argv) {
   std::cout << "Running Server" << std::endl;
@@ -44,6 +46,7 @@ int main(int argc, char **argv) {
   Terminal applicationTerminal(&Server);
 
   Server.listenClients(8080, applicationMessageCallback, applicationConnectCallback);
+  serverTimeMaster.start(&Server, VIRTUAL_TIME_QUANTUM_TICKS);
 
 #if USE_NETWORK_TIME_PROTOCOL == 1U
   ntp_server.startListening("127.0.0.1", "time.google.com");
@@ -52,5 +55,7 @@ int main(int argc, char **argv) {
 
   applicationTerminal.run();
 
+  serverTimeMaster.stop();
+
   return 0;
 }
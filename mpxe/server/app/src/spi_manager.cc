@@ -81,7 +81,7 @@ std::string SPIManager::stringifySpiBuffer(const uint8_t *buffer, size_t length)
   return ss.str();
 }
 
-void SPIManager::updateSpiReadBuffer(std::string &projectName, std::string &payload) {
+void SPIManager::updateSpiReadBuffer(std::string &projectName, std::string_view payload) {
   loadSPIInfo(projectName);
 
   m_spiDatagram.deserialize(payload);
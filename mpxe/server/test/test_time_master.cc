@@ -0,0 +1,246 @@
+/************************************************************************************************
+ * @file   test_time_master.cc
+ *
+ * @brief  Test file for the MPXE virtual time master
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* Inter-component Headers */
+#include <pthread.h>
+#include <unistd.h>
+
+#include "client.h"
+#include "command_code.h"
+#include "metadata.h"
+#include "time_sync_datagram.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "server.h"
+#include "time_master.h"
+
+#define TEST_PORT 18093
+#define TEST_QUANTUM_TICKS 5U
+#define TEST_SLOW_ACK_DELAY_US 500U
+#define TEST_POLL_PERIOD_US 1000U
+#define TEST_WAIT_TIMEOUT_US 5000000U
+
+/**
+ * @brief   Lockstep client that acknowledges every grant once it has run to the granted tick
+ */
+struct TestClient {
+  Client *client;                    /**< Connection to the test server */
+  std::string name;                  /**< Client name used by the barrier */
+  unsigned int ackDelayUs;           /**< Simulated time taken to run each grant */
+  uint64_t joinTick;                 /**< Tick acknowledged when joining the barrier */
+  std::atomic<uint64_t> grantedTick; /**< Last tick granted by the time master */
+  std::vector<uint64_t> grants;      /**< Every granted tick in order of arrival */
+  pthread_mutex_t grantsMutex;       /**< Mutex to protect grants */
+};
+
+static Server s_server;
+static TimeMaster s_time_master;
+
+static TestClient s_fast_client;
+static TestClient s_slow_client;
+static TestClient s_running_client;
+static TestClient s_late_client;
+
+static std::atomic<bool> s_in_lockstep{ false };
+static std::atomic<uint64_t> s_max_skew{ 0U };
+
+static void s_server_message(Server *server, ClientConnection *client, std::string_view message) {
+  auto [commandCode, payload] = decodeCommand(message);
+
+  if (commandCode == CommandCode::METADATA) {
+    Datagram::Metadata metadata;
+    metadata.deserialize(payload);
+    server->updateClientName(client, metadata.getProjectName());
+  } else if (commandCode == CommandCode::TIME_ACK) {
+    s_time_master.handleAck(client, payload);
+  }
+}
+
+static void s_server_connect(Server *server, ClientConnection *client) {}
+
+static void s_ack(Client *client, uint64_t tick) {
+  Datagram::TimeSync::Payload ack = { .tick = tick };
+  client->sendMessage(Datagram::TimeSync(ack).serialize(CommandCode::TIME_ACK));
+}
+
+static void s_record_skew(void) {
+  if (s_fast_client.client == nullptr || s_slow_client.client == nullptr) {
+    return;
+  }
+
+  uint64_t fastTick = s_fast_client.grantedTick;
+  uint64_t slowTick = s_slow_client.grantedTick;
+
+  /* Whichever client joins first runs alone until the other is in the barrier and has caught up */
+  if (!s_in_lockstep) {
+    if (slowTick == 0U || slowTick < fastTick) {
+      return;
+    }
+    s_in_lockstep = true;
+  }
+
+  uint64_t skew = (fastTick > slowTick) ? (fastTick - slowTick) : (slowTick - fastTick);
+
+  uint64_t maxSkew = s_max_skew;
+  while (skew > maxSkew && !s_max_skew.compare_exchange_weak(maxSkew, skew)) {
+  }
+}
+
+static void s_connect_client(TestClient *testClient, const std::string &name, unsigned int ackDelayUs, uint64_t joinTick) {
+  testClient->name = name;
+  testClient->ackDelayUs = ackDelayUs;
+  testClient->joinTick = joinTick;
+  testClient->grantedTick = joinTick;
+  testClient->grants.clear();
+  pthread_mutex_init(&testClient->grantsMutex, nullptr);
+
+  testClient->client = new Client(
+      "127.0.0.1", TEST_PORT,
+      [testClient](Client *client, std::string_view message) {
+        auto [commandCode, payload] = decodeCommand(message);
+        if (commandCode != CommandCode::TIME_GRANT) {
+          return;
+        }
+
+        Datagram::TimeSync grant;
+        grant.deserialize(payload);
+
+        pthread_mutex_lock(&testClient->grantsMutex);
+        testClient->grants.push_back(grant.getTick());
+        pthread_mutex_unlock(&testClient->grantsMutex);
+
+        testClient->grantedTick = grant.getTick();
+        s_record_skew();
+
+        if (testClient->ackDelayUs != 0U) {
+          usleep(testClient->ackDelayUs);
+        }
+        s_ack(client, grant.getTick());
+      },
+      [testClient](Client *client) {
+        Datagram::Metadata::Payload metadata = { .projectName = testClient->name, .projectStatus = "RUNNING", .hardwareModel = "x86" };
+        client->sendMessage(Datagram::Metadata(metadata).serialize());
+        s_ack(client, testClient->joinTick);
+      });
+
+  /* The server starts listening on its own thread, so retry until it accepts the connection */
+  for (unsigned int waitedUs = 0U; !testClient->client->isConnected() && waitedUs < TEST_WAIT_TIMEOUT_US; waitedUs += TEST_POLL_PERIOD_US) {
+    testClient->client->connectServer();
+    if (!testClient->client->isConnected()) {
+      usleep(TEST_POLL_PERIOD_US);
+    }
+  }
+  TEST_ASSERT_TRUE(testClient->client->isConnected());
+}
+
+static void s_disconnect_client(TestClient *testClient) {
+  if (testClient->client == nullptr) {
+    return;
+  }
+
+  testClient->client->disconnectServer();
+  testClient->client = nullptr;
+}
+
+static std::vector<uint64_t> s_get_grants(TestClient *testClient) {
+  pthread_mutex_lock(&testClient->grantsMutex);
+  std::vector<uint64_t> grants = testClient->grants;
+  pthread_mutex_unlock(&testClient->grantsMutex);
+
+  return grants;
+}
+
+static bool s_wait_for_tick(TestClient *testClient, uint64_t tick) {
+  for (unsigned int waitedUs = 0U; waitedUs < TEST_WAIT_TIMEOUT_US; waitedUs += TEST_POLL_PERIOD_US) {
+    if (testClient->grantedTick >= tick) {
+      return true;
+    }
+    usleep(TEST_POLL_PERIOD_US);
+  }
+
+  return false;
+}
+
+void setup_test(void) {
+  static bool s_started = false;
+
+  if (!s_started) {
+    s_server.listenClients(TEST_PORT, s_server_message, s_server_connect);
+    s_time_master.start(&s_server, TEST_QUANTUM_TICKS);
+    s_started = true;
+  }
+
+  s_in_lockstep = false;
+  s_max_skew = 0U;
+}
+
+void teardown_test(void) {
+  s_disconnect_client(&s_fast_client);
+  s_disconnect_client(&s_slow_client);
+  s_disconnect_client(&s_running_client);
+  s_disconnect_client(&s_late_client);
+}
+
+void test_clients_at_different_speeds_stay_in_lockstep(void) {
+  s_connect_client(&s_fast_client, "fast_client", 0U, 0U);
+  s_connect_client(&s_slow_client, "slow_client", TEST_SLOW_ACK_DELAY_US, 0U);
+
+  /* The slow client needs at least 100 quanta, the fast client would finish far sooner on its own */
+  TEST_ASSERT_TRUE(s_wait_for_tick(&s_slow_client, 100U * TEST_QUANTUM_TICKS));
+
+  std::vector<uint64_t> fastGrants = s_get_grants(&s_fast_client);
+  std::vector<uint64_t> slowGrants = s_get_grants(&s_slow_client);
+
+  /* No client is ever more than one quantum ahead of another */
+  TEST_ASSERT_TRUE(s_in_lockstep.load());
+  TEST_ASSERT_LESS_OR_EQUAL_UINT64(TEST_QUANTUM_TICKS, s_max_skew.load());
+  TEST_ASSERT_LESS_OR_EQUAL_UINT64(slowGrants.back() + TEST_QUANTUM_TICKS, fastGrants.back());
+
+  /* Catching up and running in lockstep, each grant advances by exactly one quantum */
+  for (size_t i = 1U; i < fastGrants.size(); i++) {
+    TEST_ASSERT_EQUAL_UINT64(fastGrants[i - 1U] + TEST_QUANTUM_TICKS, fastGrants[i]);
+  }
+  for (size_t i = 1U; i < slowGrants.size(); i++) {
+    TEST_ASSERT_EQUAL_UINT64(slowGrants[i - 1U] + TEST_QUANTUM_TICKS, slowGrants[i]);
+  }
+
+  teardown_test();
+}
+
+void test_late_joiner_catches_up_one_quantum_at_a_time(void) {
+  s_connect_client(&s_running_client, "running_client", 0U, 0U);
+  TEST_ASSERT_TRUE(s_wait_for_tick(&s_running_client, s_time_master.getGrantedTick() + 50U * TEST_QUANTUM_TICKS));
+
+  /* A client starting from tick 0 joins far behind the barrier */
+  s_connect_client(&s_late_client, "late_client", TEST_SLOW_ACK_DELAY_US, 0U);
+  uint64_t joinTarget = s_running_client.grantedTick;
+  TEST_ASSERT_TRUE(s_wait_for_tick(&s_late_client, joinTarget));
+
+  std::vector<uint64_t> lateGrants = s_get_grants(&s_late_client);
+
+  /* The first grant is clamped to one quantum instead of jumping straight to the barrier */
+  TEST_ASSERT_EQUAL_UINT64(TEST_QUANTUM_TICKS, lateGrants.front());
+  for (size_t i = 1U; i < lateGrants.size(); i++) {
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(lateGrants[i - 1U] + TEST_QUANTUM_TICKS, lateGrants[i]);
+    TEST_ASSERT_GREATER_THAN_UINT64(lateGrants[i - 1U], lateGrants[i]);
+  }
+
+  /* The running client waits at the barrier until the late client has caught up */
+  std::vector<uint64_t> runningGrants = s_get_grants(&s_running_client);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT64(lateGrants.back() + TEST_QUANTUM_TICKS, runningGrants.back());
+
+  teardown_test();
+}
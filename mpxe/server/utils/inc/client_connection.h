@@ -18,6 +18,7 @@
 #include <pthread.h>
 
 /* Intra-component Headers */
+#include "frame_transport.h"
 
 /**
  * @defgroup Server_Utils
@@ -41,6 +42,8 @@ class ClientConnection {
   int m_clientSocket;                 /**< The clients file descriptor (FD) */
   struct sockaddr_in m_clientAddress; /**< The clients address */
   std::string m_clientName;           /**< The clients name */
+  ReceiveBuffer m_receiveBuffer;      /**< Buffer to reassemble frames received from the client */
+  pthread_mutex_t m_sendMutex;        /**< Mutex to keep concurrently sent frames from interleaving */
 
   Server *server; /**< Pointer to the server instance */
 
@@ -69,10 +72,19 @@ class ClientConnection {
 
   /**
    * @brief   Sends a message to the client
+   * @details The complete frame is written even if the socket accepts it in several parts
    * @param   message String message to be sent
    */
   void sendMessage(const std::string &message);
 
+  /**
+   * @brief   Reads all pending client data and dispatches every complete frame
+   * @details The socket is read until EAGAIN as required by the edge-triggered EPOLL list
+   * @param   callback Function called once for every complete frame
+   * @return  DRAINED if all data was read, CLOSED if the client disconnected
+   */
+  ReceiveBuffer::Status receiveMessages(const ReceiveBuffer::frameCallback &callback);
+
   /**
    * @brief   Gets the clients name
    * @return  The clients name
@@ -13,6 +13,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -39,12 +40,11 @@
 class Server {
  private:
   /** @brief  The message callback function definition */
-  using messageCallback = std::function<void(Server *srv, ClientConnection *src, std::string &)>;
+  using messageCallback = std::function<void(Server *srv, ClientConnection *src, std::string_view)>;
   /** @brief  The connection callback function definition */
   using connectCallback = std::function<void(Server *srv, ClientConnection *src)>;
 
   static const constexpr unsigned int MAX_SERVER_EPOLL_EVENTS = 64U; /**< Maximum permitted EPOLL events for tracking clients */
-  static const constexpr size_t MAX_CLIENT_READ_SIZE = 512U;         /**< Maximum permitted read size for all clients */
 
   pthread_t m_listenNewClientsId; /**< Thread Id for listening to new clients */
   pthread_t m_epollClientsId;     /**< Thread Id for reading incoming client data */
@@ -91,7 +91,8 @@ class Server {
   /**
    * @brief   Thread procedure for reading incoming client data
    * @details This thread shall be blocked while no new client data is available
-   *          Upon receiving a message, the message callback shall be called
+   *          Each readable client is drained until EAGAIN, and the message callback shall be
+   *          called once for every complete frame. Disconnected clients are removed
    */
   void epollClientsProcedure();
 
@@ -113,9 +114,9 @@ class Server {
   /**
    * @brief   Function wrapper around the message callback
    * @param   client Pointer to the client which has received a message
-   * @param   message String message value that has been received
+   * @param   message Complete frame that has been received, only valid during the call
    */
-  void messageReceived(ClientConnection *client, std::string &message);
+  void messageReceived(ClientConnection *client, std::string_view message);
 
   /**
    * @brief   Function wrapper to transmit a message
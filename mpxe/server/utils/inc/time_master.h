@@ -0,0 +1,137 @@
+#pragma once
+
+/************************************************************************************************
+ * @file   time_master.h
+ *
+ * @brief  Header file defining the TimeMaster class
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/* Inter-component Headers */
+#include <pthread.h>
+
+/* Intra-component Headers */
+#include "client_connection.h"
+#include "server.h"
+
+/**
+ * @defgroup Server_Utils
+ * @brief    Server Utilities and Infrastructure
+ * @{
+ */
+
+/**
+ * @class   TimeMaster
+ * @brief   Class that advances the virtual time of all lockstep clients together
+ * @details Clients running FreeRTOS in virtual time join by acknowledging the tick they have
+ *          reached. The time master grants every participant the same target tick and only
+ *          grants the next quantum once all participants have acknowledged the current one,
+ *          so no node can run ahead of another by more than one quantum.
+ *          A client that joins late catches up one quantum at a time while the other participants
+ *          wait at the current target, so no single grant runs more than a quantum of timers.
+ *          Disconnected clients are dropped from the barrier
+ */
+class TimeMaster {
+ private:
+  static constexpr unsigned int PRUNE_PERIOD_MS = 100U; /**< Period to check the barrier for disconnected clients */
+
+  /**
+   * @brief   Virtual time state of a single participant
+   */
+  struct Participant {
+    uint64_t ackedTick;   /**< Last tick the participant acknowledged */
+    uint64_t grantedTick; /**< Last tick granted to the participant */
+  };
+
+  Server *m_server;              /**< Pointer to the server instance */
+  pthread_t m_timeMasterId;      /**< Thread Id for granting time quanta */
+  pthread_mutex_t m_mutex;       /**< Mutex to protect the participant list */
+  pthread_cond_t m_ackCondition; /**< Condition signalled whenever a participant acknowledges */
+  std::atomic<bool> m_isRunning; /**< Boolean flag to indicate the time master status */
+
+  uint32_t m_quantumTicks; /**< Number of ticks granted per barrier */
+  uint64_t m_grantedTick;  /**< Tick that every participant may advance up to */
+
+  std::unordered_map<std::string, Participant> m_participants; /**< Map of participating client names to their virtual time state */
+
+  /**
+   * @brief   Check if every participant has reached the granted tick
+   * @details m_mutex must be held by the caller
+   * @return  TRUE if the next quantum can be granted
+   */
+  bool barrierReached() const;
+
+  /**
+   * @brief   Remove participants that are no longer connected to the server
+   * @details m_mutex must be held by the caller
+   */
+  void pruneDisconnected();
+
+  /**
+   * @brief   Send the granted tick to a single client
+   * @param   clientName Name of the client to be granted time
+   * @param   tick Tick the client may advance up to
+   */
+  void sendGrant(std::string clientName, uint64_t tick);
+
+ public:
+  static constexpr uint32_t DEFAULT_QUANTUM_TICKS = 10U; /**< Default number of ticks granted per barrier */
+
+  /**
+   * @brief   Constructs a TimeMaster object
+   * @details Initializes the mutex and condition. Time is not granted until start() is called
+   */
+  TimeMaster();
+
+  /**
+   * @brief   Destructs a TimeMaster object
+   * @details This shall stop the time master thread and delete the mutex and condition
+   */
+  ~TimeMaster();
+
+  /**
+   * @brief   Thread procedure for granting time quanta
+   * @details This thread shall be blocked until every participant has reached the granted tick
+   */
+  void timeMasterProcedure();
+
+  /**
+   * @brief   Start granting time quanta to lockstep clients
+   * @details This function will spawn the timeMasterProcedure thread
+   * @param   server Pointer to the server instance used to reach the clients
+   * @param   quantumTicks Number of ticks granted per barrier
+   */
+  void start(Server *server, uint32_t quantumTicks = DEFAULT_QUANTUM_TICKS);
+
+  /**
+   * @brief   Stop granting time quanta
+   * @details Participants remain blocked at their last granted tick
+   */
+  void stop();
+
+  /**
+   * @brief   Update the barrier given a TIME_ACK payload
+   * @details The first acknowledgement of a client adds it to the barrier. A client behind the current
+   *          target is granted at most one quantum past its acknowledged tick until it has caught up
+   * @param   client Pointer to the acknowledging client
+   * @param   payload Message data payload to be parsed
+   */
+  void handleAck(ClientConnection *client, std::string_view payload);
+
+  /**
+   * @brief   Get the tick that participants may advance up to
+   * @return  Granted tick
+   */
+  uint64_t getGrantedTick();
+};
+
+/** @} */
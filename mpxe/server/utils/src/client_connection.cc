@@ -27,10 +27,12 @@ std::string ClientConnection::getClientAddress() const {
 ClientConnection::ClientConnection(Server *server) {
   this->server = server;
   m_isConnected = false;
+  pthread_mutex_init(&m_sendMutex, nullptr);
 }
 
 ClientConnection::~ClientConnection() {
   close(m_clientSocket);
+  pthread_mutex_destroy(&m_sendMutex);
 }
 
 bool ClientConnection::acceptClient(int listeningSocket) {
@@ -59,10 +61,18 @@ void ClientConnection::sendMessage(const std::string &message) {
     throw std::runtime_error("Attempting to send on unconnected socket");
   }
 
-  size_t bytesSent = write(m_clientSocket, message.c_str(), message.length());
-  if (bytesSent != message.length()) {
-    throw std::runtime_error("Failed to send complete message");
+  pthread_mutex_lock(&m_sendMutex);
+  try {
+    transmitFrame(m_clientSocket, message);
+  } catch (std::exception &e) {
+    pthread_mutex_unlock(&m_sendMutex);
+    throw;
   }
+  pthread_mutex_unlock(&m_sendMutex);
+}
+
+ReceiveBuffer::Status ClientConnection::receiveMessages(const ReceiveBuffer::frameCallback &callback) {
+  return m_receiveBuffer.drainSocket(m_clientSocket, callback);
 }
 
 std::string ClientConnection::getClientName() const {
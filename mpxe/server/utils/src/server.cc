@@ -10,6 +10,7 @@
 /* Standard library Headers */
 #include <string.h>
 
+#include <cerrno>
 #include <cstring>
 #include <iostream>
 
@@ -66,7 +67,7 @@ void Server::listenNewClientsProcedure() {
     struct epoll_event clientEvent;
 
     /* Edge-triggered input */
-    clientEvent.events = EPOLLIN | EPOLLET;
+    clientEvent.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
     clientEvent.data.ptr = client;
 
     if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, client->getSocketFd(), &clientEvent) < 0) {
@@ -86,9 +87,7 @@ void Server::listenNewClientsProcedure() {
 }
 
 void Server::epollClientsProcedure() {
-  int numBytes = 0;
   int nfds = 0;
-  char buffer[MAX_CLIENT_READ_SIZE + 1];
 
   if (m_epollFd < 0) {
     throw std::runtime_error("Invalid epoll FD");
@@ -99,6 +98,10 @@ void Server::epollClientsProcedure() {
     nfds = epoll_wait(m_epollFd, m_epollEvents, MAX_SERVER_EPOLL_EVENTS, -1);
 
     if (nfds < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
       throw std::runtime_error("EPOLL wait failed");
       break;
     }
@@ -106,17 +109,18 @@ void Server::epollClientsProcedure() {
     for (int i = 0; i < nfds; i++) {
       ClientConnection *client = static_cast<ClientConnection *>(m_epollEvents[i].data.ptr);
 
-      if (m_epollEvents[i].events & EPOLLIN) {
-        numBytes = read(client->getSocketFd(), buffer, MAX_CLIENT_READ_SIZE);
+      if (m_epollEvents[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        ReceiveBuffer::Status status = ReceiveBuffer::Status::CLOSED;
 
-        if (numBytes < 0) {
-          throw std::runtime_error("EPOLL Read failed");
-          break;
+        try {
+          status = client->receiveMessages([this, client](std::string_view frame) { messageReceived(client, frame); });
+        } catch (std::exception &e) {
+          std::cerr << "Dropping client " << client->getClientName() << ": " << e.what() << std::endl;
         }
 
-        buffer[numBytes] = '\0';
-        std::string msg(buffer, numBytes);
-        messageReceived(client, msg);
+        if (status == ReceiveBuffer::Status::CLOSED) {
+          removeClient(client);
+        }
       }
     }
   }
@@ -202,8 +206,13 @@ void Server::updateClientName(ClientConnection *client, std::string newName) {
   pthread_mutex_unlock(&m_mutex);
 }
 
-void Server::messageReceived(ClientConnection *client, std::string &message) {
-  m_messageCallback(this, client, message);
+void Server::messageReceived(ClientConnection *client, std::string_view message) {
+  try {
+    m_messageCallback(this, client, message);
+  } catch (std::exception &e) {
+    /* A single bad message shall not take down the connection */
+    std::cerr << "Failed to handle message from " << client->getClientName() << ": " << e.what() << std::endl;
+  }
 }
 
 void Server::sendMessage(ClientConnection *client, const std::string &message) {
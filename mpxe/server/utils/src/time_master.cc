@@ -0,0 +1,204 @@
+/************************************************************************************************
+ * @file   time_master.cc
+ *
+ * @brief  Source file defining the TimeMaster class
+ *
+ * @date   2026-10-16
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <algorithm>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+/* Inter-component Headers */
+#include "time_sync_datagram.h"
+
+/* Intra-component Headers */
+#include "time_master.h"
+
+TimeMaster::TimeMaster() {
+  m_server = nullptr;
+  m_isRunning = false;
+  m_quantumTicks = DEFAULT_QUANTUM_TICKS;
+  m_grantedTick = 0U;
+
+  pthread_mutex_init(&m_mutex, nullptr);
+  pthread_cond_init(&m_ackCondition, nullptr);
+}
+
+TimeMaster::~TimeMaster() {
+  stop();
+  pthread_cond_destroy(&m_ackCondition);
+  pthread_mutex_destroy(&m_mutex);
+}
+
+bool TimeMaster::barrierReached() const {
+  if (m_participants.empty()) {
+    return false;
+  }
+
+  for (auto &pair : m_participants) {
+    if (pair.second.ackedTick < m_grantedTick) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void TimeMaster::pruneDisconnected() {
+  for (auto it = m_participants.begin(); it != m_participants.end();) {
+    std::string clientName = it->first;
+
+    if (m_server->getClientByName(clientName) == nullptr) {
+      std::cout << "Removed " << clientName << " from the virtual time barrier" << std::endl;
+      it = m_participants.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void TimeMaster::sendGrant(std::string clientName, uint64_t tick) {
+  ClientConnection *client = m_server->getClientByName(clientName);
+
+  if (client == nullptr || !client->isConnected()) {
+    return;
+  }
+
+  Datagram::TimeSync::Payload grant = { .tick = tick };
+  client->sendMessage(Datagram::TimeSync(grant).serialize(CommandCode::TIME_GRANT));
+}
+
+void TimeMaster::timeMasterProcedure() {
+  while (m_isRunning) {
+    pthread_mutex_lock(&m_mutex);
+
+    while (m_isRunning && !barrierReached()) {
+      struct timespec timeout;
+      clock_gettime(CLOCK_REALTIME, &timeout);
+      timeout.tv_nsec += PRUNE_PERIOD_MS * 1000000L;
+      if (timeout.tv_nsec >= 1000000000L) {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
+      }
+
+      if (pthread_cond_timedwait(&m_ackCondition, &m_mutex, &timeout) != 0) {
+        pruneDisconnected();
+      }
+    }
+
+    if (!m_isRunning) {
+      pthread_mutex_unlock(&m_mutex);
+      break;
+    }
+
+    m_grantedTick += m_quantumTicks;
+    uint64_t grantedTick = m_grantedTick;
+
+    std::vector<std::string> participants;
+    participants.reserve(m_participants.size());
+    for (auto &pair : m_participants) {
+      pair.second.grantedTick = grantedTick;
+      participants.push_back(pair.first);
+    }
+
+    pthread_mutex_unlock(&m_mutex);
+
+    /* Sockets are written without the lock so acknowledgements are never held up */
+    for (auto &clientName : participants) {
+      try {
+        sendGrant(clientName, grantedTick);
+      } catch (std::exception &e) {
+        std::cerr << "Failed to grant time to " << clientName << ": " << e.what() << std::endl;
+      }
+    }
+  }
+}
+
+void *timeMasterProcedureWrapper(void *param) {
+  TimeMaster *timeMaster = static_cast<TimeMaster *>(param);
+
+  try {
+    timeMaster->timeMasterProcedure();
+  } catch (std::exception &e) {
+    std::cerr << "Time Master Thread Error: " << e.what() << std::endl;
+  }
+
+  return nullptr;
+}
+
+void TimeMaster::start(Server *server, uint32_t quantumTicks) {
+  if (m_isRunning) return;
+
+  if (server == nullptr || quantumTicks == 0U) {
+    throw std::runtime_error("Invalid time master configuration");
+  }
+
+  m_server = server;
+  m_quantumTicks = quantumTicks;
+  m_isRunning = true;
+
+  if (pthread_create(&m_timeMasterId, nullptr, timeMasterProcedureWrapper, this)) {
+    m_isRunning = false;
+    throw std::runtime_error("Time Master Error");
+  }
+}
+
+void TimeMaster::stop() {
+  if (!m_isRunning) return;
+
+  pthread_mutex_lock(&m_mutex);
+  m_isRunning = false;
+  pthread_cond_broadcast(&m_ackCondition);
+  pthread_mutex_unlock(&m_mutex);
+
+  pthread_join(m_timeMasterId, nullptr);
+}
+
+void TimeMaster::handleAck(ClientConnection *client, std::string_view payload) {
+  Datagram::TimeSync ack;
+  ack.deserialize(payload);
+
+  std::string clientName = client->getClientName();
+  uint64_t ackedTick = ack.getTick();
+  uint64_t catchUpTick = 0U;
+
+  pthread_mutex_lock(&m_mutex);
+  bool isNewParticipant = (m_participants.count(clientName) == 0U);
+  Participant &participant = m_participants[clientName];
+
+  participant.ackedTick = ackedTick;
+  if (isNewParticipant) {
+    participant.grantedTick = ackedTick;
+  }
+
+  /* A client behind the barrier catches up one quantum per acknowledgement, the barrier thread only grants the next target */
+  if (ackedTick >= participant.grantedTick && participant.grantedTick < m_grantedTick) {
+    participant.grantedTick = std::min(ackedTick + m_quantumTicks, m_grantedTick);
+    catchUpTick = participant.grantedTick;
+  }
+
+  pthread_cond_signal(&m_ackCondition);
+  pthread_mutex_unlock(&m_mutex);
+
+  if (isNewParticipant) {
+    std::cout << "Added " << clientName << " to the virtual time barrier at tick " << ackedTick << std::endl;
+  }
+
+  if (catchUpTick != 0U) {
+    sendGrant(clientName, catchUpTick);
+  }
+}
+
+uint64_t TimeMaster::getGrantedTick() {
+  pthread_mutex_lock(&m_mutex);
+  uint64_t grantedTick = m_grantedTick;
+  pthread_mutex_unlock(&m_mutex);
+
+  return grantedTick;
+}
@@ -87,6 +87,7 @@ common_flags = [
     '-fdata-sections',
     '-fsingle-precision-constant',
     '-fno-math-errno',
+    '-ffp-contract=off',
     '-Wl,--gc-sections',
     '-Wl,-Map=build/out.map',
     '--specs=nosys.specs',
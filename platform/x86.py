@@ -18,6 +18,7 @@ commonflags = [
     '-Wno-unused-parameter',
     '-Wno-unused-value',
     '-Wpointer-arith',
+    '-ffp-contract=off',
     '-ffunction-sections',
     '-fdata-sections',
     '-I/usr/local/include',
@@ -115,4 +115,20 @@ BootloaderError boot_can_transmit(uint32_t id, bool extended, const uint8_t *dat
  */
 BootloaderError boot_can_receive(Boot_CanMessage *const msg);
 
+#ifdef MS_PLATFORM_X86
+
+/** @brief  SocketCAN interface used when none is selected */
+#define BOOT_CAN_DEFAULT_INTERFACE "vcan0"
+
+/** @brief  Time boot_can_receive waits for a message before giving up */
+#define BOOT_CAN_RECEIVE_TIMEOUT_MS 1U
+
+/**
+ * @brief   Select the SocketCAN interface opened by boot_can_init
+ * @param   interface Network interface name, such as "vcan0"
+ */
+void boot_can_set_interface(const char *interface);
+
+#endif
+
 /** @} */
@@ -46,6 +46,7 @@ typedef enum {
   BOOTLOADER_CAN_JUMP_BOOTLOADER ,         /**< Jump to bootloader command */
   BOOTLOADER_CAN_PING_METADATA_ID,         /**< Incoming ping metadata */
   BOOTLOADER_CAN_PING_DATA_ID,             /**< Incoming ping data */
+  BOOTLOADER_CAN_WINDOW_ACK_ID,            /**< Cumulative page ACK while flashing with a window */
 } BootloaderCanID;
 
 /**
@@ -62,8 +63,9 @@ typedef struct {
      * @brief   Start message definition
      */
     struct {
-      uint16_t node_ids; /**< Target MCU Id */
-      uint32_t data_len; /**< Incoming data length (ie: Binary size) */
+      uint16_t node_ids;    /**< Target MCU Id */
+      uint32_t data_len;    /**< Incoming data length (ie: Binary size) */
+      uint8_t window_pages; /**< Pages the host wants in flight, 0 to flash one page at a time */
     } start;
 
     /**
@@ -123,4 +125,14 @@ BootloaderDatagram deserialize_datagram(Boot_CanMessage *msg, uint16_t *target_n
  */
 void send_ack_datagram(bool ack, BootloaderError error);
 
+/**
+ * @brief   Send a cumulative page ACK over CAN while flashing with a window
+ * @details Payload is the next expected sequence number (2 bytes), the running CRC32 of every
+ *          acknowledged page (4 bytes) and the granted window (1 byte), all little-endian
+ * @param   next_sequence_num Every page before this sequence number is written and verified
+ * @param   image_crc32 Running CRC32 of the image up to next_sequence_num
+ * @param   window_pages Number of pages the host may keep in flight
+ */
+void send_window_ack_datagram(uint16_t next_sequence_num, uint32_t image_crc32, uint8_t window_pages);
+
 /** @} */
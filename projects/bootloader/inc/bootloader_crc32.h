@@ -43,6 +43,17 @@ BootloaderError boot_crc32_init(void);
  */
 uint32_t boot_crc32_calculate(const uint32_t *buffer, size_t buffer_len);
 
+/**
+ * @brief   Continue a CRC32 calculation from a previous result
+ * @details Accumulating a buffer in several calls, starting from 0xFFFFFFFF, gives the same
+ *          result as one boot_crc32_calculate call over the whole buffer
+ * @param   crc32 CRC32 of the data so far, 0xFFFFFFFF for no data
+ * @param   buffer Pointer to the data buffer to be checksummed
+ * @param   buffer_len Length of the data buffer in words
+ * @return  Calculated 32-bit CRC value
+ */
+uint32_t boot_crc32_accumulate(uint32_t crc32, const uint32_t *buffer, size_t buffer_len);
+
 /**
  * @brief   Align a provided data buffer to the 4-byte boundary
  * @details This prevents hard faults when writing to flash memory, ensuring all our flash is 4-byte aligned
@@ -25,6 +25,9 @@
  * @{
  */
 
+/** @brief  Largest window a host may be granted, in pages */
+#define BOOTLOADER_DFU_MAX_WINDOW_PAGES 8U
+
 /** @brief Stores info needed for the DFU process */
 typedef struct {
   uintptr_t application_start;       /**< Application start address */
@@ -48,6 +51,40 @@ BootloaderError bootloader_dfu_init(uintptr_t current_write_address);
  */
 BootloaderError bootloader_dfu_flash(PacketManager *pm, uint8_t *flash_buffer);
 
+/**
+ * @brief   Prepare to flash with several pages in flight
+ * @details Erases every page the image covers, so incoming data can be programmed as soon as it
+ *          arrives, and grants the host a window of at most BOOTLOADER_DFU_MAX_WINDOW_PAGES
+ * @param   pm Pointer to the packet manager
+ * @return  `BOOTLOADER_ERROR_NONE` on success
+ *          `BOOTLOADER_OVERSIZE` if the image does not fit in the application region
+ *          `BOOTLOADER_FLASH_ERR` if the erase failed
+ */
+BootloaderError bootloader_dfu_window_start(PacketManager *pm);
+
+/**
+ * @brief   Program one data message into the open page
+ * @details Once the page is complete it is read back, checked against the page CRC32, added to
+ *          the image CRC32 and acknowledged cumulatively
+ * @param   pm Pointer to the packet manager
+ * @param   data Message payload of DGRAM_MAX_MSG_SIZE bytes
+ * @param   page_buffer Page sized scratch buffer for the read back
+ * @return  `BOOTLOADER_ERROR_NONE` unless a flash operation failed, a bad page is NACKed and
+ *          dropped so the host can resend it
+ */
+BootloaderError bootloader_dfu_window_write(PacketManager *pm, uint8_t *data, uint8_t *page_buffer);
+
+/**
+ * @brief   Drop the open page and NACK it
+ * @details Re-erases the page if it was partially programmed. Data is ignored until the host
+ *          resends the page's sequencing message
+ * @param   pm Pointer to the packet manager
+ * @param   error Reason sent with the NACK
+ * @return  `BOOTLOADER_ERROR_NONE` on success
+ *          `BOOTLOADER_FLASH_ERR` if the page could not be erased
+ */
+BootloaderError bootloader_dfu_window_reject(PacketManager *pm, BootloaderError error);
+
 /**
  * @brief   Jumps to application vector table
  * @return  Should never return
@@ -59,4 +96,15 @@ BootloaderError bootloader_jump_app();
  * @return  BootloaderError 
  */
 BootloaderError bootloader_fault();
+
+#ifdef MS_PLATFORM_X86
+
+/**
+ * @brief   Get the address the simulated bootloader jumped to
+ * @details On x86 bootloader_jump_app records the application vector table instead of jumping
+ * @return  Application vector table address, 0 if no jump was requested
+ */
+uintptr_t bootloader_dfu_peek_jump_address(void);
+
+#endif
 /** @} */
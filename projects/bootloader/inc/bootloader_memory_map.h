@@ -23,6 +23,55 @@
  * @{
  */
 
+#ifdef MS_PLATFORM_X86
+
+/** @brief  Flash start address as defined in the linkerscripts */
+#define FLASH_START_ADDRESS_LINKERSCRIPT ((uint32_t)0x08000000U)
+
+/** @brief  Flash size as defined in the linkerscripts (e.g., 256KB) */
+#define FLASH_SIZE_LINKERSCRIPT ((size_t)(256U * 1024U))
+
+/** @brief  Flash page size as defined in the linkerscripts (e.g., 2KB per page) */
+#define FLASH_PAGE_SIZE_LINKERSCRIPT ((size_t)(2U * 1024U))
+
+/** @brief  Application Active start address as defined in the linkerscripts */
+#define APP_ACTIVE_START_ADDRESS ((uint32_t)(FLASH_START_ADDRESS_LINKERSCRIPT + 0x18000U))
+
+/** @brief  Application Active size (e.g., 80KB) */
+#define APP_ACTIVE_SIZE ((size_t)(80U * 1024U))
+
+/** @brief  Application Staging start address as defined in the linkerscripts */
+#define APP_STAGING_START_ADDRESS ((uint32_t)(FLASH_START_ADDRESS_LINKERSCRIPT + 0x2A000U))
+
+/** @brief  Application Staging size (e.g., 80KB) */
+#define APP_STAGING_SIZE ((size_t)(80U * 1024U))
+
+/** @brief  Bootloader start address as defined in the linkerscripts */
+#define BOOTLOADER_START_ADDRESS ((uint32_t)(FLASH_START_ADDRESS_LINKERSCRIPT + 0x8000U))
+
+/** @brief  Bootloader size (e.g., 64KB) */
+#define BOOTLOADER_SIZE ((size_t)(64U * 1024U))
+
+/** @brief  Bootstrap start address as defined in the linkerscripts */
+#define BOOTSTRAP_START_ADDRESS ((uint32_t)(FLASH_START_ADDRESS_LINKERSCRIPT))
+
+/** @brief  Bootstrap size (e.g., 32KB) */
+#define BOOTSTRAP_SIZE ((size_t)(32U * 1024U))
+
+/** @brief  File System Storage start address as defined in the linkerscripts */
+#define FS_STORAGE_START_ADDRESS ((uint32_t)(FLASH_START_ADDRESS_LINKERSCRIPT + 0x3C000U))
+
+/** @brief  File System Storage size (e.g., 4KB) */
+#define FS_STORAGE_SIZE ((size_t)(4U * 1024U))
+
+/** @brief  SRAM start address as defined in the linkerscripts */
+#define SRAM_START_ADDRESS ((uint32_t)0x20000000U)
+
+/** @brief  SRAM size as defined in the linkerscripts (e.g., 64KB) */
+#define SRAM_SIZE ((size_t)(64U * 1024U))
+
+#else
+
 extern uint32_t _flash_start;
 extern uint32_t _flash_size;
 extern uint32_t _flash_page_size;
@@ -90,4 +139,6 @@ extern uint32_t _sram_size;
 /** @brief  SRAM size as defined in the linkerscripts */
 #define SRAM_SIZE ((size_t) & _sram_size)
 
+#endif
+
 /** @} */
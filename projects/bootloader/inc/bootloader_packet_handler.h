@@ -38,6 +38,10 @@ typedef struct {
   uint16_t target_nodes;             /**< Target MCU Ids */                                          
   bool first_byte_received;          /**< Boolean flag to track if the first byte was received */   
   bool first_ping_received;          /**< Boolean flag to track if the first ping was received */   
+  uint32_t image_crc32;              /**< Running CRC32 of every verified page while flashing with a window */
+  uint8_t window_pages;              /**< Pages the host may keep in flight, 0 to flash one page at a time */
+  bool is_page_open;                 /**< A sequencing packet was accepted and its page is being programmed */
+  bool is_discarding;                /**< Ignore data until the expected sequence number is resent */
 } PacketManager; 
 
 /**
@@ -49,10 +53,11 @@ BootloaderError packet_handler_init(PacketManager *pm);
 
 /**
  * @brief   Function call for the `BOOTLOADER_START` state
- * @details Primes everything to start receiving data
+ * @details Primes everything to start receiving data. A non-zero window in the start message
+ *          erases the application up front so pages can be programmed as they stream in
  * @param   pm Pointer to the `PacketManager` struct
  * @param   datagram A pointer to the incoming datagram
- * @return  BOOTLOADER_DATA_NOT_ALIGNED, BOOTLOADER_ERROR_NONE
+ * @return  BOOTLOADER_DATA_NOT_ALIGNED, BOOTLOADER_OVERSIZE, BOOTLOADER_FLASH_ERR, BOOTLOADER_ERROR_NONE
  */
 BootloaderError bootloader_start(PacketManager *pm, BootloaderDatagram *datagram);
 
@@ -68,7 +73,9 @@ BootloaderError bootloader_receive_data(PacketManager *pm, BootloaderDatagram *d
 
 /**
  * @brief   Function call for `BOOTLOADER_WAIT_SEQUENCING` state
- * @details Validates datagram packets, in terms of sequencing, to ensure packets were not missed
+ * @details Validates datagram packets, in terms of sequencing, to ensure packets were not missed.
+ *          While flashing with a window, sequence errors are NACKed and recovered from when the
+ *          host resends the expected page
  * @param   pm Pointer to the `PacketManager` struct
  * @param   datagram Pointer to incoming datagram
  * @return  BOOTLOADER_ERROR_NONE if successful else BOOTLOADER_SEQUENCE_ERROR
@@ -6,5 +6,6 @@ START = 34
 JUMP_BOOTLOADER = 35
 PING_METADATA = 36
 PING_DATA = 37
+WINDOW_ACK = 38
 
 STANDARD_CRC32_POLY = 0x04C11DB7
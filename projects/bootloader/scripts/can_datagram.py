@@ -15,6 +15,17 @@ MIN_BYTEARRAY_SIZE = 4
 NODE_IDS_OFFSET = 0
 DATA_SIZE_OFFSET = 2
 
+PAGE_SIZE = 2048
+CHUNK_SIZE = 8
+DEFAULT_WINDOW_PAGES = 4
+ERASE_TIMEOUT = 10.0
+ACK_TIMEOUT = 5.0
+WINDOW_ACK_TIMEOUT = 5.0
+MAX_REWINDS = 5
+
+ACK_STATUS = 0x00
+NACK_STATUS = 0x01
+
 crc32 = CRC32(STANDARD_CRC32_POLY)
 
 class DatagramTypeError(Exception):
@@ -170,130 +181,150 @@ class DatagramSender:
             receive_own_messages=receive_own_messages)
 
     def send(self, message, sender_id=0):
-        '''Send a Datagram over CAN'''
+        '''Send a start Datagram over CAN and wait for every node to acknowledge it'''
         assert isinstance(message, Datagram)
         datagram = message.pack()
         datagram.extend(message.data)
 
-        message_extended_arbitration = False
-        can_message = can.Message(arbitration_id=message._datagram_type_id,
-                                  data=datagram,
-                                  is_extended_id=message_extended_arbitration)
-        self.bus.send(can_message)
+        self.bus.send(can.Message(arbitration_id=message.datagram_type_id, data=datagram, is_extended_id=False))
         update_log("Message was sent on {}".format(self.bus.channel_info))
 
-        ack_received = False
-        retry_count = 0
-        max_retries = 3
-        
-        while not ack_received and retry_count < max_retries:
-            try:
-                ack_msg = self.bus.recv(timeout=5.0)
-                
-                if ack_msg and ack_msg.arbitration_id == ACK:
-                    if ack_msg.data[0] == 0x01:
-                        ack_received = True
-                        update_log(f"Received ACK for start message")
-                    elif ack_msg.data[0] == 0x00:
-                        update_log(f"Received NACK for start message, aborting")
-                        break
-                    else:
-                        update_log(f"Received unknown response for start message, retrying...")
-                        retry_count += 1
-                else:
-                    update_log(f"No ACK/NACK received for start message, retrying...")
-                    retry_count += 1
-                
-            except can.CanError:
-                update_log(f"Error waiting for ACK/NACK for start message, retrying...", error=True)
-                retry_count += 1
-        
-        if not ack_received:
-            raise Exception(f"Failed to receive ACK for start message after {max_retries} attempts")
-    
-
+        self._wait_for_acks(len(message.node_ids), "start message")
         update_log(f"Start message received successfully!")
 
     def send_data(self, message, sender_id=0):
-        '''Send a Datagram over CAN'''
+        '''Send a Datagram over CAN one page at a time, waiting for every node to acknowledge each page'''
+        assert isinstance(message, Datagram)
+        start_time = time.time()
+        pages = [bytes(page) for page in self._chunkify(message.data, PAGE_SIZE)]
+
+        for sequence_number, page in enumerate(pages):
+            self._send_page(sequence_number, page, message.datagram_type_id)
+            update_log(f"Sent {len(page)} bytes for sequence {sequence_number}")
+            self._wait_for_acks(len(message.node_ids), f"sequence {sequence_number}")
+
+        end_time = time.time()
+
+        update_log("--------------------------------- COMPLETED ---------------------------------")
+        update_log(f"Time Elapsed: {end_time - start_time}")
+        update_log(f"All data sent successfully. Total sequences: {len(pages)}\n")
+
+    def send_data_windowed(self, start_message, message, window_pages=DEFAULT_WINDOW_PAGES):
+        '''Flash with several pages in flight, each node acknowledges pages cumulatively with a running CRC'''
+        assert isinstance(start_message, Datagram)
         assert isinstance(message, Datagram)
         start_time = time.time()
-        message_extended_arbitration = bool(message.message_extended_arbitration)
-        chunk_messages = list(self._chunkify(message.data, 8))
-        sequence_number = 0
-        
-        while chunk_messages:
-            seq_num_bytes = sequence_number.to_bytes(2, byteorder='little')
-            
-            # Prepare up to 1024 bytes (128 chunks of 8 bytes each)
-            current_chunk = chunk_messages[:128]
-            chunk_messages = chunk_messages[128:]
-            
-            crc_chunk = b''.join(current_chunk)
-            crc32_value = crc32.calculate(crc_chunk)
-            crc_data = crc32_value.to_bytes(4, byteorder='little')
-            
-            sequencing_data = seq_num_bytes + crc_data
-            
-            # Send sequence message
-            sequence_msg = can.Message(arbitration_id=SEQUENCING,
-                                    data=sequencing_data,
-                                    is_extended_id=message_extended_arbitration)
-            
-            self.bus.send(sequence_msg)
-
-            # Send data chunks (up to 1024 bytes)
-            for chunk in current_chunk:
-                try:
-                    data_msg = can.Message(arbitration_id=message.datagram_type_id,
-                                        data=chunk,
-                                        is_extended_id=message_extended_arbitration)
-                    self.bus.send(data_msg)
-                except BaseException:
-                    time.sleep(0.01)
-                    self.bus.send(data_msg)
-            
-            update_log(f"Sent {len(current_chunk) * 8} bytes for sequence {sequence_number}")
-            
-            if sequence_number > 0 or chunk_messages:
-                ack_received = False
-                retry_count = 0
-                max_retries = 3
-                
-                while not ack_received and retry_count < max_retries:
-                    try:
-                        ack_msg = self.bus.recv(timeout=5.0)
-                        
-                        if ack_msg and ack_msg.arbitration_id == ACK:
-                            if ack_msg.data[0] == 0x01:
-                                ack_received = True
-                                update_log(f"Received ACK for sequence {sequence_number}\n")
-                            elif ack_msg.data[0] == 0x00:
-                                update_log(f"Received NACK for sequence {sequence_number}, retrying...")
-                                retry_count += 1
-                                break
-                            else:
-                                update_log(f"Received unknown response for sequence {sequence_number}, retrying...")
-                                retry_count += 1
-                        else:
-                            update_log(f"No ACK/NACK received for sequence {sequence_number}, retrying...")
-                            retry_count += 1
-                        
-                    except can.CanError:
-                        update_log(f"Error waiting for ACK/NACK for sequence {sequence_number}, retrying...", error=True)
-                        retry_count += 1
-                
-                if not ack_received:
-                    raise Exception(f"Failed to receive ACK for sequence {sequence_number} after {max_retries} attempts")
-            
-            sequence_number += 1
-        
+        num_nodes = len(start_message.node_ids)
+        pages = [bytes(page) for page in self._chunkify(message.data, PAGE_SIZE)]
+
+        # STM32 CRC expected in the cumulative ACK at every page boundary
+        image_crcs = [0xFFFFFFFF]
+        for page in pages:
+            image_crcs.append(self._stm32_crc32(page, image_crcs[-1]))
+
+        start_data = start_message.pack()
+        start_data.extend(start_message.data)
+        start_data.append(window_pages & 0xff)
+        self.bus.send(can.Message(arbitration_id=START, data=start_data, is_extended_id=False))
+
+        # Nodes erase the whole image before acknowledging the start message
+        acks = {}
+        while acks.get(0, 0) < num_nodes:
+            msg = self.bus.recv(timeout=ERASE_TIMEOUT)
+            if msg is None:
+                raise Exception("Failed to receive window ACK for start message")
+            if msg.arbitration_id == ACK:
+                if msg.data[0] != ACK_STATUS:
+                    raise Exception(f"Received NACK for start message with error {msg.data[2]}")
+                if acks:
+                    raise Exception("Bootloaders with and without windowed flashing cannot be flashed together")
+                update_log("Bootloader does not support windowed flashing, sending one page at a time")
+                self._wait_for_acks(num_nodes - 1, "start message")
+                return self.send_data(message)
+            if msg.arbitration_id == WINDOW_ACK:
+                next_sequence, _, granted_pages = self._unpack_window_ack(msg.data)
+                acks[next_sequence] = acks.get(next_sequence, 0) + 1
+                window_pages = min(window_pages, granted_pages)
+
+        update_log(f"Start message received successfully, sending {len(pages)} pages with a window of {window_pages}")
+
+        base = 0
+        next_page = 0
+        rewinds = 0
+        while base < len(pages):
+            while next_page < len(pages) and next_page < base + window_pages:
+                self._send_page(next_page, pages[next_page], message.datagram_type_id)
+                next_page += 1
+
+            msg = self.bus.recv(timeout=WINDOW_ACK_TIMEOUT)
+
+            if msg is None or (msg.arbitration_id == ACK and msg.data[0] == NACK_STATUS):
+                # Every node drops data until it sees the page it expects, so resend from the oldest unacknowledged one
+                rewinds += 1
+                if rewinds > MAX_REWINDS:
+                    raise Exception(f"Failed to flash sequence {base} after {MAX_REWINDS} attempts")
+                update_log(f"Resending from sequence {base}...")
+                next_page = base
+                continue
+
+            if msg.arbitration_id != WINDOW_ACK:
+                continue
+
+            next_sequence, image_crc, _ = self._unpack_window_ack(msg.data)
+            if next_sequence > len(pages) or image_crc != image_crcs[next_sequence]:
+                raise Exception(f"Image CRC mismatch at sequence {next_sequence}")
+
+            acks[next_sequence] = acks.get(next_sequence, 0) + 1
+            while base < len(pages) and acks.get(base + 1, 0) >= num_nodes:
+                base += 1
+                rewinds = 0
+
         end_time = time.time()
 
         update_log("--------------------------------- COMPLETED ---------------------------------")
         update_log(f"Time Elapsed: {end_time - start_time}")
-        update_log(f"All data sent successfully. Total sequences: {sequence_number}\n")
+        update_log(f"All data sent successfully. Total sequences: {len(pages)}\n")
+
+    def _send_page(self, sequence_number, page, arbitration_id):
+        '''Send one sequencing message followed by the page data'''
+        sequencing_data = sequence_number.to_bytes(2, byteorder='little') + \
+            self._stm32_crc32(page).to_bytes(4, byteorder='little')
+        self.bus.send(can.Message(arbitration_id=SEQUENCING, data=sequencing_data, is_extended_id=False))
 
+        for chunk in self._chunkify(page, CHUNK_SIZE):
+            data_msg = can.Message(arbitration_id=arbitration_id, data=chunk, is_extended_id=False)
+            try:
+                self.bus.send(data_msg)
+            except can.CanError:
+                time.sleep(0.01)
+                self.bus.send(data_msg)
+
+    def _wait_for_acks(self, num_nodes, description):
+        '''Wait for an ACK from every node, a node that NACKs has faulted and flashing must start over'''
+        acks = 0
+        deadline = time.time() + ACK_TIMEOUT
+        while acks < num_nodes:
+            msg = self.bus.recv(timeout=max(deadline - time.time(), 0))
+            if msg is None:
+                raise Exception(f"Failed to receive ACK for {description} from {num_nodes - acks} node(s)")
+            if msg.arbitration_id != ACK:
+                continue
+            if msg.data[0] != ACK_STATUS:
+                raise Exception(f"Received NACK for {description} with error {msg.data[2]}")
+            acks += 1
+            update_log(f"Received ACK for {description}")
+
+    @staticmethod
+    def _stm32_crc32(data, init=0xFFFFFFFF):
+        '''CRC32 as calculated by the STM32 CRC unit, optionally continuing a previous result'''
+        return crc32.calculate(data, init) ^ 0xFFFFFFFF
+
+    @staticmethod
+    def _unpack_window_ack(data):
+        '''Returns the next expected sequence number, the running image CRC and the granted window'''
+        next_sequence = int.from_bytes(data[0:2], byteorder='little')
+        image_crc = int.from_bytes(data[2:6], byteorder='little')
+        return next_sequence, image_crc, data[6]
 
     @staticmethod
     def _chunkify(data, size):
@@ -8,8 +8,9 @@ class CRC32:
                 c = (c << 1) ^ _poly if (c & 0x80000000) else c << 1
             self.crc_table[i] = c & 0xFFFFFFFF
 
-    def calculate(self, buf):
-        crc = 0xFFFFFFFF
+    def calculate(self, buf, init=0xFFFFFFFF):
+        '''Returns the complement of the STM32 CRC unit result. Pass a previous STM32 result as init to continue it'''
+        crc = init
         buf_len = len(buf)
         i = 0
 
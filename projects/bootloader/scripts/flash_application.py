@@ -1,7 +1,9 @@
-from can_datagram import Datagram, DatagramSender
+from can_datagram import Datagram, DatagramSender, DEFAULT_WINDOW_PAGES
 import bootloader_id
+import argparse
 import os
-from log_manager import update_log
+import time
+from log_manager import update_log, use_console
 
 class Flash_Application:
     def __init__(self, bin_path, sender=None) -> None:
@@ -78,7 +80,32 @@ class Flash_Application:
             data=bin_content
         )
 
-        self._sender.send(start_datagram)
-        self._sender.send_data(flash_datagram)
+        # A window of 0 flashes one page at a time, waiting for each page to be acknowledged
+        window_pages = kwargs.get("window_pages", DEFAULT_WINDOW_PAGES)
+        if window_pages > 0:
+            self._sender.send_data_windowed(start_datagram, flash_datagram, window_pages)
+        else:
+            self._sender.send(start_datagram)
+            self._sender.send_data(flash_datagram)
 
         update_log(f'\n\nFinished sending flash requirements to boards {node_ids}...')
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Flash an application and report the end-to-end time per KB")
+    parser.add_argument("bin_path", help="Application binary to flash")
+    parser.add_argument("--channel", default="vcan0", help="SocketCAN channel, vcan0 for simulated nodes")
+    parser.add_argument("--nodes", type=int, nargs="+", default=[1], help="Node IDs to flash")
+    parser.add_argument("--window", type=int, default=DEFAULT_WINDOW_PAGES,
+                        help="Pages in flight, 0 waits for every page to be acknowledged")
+    args = parser.parse_args()
+
+    use_console()
+    app = Flash_Application(args.bin_path, DatagramSender(channel=args.channel))
+
+    start_time = time.time()
+    app.start_flash(node_ids=args.nodes, window_pages=args.window)
+    elapsed = time.time() - start_time
+
+    print(f"Flashed {app.bin_size} bytes to {len(args.nodes)} node(s) in {elapsed:.2f}s "
+          f"({elapsed * 1000 / (app.bin_size / 1024):.1f} ms/KB)")
@@ -1,4 +1,17 @@
+_console = False
+
+
+def use_console():
+    '''Print log messages instead of writing them to the GUI, for scripted runs without a display'''
+    global _console
+    _console = True
+
+
 def update_log(message, error=False):
+    if _console:
+        print(message)
+        return
+
     from gui import log_label, log_frame, canvas  # Import only inside function to prevent circular imports
 
     current_text = log_label.cget("text")
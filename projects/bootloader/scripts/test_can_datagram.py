@@ -4,7 +4,10 @@ import unittest
 import random
 import time
 
-from can_datagram import Datagram, DatagramSender, DatagramListener
+from unittest.mock import patch
+
+from can_datagram import Datagram, DatagramSender, DatagramListener, PAGE_SIZE, ACK_STATUS, NACK_STATUS
+from bootloader_id import ACK, FLASH, SEQUENCING, START, WINDOW_ACK
 import can
 
 TEST_CHANNEL = "vcan0"
@@ -98,6 +101,161 @@ class TestCanDatagramSender(unittest.TestCase):
         # self.assertEqual(message.pack(), bytearray(recv_datagram))
 
 
+class SimulatedBootloaderBus:
+    '''Bus answering like bootloader nodes flashing with a window, the first node corrupts one page once'''
+
+    def __init__(self, num_nodes, corrupt_sequence):
+        self.nodes = [{"flash": bytearray(), "expected": 0, "page": None, "discarding": False}
+                      for _ in range(num_nodes)]
+        self.corrupt_sequence = corrupt_sequence
+        self.responses = []
+        self.sequences_sent = []
+
+    def _respond(self, arbitration_id, data):
+        self.responses.append(can.Message(arbitration_id=arbitration_id, data=bytearray(data)))
+
+    def _window_ack(self, node):
+        crc = DatagramSender._stm32_crc32(bytes(node["flash"])) if node["flash"] else 0xFFFFFFFF
+        self._respond(WINDOW_ACK, node["expected"].to_bytes(2, 'little') + crc.to_bytes(4, 'little') + bytes([2, 0]))
+
+    def send(self, msg):
+        if msg.arbitration_id == SEQUENCING:
+            self.sequences_sent.append(int.from_bytes(msg.data[0:2], 'little'))
+        for index, node in enumerate(self.nodes):
+            if msg.arbitration_id == START:
+                self.data_size = int.from_bytes(msg.data[2:6], 'little')
+                self._window_ack(node)
+            elif msg.arbitration_id == SEQUENCING:
+                sequence = int.from_bytes(msg.data[0:2], 'little')
+                if sequence != node["expected"]:
+                    node["discarding"] = True
+                    continue
+                node["discarding"] = False
+                node["page"] = (int.from_bytes(msg.data[2:6], 'little'), bytearray())
+                node["expected"] += 1
+            elif msg.arbitration_id == FLASH and node["page"] is not None:
+                crc, page = node["page"]
+                page.extend(msg.data)
+                if len(node["flash"]) + len(page) < self.data_size and len(page) < PAGE_SIZE:
+                    continue
+                node["page"] = None
+                if index == 0 and node["expected"] - 1 == self.corrupt_sequence:
+                    self.corrupt_sequence = None
+                    crc ^= 1
+                if DatagramSender._stm32_crc32(bytes(page)) != crc:
+                    node["expected"] -= 1
+                    node["discarding"] = True
+                    self._respond(ACK, [1, 0, 0])
+                    continue
+                node["flash"].extend(page)
+                self._window_ack(node)
+
+    def recv(self, timeout=None):
+        return self.responses.pop(0) if self.responses else None
+
+
+class TestCanDatagramWindowedSender(unittest.TestCase):
+    '''Test flashing with several pages in flight'''
+
+    @patch("can_datagram.update_log")
+    def test_send_data_windowed(self, _):
+        image = bytearray(random.getrandbits(8) for _ in range(5 * PAGE_SIZE + 12))
+        bus = SimulatedBootloaderBus(num_nodes=2, corrupt_sequence=3)
+        sender = DatagramSender.__new__(DatagramSender)
+        sender.bus = bus
+
+        start = Datagram(datagram_type_id=START, node_ids=[1, 2], data=bytearray(len(image).to_bytes(4, 'little')))
+        flash = Datagram(datagram_type_id=FLASH, node_ids=[1, 2], data=image)
+        sender.send_data_windowed(start, flash, window_pages=4)
+
+        for node in bus.nodes:
+            self.assertEqual(node["flash"], image)
+
+        # The window is limited to the 2 pages the nodes grant, and the corrupted page is resent
+        self.assertEqual(bus.sequences_sent[:2], [0, 1])
+        self.assertEqual(bus.sequences_sent.count(3), 2)
+
+
+class LegacyBootloaderBus:
+    '''Bus answering like bootloader nodes that acknowledge every page before the next one is sent'''
+
+    def __init__(self, num_nodes):
+        self.nodes = [{"flash": bytearray(), "expected": 0, "page": None} for _ in range(num_nodes)]
+        self.channel_info = "legacy bootloader bus"
+        self.responses = []
+        self.sequences_sent = []
+
+    def _respond(self, status):
+        self.responses.append(can.Message(arbitration_id=ACK, data=bytearray([status, 0, 0])))
+
+    def send(self, msg):
+        assert not msg.is_extended_id
+        if msg.arbitration_id == SEQUENCING:
+            self.sequences_sent.append(int.from_bytes(msg.data[0:2], 'little'))
+        for node in self.nodes:
+            if msg.arbitration_id == START:
+                self.data_size = int.from_bytes(msg.data[2:6], 'little')
+                self._respond(ACK_STATUS)
+            elif msg.arbitration_id == SEQUENCING:
+                if int.from_bytes(msg.data[0:2], 'little') != node["expected"]:
+                    self._respond(NACK_STATUS)
+                    continue
+                node["page"] = (int.from_bytes(msg.data[2:6], 'little'), bytearray())
+                node["expected"] += 1
+            elif msg.arbitration_id == FLASH:
+                crc, page = node["page"]
+                page.extend(msg.data)
+                if len(node["flash"]) + len(page) < self.data_size and len(page) < PAGE_SIZE:
+                    continue
+                node["page"] = None
+                if DatagramSender._stm32_crc32(bytes(page)) != crc:
+                    self._respond(NACK_STATUS)
+                    continue
+                node["flash"].extend(page)
+                self._respond(ACK_STATUS)
+
+    def recv(self, timeout=None):
+        return self.responses.pop(0) if self.responses else None
+
+
+class TestCanDatagramLegacySender(unittest.TestCase):
+    '''Test flashing bootloaders one page at a time'''
+
+    def setUp(self):
+        self.image = bytearray(random.getrandbits(8) for _ in range(2 * PAGE_SIZE + 12))
+        self.bus = LegacyBootloaderBus(num_nodes=2)
+        self.sender = DatagramSender.__new__(DatagramSender)
+        self.sender.bus = self.bus
+        self.start = Datagram(datagram_type_id=START, node_ids=[1, 2],
+                              data=bytearray(len(self.image).to_bytes(4, 'little')))
+        self.flash = Datagram(datagram_type_id=FLASH, node_ids=[1, 2], data=self.image)
+
+    @patch("can_datagram.update_log")
+    def test_send_data(self, _):
+        self.sender.send(self.start)
+        self.sender.send_data(self.flash)
+
+        for node in self.bus.nodes:
+            self.assertEqual(node["flash"], self.image)
+        self.assertEqual(self.bus.sequences_sent, [0, 1, 2])
+
+    @patch("can_datagram.update_log")
+    def test_send_data_windowed_falls_back(self, _):
+        self.sender.send_data_windowed(self.start, self.flash, window_pages=4)
+
+        for node in self.bus.nodes:
+            self.assertEqual(node["flash"], self.image)
+        self.assertEqual(self.bus.sequences_sent, [0, 1, 2])
+
+    @patch("can_datagram.update_log")
+    def test_send_data_nack(self, _):
+        self.sender.send(self.start)
+        self.bus.nodes[1]["expected"] = 1
+
+        with self.assertRaises(Exception):
+            self.sender.send_data(self.flash)
+
+
 class TestCanDatagramListener(unittest.TestCase):
     '''Test CAN Datagram listening functions'''
 
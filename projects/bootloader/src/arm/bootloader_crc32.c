@@ -48,6 +48,20 @@ uint32_t boot_crc32_calculate(const uint32_t *buffer, size_t buffer_len) {
   return HAL_CRC_Calculate(&s_crc_handle, (uint32_t *)buffer, buffer_len);
 }
 
+uint32_t boot_crc32_accumulate(uint32_t crc32, const uint32_t *buffer, size_t buffer_len) {
+  if (buffer == NULL || buffer_len == 0U) {
+    return crc32;
+  }
+
+  /* Resume from the previous result, then restore the default for boot_crc32_calculate */
+  WRITE_REG(s_crc_handle.Instance->INIT, crc32);
+  __HAL_CRC_DR_RESET(&s_crc_handle);
+  crc32 = HAL_CRC_Accumulate(&s_crc_handle, (uint32_t *)buffer, buffer_len);
+  WRITE_REG(s_crc_handle.Instance->INIT, 0xFFFFFFFFU);
+
+  return crc32;
+}
+
 void boot_align_to_32bit_words(uint8_t *buffer, size_t *buffer_len) {
   if (buffer == NULL || buffer_len == NULL) {
     return; 
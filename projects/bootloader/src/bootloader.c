@@ -19,9 +19,10 @@
 #include "bootloader_flash.h"
 #include "bootloader_packet_handler.h"
 #include "bootloader_dfu.h"
+#include "misc.h"
 
 /** @brief Store CAN traffic in 2048 byte buffer to write to flash */
-static uint8_t *flash_buffer;
+static uint8_t flash_buffer[BOOTLOADER_PAGE_BYTES];
 
 static BootloaderDatagram datagram; /**< Bootloader datagram */
 PacketManager packet_manager;       /**< Store information to receive packets */
@@ -47,6 +48,7 @@ BootloaderError bootloader_init(void) {
   error = packet_handler_init(&packet_manager); 
   error = bootloader_dfu_init(packet_manager.current_write_address); 
   error = boot_crc32_init();
+  current_state = BOOTLOADER_IDLE;
 
   return error;
 }
@@ -58,6 +60,11 @@ BootloaderError bootloader_run(Boot_CanMessage *msg) {
     return BOOTLOADER_ERROR_UNINITIALIZED;
   }
 
+  /* ACKs from other nodes share the bus when several nodes are flashed at once */
+  if (msg->id >= SIZEOF_ARRAY(arbitration_id_handle) || arbitration_id_handle[msg->id] == BOOTLOADER_UNINITIALIZED) {
+    return BOOTLOADER_ERROR_NONE;
+  }
+
   datagram = deserialize_datagram(msg, &packet_manager.target_nodes);
 
   // if (!(prv_bootloader.target_nodes & (1 << _node_id))) {
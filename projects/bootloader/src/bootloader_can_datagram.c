@@ -29,6 +29,8 @@ BootloaderDatagram deserialize_datagram(Boot_CanMessage *msg, uint16_t *target_n
         *target_nodes = msg->data_u16[0];
         ret_datagram.payload.start.data_len =
             ((uint32_t)msg->data_u16[2] << 16) | (uint32_t)msg->data_u16[1];
+        /* Hosts without windowed flashing send a 6 byte start message */
+        ret_datagram.payload.start.window_pages = (msg->dlc > 6U) ? msg->data_u8[6] : 0U;
         break;
       case BOOTLOADER_CAN_SEQUENCING_ID:
         ret_datagram.datagram_type_id = msg->id;
@@ -64,3 +66,17 @@ void send_ack_datagram(bool ack, BootloaderError error) {
   error_buffer[2] = (uint8_t)(error);
   boot_can_transmit(BOOTLOADER_CAN_ACK_ID, false, error_buffer, sizeof(error_buffer));
 }
+
+void send_window_ack_datagram(uint16_t next_sequence_num, uint32_t image_crc32, uint8_t window_pages) {
+  uint8_t ack_buffer[DGRAM_MAX_MSG_SIZE] = { 0U };
+
+  ack_buffer[0] = (uint8_t)(next_sequence_num);
+  ack_buffer[1] = (uint8_t)(next_sequence_num >> 8);
+  ack_buffer[2] = (uint8_t)(image_crc32);
+  ack_buffer[3] = (uint8_t)(image_crc32 >> 8);
+  ack_buffer[4] = (uint8_t)(image_crc32 >> 16);
+  ack_buffer[5] = (uint8_t)(image_crc32 >> 24);
+  ack_buffer[6] = window_pages;
+
+  boot_can_transmit(BOOTLOADER_CAN_WINDOW_ACK_ID, false, ack_buffer, sizeof(ack_buffer));
+}
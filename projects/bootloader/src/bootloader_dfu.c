@@ -10,21 +10,35 @@
 /* Standard library Headers */
 
 /* Inter-component Headers */
+#ifndef MS_PLATFORM_X86
 #include "stm32l4xx.h"
+#endif
 
 /* Intra-component Headers */
 #include "bootloader_dfu.h"
 #include "bootloader_flash.h"
 #include "bootloader_crc32.h"
+#include "bootloader_memory_map.h"
+#include "misc.h"
 
 BootloaderDFUInfo dfu_info; 
 
+#ifdef MS_PLATFORM_X86
+static uintptr_t s_jump_address = 0U;
+#endif
+
 BootloaderError bootloader_dfu_init(uintptr_t current_write_address) {
   dfu_info.application_start = APP_ACTIVE_START_ADDRESS; 
   dfu_info.current_write_address = current_write_address; 
   return BOOTLOADER_ERROR_NONE; 
 }
 
+/* Erase pages by address, boot_flash_erase counts pages from the start of flash */
+static BootloaderError s_erase_pages(uintptr_t address, size_t num_pages) {
+  uint8_t start_page = (uint8_t)((address - FLASH_START_ADDRESS_LINKERSCRIPT) / BOOTLOADER_PAGE_BYTES);
+  return boot_flash_erase(start_page, (uint8_t)num_pages);
+}
+
 BootloaderError bootloader_dfu_flash(PacketManager *pm, uint8_t *flash_buffer) {
   BootloaderError error = BOOTLOADER_ERROR_NONE; 
 
@@ -34,9 +48,9 @@ BootloaderError bootloader_dfu_flash(PacketManager *pm, uint8_t *flash_buffer) {
     return BOOTLOADER_CRC_MISMATCH_BEFORE_WRITE;
   }
   
-  error |= boot_flash_erase(BOOTLOADER_ADDR_TO_PAGE(dfu_info.current_write_address), 1U);
-  error |= boot_flash_write(dfu_info.current_write_address, flash_buffer, BOOTLOADER_PAGE_BYTES);
-  error |= boot_flash_read(dfu_info.current_write_address, flash_buffer, BOOTLOADER_PAGE_BYTES);
+  error |= s_erase_pages(pm->current_write_address, 1U);
+  error |= boot_flash_write(pm->current_write_address, flash_buffer, BOOTLOADER_PAGE_BYTES);
+  error |= boot_flash_read(pm->current_write_address, flash_buffer, BOOTLOADER_PAGE_BYTES);
   
   calculated_crc32 = boot_crc32_calculate((uint32_t *)flash_buffer, BYTES_TO_WORD(pm->buffer_index));
   if (calculated_crc32 != pm->packet_crc32) {
@@ -51,8 +65,101 @@ BootloaderError bootloader_dfu_flash(PacketManager *pm, uint8_t *flash_buffer) {
   return error;
 }
 
+/* Bytes of the image held by the open page, only the last page is partial */
+static size_t s_open_page_bytes(PacketManager *pm) {
+  size_t page_offset = pm->current_write_address - APP_ACTIVE_START_ADDRESS;
+  return MIN(BOOTLOADER_PAGE_BYTES, pm->data_size - page_offset);
+}
+
+BootloaderError bootloader_dfu_window_start(PacketManager *pm) {
+  pm->window_pages = MIN(pm->window_pages, BOOTLOADER_DFU_MAX_WINDOW_PAGES);
+  pm->image_crc32 = 0xFFFFFFFFU;
+  pm->is_page_open = false;
+  pm->is_discarding = false;
+  pm->current_write_address = APP_ACTIVE_START_ADDRESS;
+
+  if (pm->data_size == 0U || pm->data_size > APP_ACTIVE_SIZE) {
+    send_ack_datagram(NACK, BOOTLOADER_OVERSIZE);
+    return BOOTLOADER_OVERSIZE;
+  }
+
+  /* The CPU stalls on flash while a page erases, so the whole image is erased before any data is in flight */
+  size_t num_pages = (pm->data_size + BOOTLOADER_PAGE_BYTES - 1U) / BOOTLOADER_PAGE_BYTES;
+  if (s_erase_pages(APP_ACTIVE_START_ADDRESS, num_pages) != BOOTLOADER_ERROR_NONE) {
+    send_ack_datagram(NACK, BOOTLOADER_FLASH_ERR);
+    return BOOTLOADER_FLASH_ERR;
+  }
+
+  send_window_ack_datagram(0U, pm->image_crc32, pm->window_pages);
+  return BOOTLOADER_ERROR_NONE;
+}
+
+BootloaderError bootloader_dfu_window_write(PacketManager *pm, uint8_t *data, uint8_t *page_buffer) {
+  if (!pm->is_page_open) {
+    /* Data for a page that was dropped, or data without a sequencing message */
+    return pm->is_discarding ? BOOTLOADER_ERROR_NONE : bootloader_dfu_window_reject(pm, BOOTLOADER_SEQUENCE_ERROR);
+  }
+
+  size_t page_bytes = s_open_page_bytes(pm);
+  size_t bytes_to_write = MIN((size_t)DGRAM_MAX_MSG_SIZE, page_bytes - pm->buffer_index);
+
+  /* Frames are double word aligned within the page, so each one programs straight into flash */
+  if (boot_flash_write(pm->current_write_address + pm->buffer_index, data, bytes_to_write) != BOOTLOADER_ERROR_NONE) {
+    send_ack_datagram(NACK, BOOTLOADER_FLASH_ERR);
+    return BOOTLOADER_FLASH_ERR;
+  }
+  pm->buffer_index += bytes_to_write;
+
+  if (pm->buffer_index < page_bytes) {
+    return BOOTLOADER_ERROR_NONE;
+  }
+
+  boot_flash_read(pm->current_write_address, page_buffer, page_bytes);
+  if (boot_crc32_calculate((const uint32_t *)page_buffer, BYTES_TO_WORD(page_bytes)) != pm->packet_crc32) {
+    return bootloader_dfu_window_reject(pm, BOOTLOADER_CRC_MISMATCH_AFTER_WRITE);
+  }
+
+  pm->image_crc32 = boot_crc32_accumulate(pm->image_crc32, (const uint32_t *)page_buffer, BYTES_TO_WORD(page_bytes));
+  pm->bytes_written += page_bytes;
+  pm->buffer_index = 0U;
+  pm->is_page_open = false;
+
+  /* Acknowledges every page before the expected sequence number */
+  send_window_ack_datagram(pm->expected_sequence_number, pm->image_crc32, pm->window_pages);
+
+  if (pm->bytes_written >= pm->data_size && boot_verify_flash_memory()) {
+    send_ack_datagram(NACK, BOOTLOADER_FLASH_MEMORY_VERIFY_FAILED);
+    return BOOTLOADER_FLASH_ERR;
+  }
+
+  return BOOTLOADER_ERROR_NONE;
+}
+
+BootloaderError bootloader_dfu_window_reject(PacketManager *pm, BootloaderError error) {
+  if (pm->is_page_open) {
+    /* Programmed flash must be erased before the page can be written again */
+    if (pm->buffer_index != 0U && s_erase_pages(pm->current_write_address, 1U) != BOOTLOADER_ERROR_NONE) {
+      send_ack_datagram(NACK, BOOTLOADER_FLASH_ERR);
+      return BOOTLOADER_FLASH_ERR;
+    }
+    pm->expected_sequence_number--;
+    pm->buffer_index = 0U;
+    pm->is_page_open = false;
+  }
+
+  /* NACK only once the page is erased, so the resent page cannot arrive while flash is busy */
+  pm->is_discarding = true;
+  send_ack_datagram(NACK, error);
+  return BOOTLOADER_ERROR_NONE;
+}
+
 BootloaderError bootloader_jump_app() {
   send_ack_datagram(ACK, BOOTLOADER_ERROR_NONE);
+#ifdef MS_PLATFORM_X86
+  /* There is no application to run, record where it would have started */
+  s_jump_address = dfu_info.application_start;
+  return BOOTLOADER_ERROR_NONE;
+#else
   __asm volatile(
       "LDR     R0, =dfu_info  \n"
       "LDR     R1, [R0]             \n"
@@ -60,11 +167,23 @@ BootloaderError bootloader_jump_app() {
       "BX      R2                   \n");
 
   return BOOTLOADER_INTERNAL_ERR;
+#endif
 }
 
 BootloaderError bootloader_fault() {
-  send_ack_datagram(NACK, BOOTLOADER_FAULT); 
+  send_ack_datagram(NACK, BOOTLOADER_INTERNAL_ERR); 
+#ifdef MS_PLATFORM_X86
+  /* Flash survives a reset, so reinitializing leaves the simulated node as it would boot */
+  return bootloader_init();
+#else
   NVIC_SystemReset(); 
   /* Just a reset, could pivot to something else if needed */ 
   return BOOTLOADER_INTERNAL_ERR;
+#endif
+}
+
+#ifdef MS_PLATFORM_X86
+uintptr_t bootloader_dfu_peek_jump_address(void) {
+  return s_jump_address;
 }
+#endif
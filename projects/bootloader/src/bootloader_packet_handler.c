@@ -34,7 +34,11 @@ BootloaderError packet_handler_init(PacketManager *pm) {
     .buffer_index = 0,
     .target_nodes = 0,
     .first_byte_received = false,
-    .first_ping_received = false
+    .first_ping_received = false,
+    .image_crc32 = 0xFFFFFFFFU,
+    .window_pages = 0,
+    .is_page_open = false,
+    .is_discarding = false
       //? set to something, maybe?
   //  .ping_type = BOOTLOADER_PING_NODES; 
   //  .ping_data_len = 0; 
@@ -51,12 +55,17 @@ BootloaderError bootloader_start(PacketManager *pm, BootloaderDatagram *datagram
   pm->first_byte_received = false;
   pm->first_ping_received = false;
   pm->expected_sequence_number = 0;
+  pm->window_pages = datagram->payload.start.window_pages;
 
   if (pm->data_size % BOOTLOADER_FLASH_WORD_SIZE != 0) {
     send_ack_datagram(NACK, BOOTLOADER_DATA_NOT_ALIGNED);
     return BOOTLOADER_DATA_NOT_ALIGNED;
   }
 
+  if (pm->window_pages != 0U) {
+    return bootloader_dfu_window_start(pm);
+  }
+
   send_ack_datagram(ACK, BOOTLOADER_ERROR_NONE);
   return BOOTLOADER_ERROR_NONE;
 }
@@ -64,6 +73,11 @@ BootloaderError bootloader_start(PacketManager *pm, BootloaderDatagram *datagram
 BootloaderError bootloader_receive_data(PacketManager *pm, BootloaderDatagram *datagram, uint8_t *flash_buffer) {
   BootloaderError error = BOOTLOADER_ERROR_NONE; 
   bool is_page_built = false; 
+
+  if (pm->window_pages != 0U) {
+    return bootloader_dfu_window_write(pm, datagram->payload.data.data, flash_buffer);
+  }
+
   error = s_receive_chunk(pm, datagram, flash_buffer, &is_page_built);
   if (is_page_built && error == BOOTLOADER_ERROR_NONE) {
     error = bootloader_dfu_flash(pm, flash_buffer); 
@@ -86,11 +100,11 @@ static BootloaderError s_receive_chunk(PacketManager *pm, BootloaderDatagram *da
 
   /* Prevent overflow */
   size_t bytes_to_copy = DATAGRAM_CHUNK;
-  uint8_t remaining_page = BOOTLOADER_PAGE_BYTES - pm->buffer_index;
+  size_t remaining_page = BOOTLOADER_PAGE_BYTES - pm->buffer_index;
   if (remaining_page < DATAGRAM_CHUNK) {
     bytes_to_copy = remaining_page;
   }
-  uint8_t remaining_data = pm->data_size - (pm->buffer_index + pm->bytes_written);
+  size_t remaining_data = pm->data_size - (pm->buffer_index + pm->bytes_written);
   if (remaining_data < DATAGRAM_CHUNK) {
     bytes_to_copy = remaining_data;
   }
@@ -113,7 +127,7 @@ static BootloaderError s_on_flash_success(PacketManager *pm, uint8_t *flash_buff
   pm->current_write_address += pm->buffer_index; 
   pm->buffer_index = 0;
 
-  memset(flash_buffer, 0, sizeof(flash_buffer));
+  memset(flash_buffer, 0, BOOTLOADER_PAGE_BYTES);
   send_ack_datagram(ACK, BOOTLOADER_ERROR_NONE);
 
   if (pm->bytes_written >= pm->data_size && boot_verify_flash_memory()) {
@@ -124,7 +138,46 @@ static BootloaderError s_on_flash_success(PacketManager *pm, uint8_t *flash_buff
   return BOOTLOADER_ERROR_NONE;
 }
 
+/* Pages are accepted strictly in order. Anything else is dropped until the host rewinds to the expected page */
+static BootloaderError s_window_sequencing(PacketManager *pm, BootloaderDatagram *datagram) {
+  uint16_t sequence_num = datagram->payload.sequencing.sequence_num;
+
+  if (pm->is_page_open) {
+    /* The previous page never received all of its data */
+    return bootloader_dfu_window_reject(pm, BOOTLOADER_SEQUENCE_ERROR);
+  }
+
+  if (sequence_num != pm->expected_sequence_number) {
+    /* Older pages are resent when another node asked for a rewind, only skipped pages are an error */
+    if (sequence_num > pm->expected_sequence_number && !pm->is_discarding) {
+      send_ack_datagram(NACK, BOOTLOADER_SEQUENCE_ERROR);
+    }
+    pm->is_discarding = true;
+    return BOOTLOADER_ERROR_NONE;
+  }
+
+  if ((uint32_t)sequence_num * BOOTLOADER_PAGE_BYTES >= pm->data_size) {
+    pm->is_discarding = true;
+    send_ack_datagram(NACK, BOOTLOADER_OVERSIZE);
+    return BOOTLOADER_ERROR_NONE;
+  }
+
+  pm->is_discarding = false;
+  pm->is_page_open = true;
+  pm->first_byte_received = true;
+  pm->packet_crc32 = datagram->payload.sequencing.crc32;
+  pm->buffer_index = 0;
+  pm->current_write_address = APP_ACTIVE_START_ADDRESS + (uintptr_t)sequence_num * BOOTLOADER_PAGE_BYTES;
+  pm->expected_sequence_number++;
+
+  return BOOTLOADER_ERROR_NONE;
+}
+
 BootloaderError bootloader_wait_sequencing(PacketManager *pm, BootloaderDatagram *datagram) {
+  if (pm->window_pages != 0U) {
+    return s_window_sequencing(pm, datagram);
+  }
+
   if (pm->expected_sequence_number == datagram->payload.sequencing.sequence_num) {
     pm->packet_crc32 = datagram->payload.sequencing.crc32;
     pm->buffer_index = 0;
@@ -194,7 +247,7 @@ BootloaderError bootloader_ping(PacketManager *pm, BootloaderDatagram *datagram,
     //  pm->current_address += pm->buffer_index;
     pm->buffer_index = 0;
     datagram->payload.ping.req = false;
-    memset(flash_buffer, 0, sizeof(flash_buffer));
+    memset(flash_buffer, 0, BOOTLOADER_PAGE_BYTES);
     send_ack_datagram(ACK, BOOTLOADER_ERROR_NONE);
   }
   return error; 
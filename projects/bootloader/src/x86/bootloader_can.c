@@ -0,0 +1,132 @@
+/************************************************************************************************
+ * @file   bootloader_can.c
+ *
+ * @brief  Source file for SocketCAN communication in the simulated bootloader
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "bootloader_can.h"
+
+/** @brief  Requested socket receive buffer, the kernel caps it at net.core.rmem_max */
+#define BOOT_CAN_RX_BUFFER_BYTES (1024 * 1024)
+
+static int s_can_socket = -1;
+static char s_interface[IFNAMSIZ] = BOOT_CAN_DEFAULT_INTERFACE;
+
+void boot_can_set_interface(const char *interface) {
+  if (interface == NULL) {
+    return;
+  }
+
+  snprintf(s_interface, sizeof(s_interface), "%s", interface);
+}
+
+BootloaderError boot_can_init(const Boot_CanSettings *settings) {
+  if (settings == NULL) {
+    return BOOTLOADER_INVALID_ARGS;
+  }
+
+  if (s_can_socket >= 0) {
+    close(s_can_socket);
+  }
+
+  s_can_socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (s_can_socket < 0) {
+    return BOOTLOADER_CAN_INIT_ERR;
+  }
+
+  struct ifreq ifr = { 0 };
+  snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", s_interface);
+
+  struct sockaddr_can addr = { 0 };
+  addr.can_family = AF_CAN;
+
+  if (ioctl(s_can_socket, SIOCGIFINDEX, &ifr) < 0) {
+    close(s_can_socket);
+    s_can_socket = -1;
+    return BOOTLOADER_CAN_INIT_ERR;
+  }
+  addr.can_ifindex = ifr.ifr_ifindex;
+
+  /* A virtual bus has no bitrate, so a fast host can queue a whole window before a node programs it */
+  int rx_buffer_bytes = BOOT_CAN_RX_BUFFER_BYTES;
+  setsockopt(s_can_socket, SOL_SOCKET, SO_RCVBUF, &rx_buffer_bytes, sizeof(rx_buffer_bytes));
+
+  /* Loopback mirrors the hardware loopback mode, frames from other nodes are always received */
+  int receive_own = settings->loopback ? 1 : 0;
+  setsockopt(s_can_socket, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &receive_own, sizeof(receive_own));
+
+  if (bind(s_can_socket, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    close(s_can_socket);
+    s_can_socket = -1;
+    return BOOTLOADER_CAN_INIT_ERR;
+  }
+
+  return BOOTLOADER_ERROR_NONE;
+}
+
+BootloaderError boot_can_transmit(uint32_t id, bool extended, const uint8_t *data, size_t len) {
+  if (data == NULL || len > 8U) {
+    return BOOTLOADER_INVALID_ARGS;
+  }
+
+  if (s_can_socket < 0) {
+    return BOOTLOADER_CAN_TRANSMIT_ERROR;
+  }
+
+  struct can_frame frame = { 0 };
+  frame.can_id = extended ? ((id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (id & CAN_SFF_MASK);
+  frame.can_dlc = (uint8_t)len;
+  memcpy(frame.data, data, len);
+
+  if (write(s_can_socket, &frame, sizeof(frame)) != (ssize_t)sizeof(frame)) {
+    return BOOTLOADER_CAN_TRANSMIT_ERROR;
+  }
+
+  return BOOTLOADER_ERROR_NONE;
+}
+
+BootloaderError boot_can_receive(Boot_CanMessage *const msg) {
+  if (msg == NULL) {
+    return BOOTLOADER_INVALID_ARGS;
+  }
+
+  if (s_can_socket < 0) {
+    return BOOTLOADER_CAN_RECEIVE_ERROR;
+  }
+
+  /* Wait briefly rather than spinning, so many simulated nodes can share a host */
+  struct pollfd rx_poll = { .fd = s_can_socket, .events = POLLIN };
+  if (poll(&rx_poll, 1U, BOOT_CAN_RECEIVE_TIMEOUT_MS) <= 0) {
+    return BOOTLOADER_CAN_RECEIVE_ERROR;
+  }
+
+  struct can_frame frame;
+  if (read(s_can_socket, &frame, sizeof(frame)) != (ssize_t)sizeof(frame)) {
+    return BOOTLOADER_CAN_RECEIVE_ERROR;
+  }
+
+  msg->extended = (frame.can_id & CAN_EFF_FLAG) != 0U;
+  msg->id = msg->extended ? (frame.can_id & CAN_EFF_MASK) : (frame.can_id & CAN_SFF_MASK);
+  msg->dlc = frame.can_dlc;
+  msg->data = 0U;
+  memcpy(msg->data_u8, frame.data, frame.can_dlc);
+
+  return BOOTLOADER_ERROR_NONE;
+}
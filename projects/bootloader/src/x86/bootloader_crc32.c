@@ -0,0 +1,59 @@
+/************************************************************************************************
+ * @file   bootloader_crc32.c
+ *
+ * @brief  Source file for the simulated CRC32 calculations in the bootloader
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <string.h>
+
+/* Inter-component Headers */
+#include "crc.h"
+
+/* Intra-component Headers */
+#include "bootloader_crc32.h"
+
+BootloaderError boot_crc32_init(void) {
+  if (crc_init(CRC_LENGTH_32) != STATUS_CODE_OK) {
+    return BOOTLOADER_INTERNAL_ERR;
+  }
+
+  return BOOTLOADER_ERROR_NONE;
+}
+
+uint32_t boot_crc32_calculate(const uint32_t *buffer, size_t buffer_len) {
+  if (buffer == NULL) {
+    return 0U;
+  }
+
+  return crc_calculate(buffer, buffer_len);
+}
+
+uint32_t boot_crc32_accumulate(uint32_t crc32, const uint32_t *buffer, size_t buffer_len) {
+  if (buffer == NULL) {
+    return crc32;
+  }
+
+  CRCContext context = { .crc = crc32 };
+  crc_update(&context, buffer, buffer_len);
+
+  return crc_finalize(&context);
+}
+
+void boot_align_to_32bit_words(uint8_t *buffer, size_t *buffer_len) {
+  if (buffer == NULL || buffer_len == NULL) {
+    return;
+  }
+
+  size_t remainder = *buffer_len % ALLIGNMENT_SIZE;
+  if (remainder == 0U) {
+    return;
+  }
+
+  size_t padding = ALLIGNMENT_SIZE - remainder;
+  memset(buffer + *buffer_len, 0, padding);
+  *buffer_len += padding;
+}
@@ -0,0 +1,71 @@
+/************************************************************************************************
+ * @file   bootloader_flash.c
+ *
+ * @brief  Source file for the simulated flash API in the bootloader
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <string.h>
+
+/* Inter-component Headers */
+#include "flash.h"
+#include "status.h"
+
+/* Intra-component Headers */
+#include "bootloader.h"
+#include "bootloader_flash.h"
+
+/* The flash library keeps the file-backed flash model, including erase and program latency */
+static BootloaderError s_to_bootloader_error(StatusCode status) {
+  switch (status) {
+    case STATUS_CODE_OK:
+      return BOOTLOADER_ERROR_NONE;
+    case STATUS_CODE_INVALID_ARGS:
+      return BOOTLOADER_INVALID_ARGS;
+    case STATUS_CODE_OUT_OF_RANGE:
+      return BOOTLOADER_FLASH_WRITE_OUT_OF_BOUNDS;
+    default:
+      return BOOTLOADER_INTERNAL_ERR;
+  }
+}
+
+BootloaderError boot_flash_write(uintptr_t address, uint8_t *buffer, size_t buffer_len) {
+  if (buffer == NULL) {
+    return BOOTLOADER_INVALID_ARGS;
+  }
+
+  return s_to_bootloader_error(flash_write(address, buffer, buffer_len));
+}
+
+BootloaderError boot_flash_erase(uint8_t start_page, uint8_t num_pages) {
+  return s_to_bootloader_error(flash_erase(start_page, num_pages));
+}
+
+BootloaderError boot_flash_read(uintptr_t address, uint8_t *buffer, size_t buffer_len) {
+  if (buffer == NULL) {
+    return BOOTLOADER_INVALID_ARGS;
+  }
+
+  return s_to_bootloader_error(flash_read(address, buffer, buffer_len));
+}
+
+BootloaderError boot_verify_flash_memory() {
+  uint32_t page[BOOTLOADER_PAGE_BYTES / sizeof(uint32_t)];
+
+  for (size_t offset = 0U; offset < APP_ACTIVE_SIZE; offset += BOOTLOADER_PAGE_BYTES) {
+    if (flash_read(APP_ACTIVE_START_ADDRESS + offset, (uint8_t *)page, sizeof(page)) != STATUS_CODE_OK) {
+      return BOOTLOADER_FLASH_ERR;
+    }
+
+    for (size_t i = 0U; i < BOOTLOADER_PAGE_BYTES / sizeof(uint32_t); i++) {
+      if (page[i] != 0xFFFFFFFFU) {
+        return BOOTLOADER_ERROR_NONE;
+      }
+    }
+  }
+
+  return BOOTLOADER_FLASH_ERR;
+}
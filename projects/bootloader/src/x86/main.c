@@ -0,0 +1,92 @@
+/************************************************************************************************
+ * @file   main.c
+ *
+ * @brief  Main file for the simulated bootloader
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Inter-component Headers */
+#include "flash.h"
+
+/* Intra-component Headers */
+#include "bootloader.h"
+#include "bootloader_can.h"
+#include "bootloader_can_datagram.h"
+#include "bootloader_dfu.h"
+
+#define BOOTLOADER_TIMEOUT_MS        15000
+
+const Boot_CanSettings can_settings = {
+  .bitrate = BOOT_CAN_BITRATE_500KBPS,
+  .loopback = false,
+};
+
+Boot_CanMessage msg = { 0 };
+
+static uint32_t s_now_ms(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(now.tv_sec * 1000U + now.tv_nsec / 1000000U);
+}
+
+/**
+ * Usage: bootloader [interface] [node directory]
+ * Each simulated node keeps its flash file in its own directory, so several nodes can share a bus
+ */
+int main(int argc, char *argv[]) {
+  if (argc > 1) {
+    boot_can_set_interface(argv[1]);
+  }
+
+  if (argc > 2) {
+    if ((mkdir(argv[2], 0755) != 0 && errno != EEXIST) || chdir(argv[2]) != 0) {
+      printf("Could not use node directory %s\n", argv[2]);
+      return 1;
+    }
+  }
+
+  /* Writes to unerased flash fail and take as long as they do on hardware */
+  if (flash_init() != STATUS_CODE_OK) {
+    printf("Could not open the flash file\n");
+    return 1;
+  }
+  flash_set_strict_mode(true);
+  flash_set_latency(FLASH_TYPICAL_ERASE_LATENCY_US, FLASH_TYPICAL_PROGRAM_LATENCY_US);
+
+  if (boot_can_init(&can_settings) != BOOTLOADER_ERROR_NONE) {
+    printf("Could not open CAN interface %s\n", (argc > 1) ? argv[1] : BOOT_CAN_DEFAULT_INTERFACE);
+    return 1;
+  }
+  bootloader_init();
+
+  uint32_t last_message_ms = s_now_ms();
+
+  while (bootloader_dfu_peek_jump_address() == 0U) {
+    if (boot_can_receive(&msg) == BOOTLOADER_ERROR_NONE) {
+      last_message_ms = s_now_ms();
+      bootloader_run(&msg);
+    }
+    if (s_now_ms() - last_message_ms > BOOTLOADER_TIMEOUT_MS) {
+      last_message_ms = s_now_ms();
+      if (boot_verify_flash_memory() == BOOTLOADER_ERROR_NONE) {
+        send_ack_datagram(NACK, BOOTLOADER_TIMEOUT);
+        bootloader_jump_app();
+        continue;
+      }
+      send_ack_datagram(NACK, BOOTLOADER_FLASH_MEMORY_VERIFY_FAILED);
+    }
+  }
+
+  printf("Jumping to application at 0x%08lx\n", (unsigned long)bootloader_dfu_peek_jump_address());
+  return 0;
+}
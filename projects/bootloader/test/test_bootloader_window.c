@@ -0,0 +1,257 @@
+/************************************************************************************************
+ * @file   test_bootloader_window.c
+ *
+ * @brief  Test file for flashing the bootloader with several pages in flight
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "flash.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "bootloader.h"
+#include "bootloader_can.h"
+#include "bootloader_can_datagram.h"
+#include "bootloader_crc32.h"
+#include "bootloader_dfu.h"
+#include "bootloader_flash.h"
+
+#define TEST_IMAGE_SIZE (2U * BOOTLOADER_PAGE_BYTES + 520U)
+#define TEST_NUM_PAGES 3U
+#define TEST_WINDOW_PAGES 4U
+#define TEST_MAX_TX_FRAMES 16U
+
+typedef struct {
+  uint32_t id;
+  uint8_t data[8];
+} TestFrame;
+
+static uint8_t s_image[TEST_IMAGE_SIZE];
+static TestFrame s_tx_frames[TEST_MAX_TX_FRAMES];
+static size_t s_num_tx_frames = 0U;
+
+BootloaderError TEST_MOCK(boot_can_transmit)(uint32_t id, bool extended, const uint8_t *data, size_t len) {
+  if (s_num_tx_frames < TEST_MAX_TX_FRAMES) {
+    s_tx_frames[s_num_tx_frames].id = id;
+    memcpy(s_tx_frames[s_num_tx_frames].data, data, len);
+    s_num_tx_frames++;
+  }
+  return BOOTLOADER_ERROR_NONE;
+}
+
+static void s_receive(uint32_t id, const uint8_t *data, size_t dlc) {
+  Boot_CanMessage msg = { .id = id, .dlc = dlc };
+  memcpy(msg.data_u8, data, dlc);
+  bootloader_run(&msg);
+}
+
+static void s_send_start(uint8_t window_pages, size_t dlc) {
+  uint8_t data[8] = { 0x03U, 0x00U, 0U, 0U, 0U, 0U, window_pages, 0U };
+  memcpy(&data[2], &(uint32_t){ TEST_IMAGE_SIZE }, sizeof(uint32_t));
+  s_receive(BOOTLOADER_CAN_START_ID, data, dlc);
+}
+
+static uint32_t s_page_crc32(uint16_t sequence_num, uint16_t page_bytes) {
+  return boot_crc32_calculate((const uint32_t *)&s_image[sequence_num * BOOTLOADER_PAGE_BYTES], BYTES_TO_WORD(page_bytes));
+}
+
+static void s_send_sequencing(uint16_t sequence_num, uint32_t crc32) {
+  uint8_t sequencing[6];
+  memcpy(&sequencing[0], &sequence_num, sizeof(uint16_t));
+  memcpy(&sequencing[2], &crc32, sizeof(uint32_t));
+  s_receive(BOOTLOADER_CAN_SEQUENCING_ID, sequencing, sizeof(sequencing));
+}
+
+/* Sends the sequencing message and the first page_bytes of the page */
+static void s_send_partial_page(uint16_t sequence_num, uint32_t crc32, size_t page_bytes) {
+  size_t offset = (size_t)sequence_num * BOOTLOADER_PAGE_BYTES;
+  s_send_sequencing(sequence_num, crc32);
+
+  for (size_t i = 0U; i < page_bytes; i += DGRAM_MAX_MSG_SIZE) {
+    uint8_t chunk[DGRAM_MAX_MSG_SIZE] = { 0U };
+    memcpy(chunk, &s_image[offset + i], (page_bytes - i < DGRAM_MAX_MSG_SIZE) ? page_bytes - i : DGRAM_MAX_MSG_SIZE);
+    s_receive(BOOTLOADER_CAN_FLASH_ID, chunk, sizeof(chunk));
+  }
+}
+
+static void s_send_page(uint16_t sequence_num, uint32_t crc32) {
+  size_t offset = (size_t)sequence_num * BOOTLOADER_PAGE_BYTES;
+  s_send_partial_page(sequence_num, crc32, (TEST_IMAGE_SIZE - offset < BOOTLOADER_PAGE_BYTES) ? TEST_IMAGE_SIZE - offset : BOOTLOADER_PAGE_BYTES);
+}
+
+static void s_assert_window_ack(const TestFrame *frame, uint16_t next_sequence_num) {
+  uint16_t acked_sequence_num;
+  uint32_t image_crc32;
+  memcpy(&acked_sequence_num, &frame->data[0], sizeof(uint16_t));
+  memcpy(&image_crc32, &frame->data[2], sizeof(uint32_t));
+
+  size_t image_bytes = (size_t)next_sequence_num * BOOTLOADER_PAGE_BYTES;
+  image_bytes = (image_bytes > TEST_IMAGE_SIZE) ? TEST_IMAGE_SIZE : image_bytes;
+
+  TEST_ASSERT_EQUAL_UINT32(BOOTLOADER_CAN_WINDOW_ACK_ID, frame->id);
+  TEST_ASSERT_EQUAL_UINT16(next_sequence_num, acked_sequence_num);
+  TEST_ASSERT_EQUAL_HEX32(boot_crc32_calculate((const uint32_t *)s_image, BYTES_TO_WORD(image_bytes)), image_crc32);
+  TEST_ASSERT_EQUAL_UINT8(TEST_WINDOW_PAGES, frame->data[6]);
+}
+
+static void s_assert_nack(const TestFrame *frame, BootloaderError error) {
+  TEST_ASSERT_EQUAL_UINT32(BOOTLOADER_CAN_ACK_ID, frame->id);
+  TEST_ASSERT_EQUAL_UINT8(NACK, frame->data[0]);
+  TEST_ASSERT_EQUAL_UINT8(error, frame->data[2]);
+}
+
+static void s_assert_image_flashed(void) {
+  static uint8_t flashed[TEST_IMAGE_SIZE];
+  TEST_ASSERT_EQUAL(BOOTLOADER_ERROR_NONE, boot_flash_read(APP_ACTIVE_START_ADDRESS, flashed, TEST_IMAGE_SIZE));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_image, flashed, TEST_IMAGE_SIZE);
+}
+
+void setup_test(void) {
+  for (size_t i = 0U; i < TEST_IMAGE_SIZE; i++) {
+    s_image[i] = (uint8_t)(i * 7U + 3U);
+  }
+
+  TEST_ASSERT_OK(flash_init());
+  flash_set_strict_mode(true);
+  flash_set_latency(0U, 0U);
+
+  bootloader_init();
+  s_num_tx_frames = 0U;
+}
+
+void teardown_test(void) {}
+
+void test_window_pages_in_flight(void) {
+  s_send_start(TEST_WINDOW_PAGES, 7U);
+  TEST_ASSERT_EQUAL(1U, s_num_tx_frames);
+  s_assert_window_ack(&s_tx_frames[0], 0U);
+
+  /* Every page is sent without waiting, each one is acknowledged with the running image CRC */
+  for (uint16_t page = 0U; page < TEST_NUM_PAGES; page++) {
+    uint16_t page_bytes = (page + 1U < TEST_NUM_PAGES) ? BOOTLOADER_PAGE_BYTES : TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES;
+    s_send_page(page, s_page_crc32(page, page_bytes));
+  }
+
+  TEST_ASSERT_EQUAL(1U + TEST_NUM_PAGES, s_num_tx_frames);
+  for (uint16_t page = 0U; page < TEST_NUM_PAGES; page++) {
+    s_assert_window_ack(&s_tx_frames[1U + page], page + 1U);
+  }
+  s_assert_image_flashed();
+}
+
+void test_window_resend_after_bad_page(void) {
+  s_send_start(TEST_WINDOW_PAGES, 7U);
+  s_send_page(0U, s_page_crc32(0U, BOOTLOADER_PAGE_BYTES));
+
+  /* The bad page is NACKed once, the page after it is dropped without another NACK */
+  s_send_page(1U, s_page_crc32(1U, BOOTLOADER_PAGE_BYTES) ^ 1U);
+  s_send_page(2U, s_page_crc32(2U, TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(3U, s_num_tx_frames);
+  s_assert_nack(&s_tx_frames[2], BOOTLOADER_CRC_MISMATCH_AFTER_WRITE);
+
+  /* The host rewinds to the oldest unacknowledged page, pages that are already written are skipped */
+  s_send_page(0U, s_page_crc32(0U, BOOTLOADER_PAGE_BYTES));
+  s_send_page(1U, s_page_crc32(1U, BOOTLOADER_PAGE_BYTES));
+  s_send_page(2U, s_page_crc32(2U, TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(5U, s_num_tx_frames);
+  s_assert_window_ack(&s_tx_frames[3], 2U);
+  s_assert_window_ack(&s_tx_frames[4], 3U);
+  s_assert_image_flashed();
+}
+
+void test_window_skipped_page(void) {
+  s_send_start(TEST_WINDOW_PAGES, 7U);
+  s_send_page(0U, s_page_crc32(0U, BOOTLOADER_PAGE_BYTES));
+
+  /* A page after a lost one is NACKed and its data dropped */
+  s_send_page(2U, s_page_crc32(2U, TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(3U, s_num_tx_frames);
+  s_assert_nack(&s_tx_frames[2], BOOTLOADER_SEQUENCE_ERROR);
+
+  s_send_page(1U, s_page_crc32(1U, BOOTLOADER_PAGE_BYTES));
+  s_send_page(2U, s_page_crc32(2U, TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(5U, s_num_tx_frames);
+  s_assert_window_ack(&s_tx_frames[3], 2U);
+  s_assert_window_ack(&s_tx_frames[4], 3U);
+  s_assert_image_flashed();
+}
+
+void test_window_incomplete_page(void) {
+  uint8_t first_page = (APP_ACTIVE_START_ADDRESS - FLASH_START_ADDRESS_LINKERSCRIPT) / BOOTLOADER_PAGE_BYTES;
+  s_send_start(TEST_WINDOW_PAGES, 7U);
+  uint32_t erase_count = flash_peek_erase_count(first_page);
+
+  /* Page 0 loses its tail, the next sequencing message erases what was programmed and NACKs it */
+  s_send_partial_page(0U, s_page_crc32(0U, BOOTLOADER_PAGE_BYTES), BOOTLOADER_PAGE_BYTES / 2U);
+  s_send_page(1U, s_page_crc32(1U, BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(2U, s_num_tx_frames);
+  s_assert_nack(&s_tx_frames[1], BOOTLOADER_SEQUENCE_ERROR);
+  TEST_ASSERT_EQUAL_UINT32(erase_count + 1U, flash_peek_erase_count(first_page));
+
+  for (uint16_t page = 0U; page < TEST_NUM_PAGES; page++) {
+    uint16_t page_bytes = (page + 1U < TEST_NUM_PAGES) ? BOOTLOADER_PAGE_BYTES : TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES;
+    s_send_page(page, s_page_crc32(page, page_bytes));
+  }
+
+  TEST_ASSERT_EQUAL(2U + TEST_NUM_PAGES, s_num_tx_frames);
+  s_assert_window_ack(&s_tx_frames[2U + TEST_NUM_PAGES - 1U], TEST_NUM_PAGES);
+  s_assert_image_flashed();
+}
+
+void test_window_ignores_other_nodes(void) {
+  s_send_start(TEST_WINDOW_PAGES, 7U);
+  s_send_page(0U, s_page_crc32(0U, BOOTLOADER_PAGE_BYTES));
+
+  /* Acknowledgements from other nodes flashed at the same time share the bus */
+  uint8_t ack[8] = { 0U };
+  s_receive(BOOTLOADER_CAN_ACK_ID, ack, 3U);
+  s_receive(BOOTLOADER_CAN_WINDOW_ACK_ID, ack, sizeof(ack));
+
+  s_send_page(1U, s_page_crc32(1U, BOOTLOADER_PAGE_BYTES));
+  s_send_page(2U, s_page_crc32(2U, TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES));
+
+  TEST_ASSERT_EQUAL(1U + TEST_NUM_PAGES, s_num_tx_frames);
+  s_assert_window_ack(&s_tx_frames[TEST_NUM_PAGES], TEST_NUM_PAGES);
+  s_assert_image_flashed();
+}
+
+void test_start_without_window(void) {
+  /* Hosts that predate windowed flashing send a 6 byte start message */
+  s_send_start(TEST_WINDOW_PAGES, 6U);
+
+  TEST_ASSERT_EQUAL(1U, s_num_tx_frames);
+  TEST_ASSERT_EQUAL_UINT32(BOOTLOADER_CAN_ACK_ID, s_tx_frames[0].id);
+  TEST_ASSERT_EQUAL_UINT8(ACK, s_tx_frames[0].data[0]);
+
+  /* Each page is buffered, written and acknowledged before the host sends the next one */
+  for (uint16_t page = 0U; page < TEST_NUM_PAGES; page++) {
+    uint16_t page_bytes = (page + 1U < TEST_NUM_PAGES) ? BOOTLOADER_PAGE_BYTES : TEST_IMAGE_SIZE % BOOTLOADER_PAGE_BYTES;
+    s_send_page(page, s_page_crc32(page, page_bytes));
+
+    TEST_ASSERT_EQUAL(2U + page, s_num_tx_frames);
+    TEST_ASSERT_EQUAL_UINT32(BOOTLOADER_CAN_ACK_ID, s_tx_frames[1U + page].id);
+    TEST_ASSERT_EQUAL_UINT8(ACK, s_tx_frames[1U + page].data[0]);
+  }
+  s_assert_image_flashed();
+}
+
+void test_jump_records_address(void) {
+  uint8_t data[2] = { 0x01U, 0x00U };
+  s_receive(BOOTLOADER_CAN_JUMP_APPLICATION_ID, data, sizeof(data));
+
+  TEST_ASSERT_EQUAL_HEX32(APP_ACTIVE_START_ADDRESS, bootloader_dfu_peek_jump_address());
+}
@@ -30,8 +30,8 @@
 /** @brief Maximum number of packets that can make up a datagram (8 data + 1 Header) */
 #define FOTA_MAX_PACKETS_PER_DATAGRAM ((FOTA_MAX_DATAGRAM_SIZE / FOTA_PACKET_PAYLOAD_SIZE) + 1U)
 
-/** @brief FOTA Datagram header payload size of 10-bytes */
-#define FOTA_DATAGRAM_HEADER_PAYLOAD_SIZE 10U
+/** @brief FOTA Datagram header payload size: total length, packet count, node ID, type and datagram CRC32 */
+#define FOTA_DATAGRAM_HEADER_PAYLOAD_SIZE 12U
 
 /**
  * @brief Datagram types corresponding to different FOTA operations
@@ -41,25 +41,24 @@ typedef enum FotaDatagramType {
   FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK,    /**< Chunk of firmware data */
   FOTA_DATAGRAM_TYPE_JUMP_TO_APP,       /**< Request to jump to application */
   FOTA_DATAGRAM_TYPE_ACKNOWLEDGEMENT,   /**< Acknowledgement information */
-  FOTA_DATAGRAM_TYPE_ERROR
+  FOTA_DATAGRAM_TYPE_ERROR,
+  FOTA_DATAGRAM_TYPE_SELECTIVE_ACK, /**< Receive window of firmware chunks */
 } FotaDatagramType;
 
 /**
- * Datagram Header Payload Format (20 bytes total):
+ * Datagram Header Packet Payload Format (12 bytes total):
  *
  *  +-------------------+----------------+---------------------------------------------------------------+
  *  | Field             | Size (bytes)   | Description                                                  |
  *  +-------------------+----------------+---------------------------------------------------------------+
+ *  | total_length      | 4              | Total length of the datagram data                            |
+ *  | num_packets       | 2              | Number of data packets in this datagram (excluding header)   |
  *  | target_node_id    | 1              | Target node ID (0 = RF Board, 1,2... = CAN Bootloader board) |
  *  | type              | 1              | Type of datagram (enum FotaDatagramType)                     |
- *  | num_packets       | 2              | Number of data packets in this datagram (excluding header)   |
- *  | datagram_id       | 4              | Unique identifier for this datagram                          |
- *  | total_length      | 4              | Total length of the datagram data                            |
  *  | datagram_crc32    | 4              | CRC32 of the entire datagram data                            |
- *  | packet_crc32      | 4              | CRC32 of this header packet payload                          |
  *  +-------------------+----------------+---------------------------------------------------------------+
  *
- *
+ * The datagram ID is carried by every packet, and the CRC32 of the header payload by the header packet.
  * All fields are encoded in little-endian format.
  */
 
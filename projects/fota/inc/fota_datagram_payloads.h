@@ -36,6 +36,7 @@ typedef struct {
   uint8_t version_major;                     /**< Version number (major) */
   uint8_t version_minor;                     /**< Version number (minor) */
   char firmware_id[FOTA_FIRMWARE_ID_LENGTH]; /**< Firmware name/ID */
+  uint32_t chunk_size;                       /**< Bytes in every firmware chunk except the last, a multiple of 4 */
 } FotaDatagramPayload_FirmwareMetadata;
 
 typedef struct {
@@ -55,4 +56,10 @@ typedef struct {
   char error_msg[FOTA_ERROR_MSG_LENGTH]; /**< Error message (optional) */
 } FotaDatagramPayload_Acknowledgement;
 
+typedef struct {
+  uint32_t window_base_id; /**< Oldest missing chunk ID, every earlier chunk has been written */
+  uint32_t window_bitmap;  /**< Bit n set if chunk window_base_id + n has been written */
+  uint32_t error_code;     /**< Result of the chunk that triggered this acknowledgement (see #FotaError) */
+} FotaDatagramPayload_SelectiveAck;
+
 /** @} */
@@ -26,6 +26,12 @@
  * @{
  */
 
+/**
+ * @brief   Number of chunks that may be received ahead of the oldest missing chunk
+ * @details One bit per chunk in the window bitmap reported by selective acknowledgements
+ */
+#define FOTA_DFU_WINDOW_SIZE 32U
+
 /**
  * @brief   DFU internal states
  */
@@ -44,11 +50,14 @@ typedef struct {
   bool is_initialized;                       /**< Initialization flag */
   uintptr_t staging_base_addr;               /**< Flash bank where new firmware is written */
   uintptr_t app_start_addr;                  /**< Main application entry address (for jump) */
-  uintptr_t current_write_addr;              /**< Current write address */
   uint32_t bytes_written;                    /**< Total bytes written so far */
   uint32_t binary_size;                      /**< Expected size of firmware binary */
   uint32_t expected_crc32;                   /**< Expected CRC32 of the firmware application */
-  uint16_t expected_datagram_id;             /**< Monotonic ID for validating sequencing */
+  uint32_t chunk_size;                       /**< Firmware bytes in every chunk except the last */
+  uint32_t num_chunks;                       /**< Number of chunks making up the binary */
+  uint32_t window_base_id;                   /**< Oldest missing chunk ID, every earlier chunk is written */
+  uint32_t window_bitmap;                    /**< Bit n is set once chunk window_base_id + n is written */
+  FotaError last_error;                      /**< Result of the most recent chunk */
   uint8_t version_major;                     /**< Version number (major) */
   uint8_t version_minor;                     /**< Version number (minor) */
   char firmware_id[FOTA_FIRMWARE_ID_LENGTH]; /**< Firmware name/ID */
@@ -72,4 +81,14 @@ FotaError fota_dfu_init(PacketManager *packet_manager, uintptr_t staging_base, u
  */
 FotaError fota_dfu_process(FotaDatagram *datagram);
 
+/**
+ * @brief   Fill a selective acknowledgement describing the receive window
+ * @details Chunks may arrive in any order within the window. The sender only needs to
+ *          retransmit chunks whose bit is clear, and may send up to FOTA_DFU_WINDOW_SIZE
+ *          chunks past window_base_id without waiting
+ * @param   sack Pointer to the acknowledgement to be filled
+ * @return  FOTA_ERROR_SUCCESS or FOTA_ERROR_INVALID_ARGS
+ */
+FotaError fota_dfu_get_selective_ack(FotaDatagramPayload_SelectiveAck *sack);
+
 /** @} */
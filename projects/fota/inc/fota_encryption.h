@@ -25,6 +25,15 @@
  * @{
  */
 
+/**
+ * @brief   Running CRC32 of a stream of 4-byte aligned words
+ * @details Matches the STM32 CRC unit as configured by fota_encryption_init: polynomial 0x04C11DB7,
+ *          initial value 0xFFFFFFFF, each word shifted in MSB first, no reflection and no final XOR
+ */
+typedef struct {
+  uint32_t crc; /**< CRC of all words accumulated so far */
+} FotaCrc32Context;
+
 /**
  * @brief   Initialize the encryption unit
  * @return  FOTA_SUCCESS if initialized successfully
@@ -40,10 +49,32 @@ FotaError fota_encryption_init();
 uint32_t fota_calculate_crc32(uint8_t *data, uint32_t length_words);
 
 /**
- * @brief   Verify a region of flash memory
- * @param   flash_base_addr Base address to begin verification from
- * @param   flash_size Size of flash memory to verify in bytes
- * @return  FOTA_SUCCESS if encryption is decoded successfully and the datagram is valid
+ * @brief   Start a CRC32 calculation
+ * @param   context Pointer to the CRC context to reset
+ */
+void fota_crc32_init(FotaCrc32Context *context);
+
+/**
+ * @brief   Accumulate 4-byte aligned data into a CRC32 calculation
+ * @details Feeding a buffer in several updates gives the same result as one fota_calculate_crc32 call
+ * @param   context Pointer to the CRC context
+ * @param   data Pointer to the start of the data
+ * @param   length_words Size of the data in words
+ */
+void fota_crc32_update(FotaCrc32Context *context, uint8_t *data, uint32_t length_words);
+
+/**
+ * @brief   Get the CRC32 of every word accumulated into a context
+ * @param   context Pointer to the CRC context
+ * @return  CRC32 of the accumulated data
+ */
+uint32_t fota_crc32_finalize(FotaCrc32Context *context);
+
+/**
+ * @brief   Calculate the CRC32 of a region of flash memory
+ * @param   flash_base_addr Base address to begin verification from, 4-byte aligned
+ * @param   flash_size Size of flash memory to verify in bytes, a multiple of 4
+ * @return  CRC32 of the region, or 0 if the region is empty or not aligned
  */
 uint32_t fota_calculate_crc32_on_flash_memory(uintptr_t flash_base_addr, uint32_t flash_size);
 
@@ -27,6 +27,8 @@ class CRC32:
     def calculate(self, buf):
         """
         @brief returns crc32 hash of the buffer
+        @details Matches the STM32 CRC unit used by fota_calculate_crc32: words are read little-endian and
+                 shifted in MSB first, a partial last word is zero padded and the result is not inverted
         """
         crc = 0xFFFFFFFF
         buf_len = len(buf)
@@ -44,7 +46,7 @@ class CRC32:
             for byte in b:
                 crc = ((crc << 8) & 0xFFFFFFFF) ^ self.crc_table[(crc >> 24) ^ byte]
 
-        return crc ^ 0xFFFFFFFF
+        return crc
 
     def crc_int_to_bytes(self, i):
         """
@@ -10,6 +10,10 @@
 import struct
 
 FOTA_ERROR_MSG_LENGTH = 256
+
+# FotaError values from fota_error.h that the host reacts to
+FOTA_ERROR_SUCCESS = 0
+FOTA_ERROR_BOOTLOADER_INVALID_STATE = 15
 ACK_STRUCT_FORMAT = f"<BBI{FOTA_ERROR_MSG_LENGTH}s"
 
 """
@@ -66,3 +70,64 @@ class FotaAck:
     def is_ack(self):
         """@brief Check if this acknowledgment indicates success (ACK == 0)"""
         return self._ack_status == 0
+
+
+FOTA_DFU_WINDOW_SIZE = 32
+SACK_STRUCT_FORMAT = "<III"
+
+"""
+Represents a FOTA Selective Acknowledgement packet:
+    typedef struct {
+    uint32_t window_base_id;  // Oldest missing chunk ID, every earlier chunk has been written
+    uint32_t window_bitmap;   // Bit n set if chunk window_base_id + n has been written
+    uint32_t error_code;      // FotaError enum value of the chunk that triggered this SACK
+    } FotaDatagramPayload_SelectiveAck;
+"""
+
+
+class FotaSelectiveAck:
+    """
+    @brief Selective acknowledge class object describing the receiver's chunk window
+    """
+
+    def __init__(self, raw_bytes: bytes):
+        """
+        @brief Initialize the FOTA selective acknowledge
+        """
+        expected_len = struct.calcsize(SACK_STRUCT_FORMAT)
+        if len(raw_bytes) < expected_len:
+            raise ValueError("Incomplete SACK recieved!")
+
+        window_base_id, window_bitmap, err_code = struct.unpack(SACK_STRUCT_FORMAT, raw_bytes[:expected_len])
+
+        self._window_base_id = window_base_id
+        self._window_bitmap = window_bitmap
+        self._err_code = err_code
+
+    @property
+    def window_base_id(self):
+        """@brief GETTER for the oldest chunk ID the receiver is still missing"""
+        return self._window_base_id
+
+    @property
+    def window_bitmap(self):
+        """@brief GETTER for the bitmap of chunks received at and after the window base"""
+        return self._window_bitmap
+
+    @property
+    def err_code(self):
+        """@brief GETTER for the error code of the chunk that triggered the SACK"""
+        return self._err_code
+
+    def is_received(self, chunk_id):
+        """@brief Check if the receiver has written the given chunk"""
+        if chunk_id < self._window_base_id:
+            return True
+
+        offset = chunk_id - self._window_base_id
+        return offset < FOTA_DFU_WINDOW_SIZE and bool(self._window_bitmap & (1 << offset))
+
+    def missing_chunks(self, num_chunks):
+        """@brief List the chunks in the window not yet written, any of these already sent should be retransmitted"""
+        window_end = min(num_chunks, self._window_base_id + FOTA_DFU_WINDOW_SIZE)
+        return [chunk_id for chunk_id in range(self._window_base_id, window_end) if not self.is_received(chunk_id)]
@@ -7,6 +7,8 @@
 #
 #  @ingroup FOTA_Python
 
+import struct
+
 from crc32 import CRC32
 from fota_packet import FotaPacket
 
@@ -15,6 +17,32 @@ STANDARD_CRC32_POLY = 0x04C11DB7
 BYTE_ORDER = 'little'
 CRC32_INST = CRC32(STANDARD_CRC32_POLY)
 
+FOTA_MAX_DATAGRAM_SIZE = 16 * FotaPacket.MAX_PAYLOAD_BYTES
+FOTA_DATAGRAM_HEADER_PAYLOAD_SIZE = 12
+
+# FotaDatagramType values from fota_datagram.h
+FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA = 0
+FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK = 1
+FOTA_DATAGRAM_TYPE_JUMP_TO_APP = 2
+FOTA_DATAGRAM_TYPE_ACKNOWLEDGEMENT = 3
+FOTA_DATAGRAM_TYPE_ERROR = 4
+FOTA_DATAGRAM_TYPE_SELECTIVE_ACK = 5
+
+FOTA_FIRMWARE_ID_LENGTH = 256
+FIRMWARE_METADATA_STRUCT_FORMAT = f"<IIBB{FOTA_FIRMWARE_ID_LENGTH}s2xI"
+
+"""
+Represents the FIRMWARE_METADATA datagram payload:
+    typedef struct {
+    uint32_t binary_size;       // Size of the binary in bytes, a multiple of 4
+    uint32_t expected_binary_crc32;
+    uint8_t  version_major;
+    uint8_t  version_minor;
+    char     firmware_id[256];
+    uint32_t chunk_size;        // Bytes per FIRMWARE_CHUNK datagram, a multiple of 4 up to 2048
+    } FotaDatagramPayload_FirmwareMetadata;
+"""
+
 # pylint: disable=R0902
 # pylint: disable=R0917
 
@@ -105,41 +133,40 @@ class FotaDatagramHeader():
         """@brief SETTER for the datagram header FotaPacket"""
         self._header_packet = new_val
 
-    def create_header_packet(self, datagram_crc32):
-        """@brief creates the header packet given the datagramcrc32 """
-        # Placeholder payload with 0 for packet_crc32
+    def create_header_packet(self):
+        """@brief creates the header packet, laid out like fota_datagram_to_packets on the board"""
         header_payload = (
+            self.length.to_bytes(4, BYTE_ORDER) +               # total_length (4 bytes)
+            self.num_packets.to_bytes(2, BYTE_ORDER) +          # num_packets (2 bytes)
             self.target_node.to_bytes(1, BYTE_ORDER) +          # target_node_id (1 byte)
             self.type.to_bytes(1, BYTE_ORDER) +                 # type (1 byte)
-            self.num_packets.to_bytes(2, BYTE_ORDER) +          # num_packets (2 bytes)
-            self.datagram_id.to_bytes(4, BYTE_ORDER) +          # datagram_id (4 bytes)
-            self.length.to_bytes(4, BYTE_ORDER) +               # total_length (4 bytes)
-            datagram_crc32.to_bytes(4, BYTE_ORDER) +             # datagram_crc32 (4 bytes)
-            (0).to_bytes(4, BYTE_ORDER)                          # packet_crc32 placeholder (4 bytes)
-        )
-
-        # Compute CRC32 over the payload excluding the last 4 bytes (packet_crc32)
-        packet_crc32 = CRC32_INST.calculate(header_payload[:-4])
-
-        # Rebuild the header payload with actual packet_crc32
-        header_payload = (
-            self.target_node.to_bytes(1, BYTE_ORDER) +
-            self.type.to_bytes(1, BYTE_ORDER) +
-            self.num_packets.to_bytes(2, BYTE_ORDER) +
-            self.datagram_id.to_bytes(4, BYTE_ORDER) +
-            self.length.to_bytes(4, BYTE_ORDER) +
-            datagram_crc32.to_bytes(4, BYTE_ORDER) +
-            packet_crc32.to_bytes(4, BYTE_ORDER)
+            self.datagram_crc32.to_bytes(4, BYTE_ORDER)         # datagram_crc32 (4 bytes)
         )
 
-        # Create the header FotaPacket
         self._header_packet = FotaPacket(
-            packet_type=0,
+            packet_type=FotaPacket.TYPE_HEADER,
             datagram_id=self._datagram_id,
             sequence_num=0,
             payload=header_payload
         )
 
+    @classmethod
+    def from_packet(cls, packet: FotaPacket) -> "FotaDatagramHeader":
+        """@brief parse a header packet received from the board"""
+        if packet.packet_type != FotaPacket.TYPE_HEADER or packet.payload_len < FOTA_DATAGRAM_HEADER_PAYLOAD_SIZE:
+            raise ValueError("Not a datagram header packet")
+
+        payload = packet.payload
+        header = cls(target_node=payload[6],
+                     length=int.from_bytes(payload[0:4], BYTE_ORDER),
+                     num_packets=int.from_bytes(payload[4:6], BYTE_ORDER),
+                     datagram_crc32=int.from_bytes(payload[8:12], BYTE_ORDER),
+                     datagram_id=packet.datagram_id)
+        header.type = payload[7]
+        header.header_packet = packet
+
+        return header
+
 
 class FotaDatagram():
     """
@@ -174,44 +201,46 @@ class FotaDatagram():
         """@brief GETTER to check if the datagram has been fully transmitted"""
         return self._complete_send
 
-    def bin_to_datagram(self, path, datagram_id, node_id) -> None:
-        """@brief given a path, turn the binary into the datagram"""
-        with open(path, "rb") as file:
-            data = file.read(128)
-            seq_num = 1
-            total_len = 0
-
-            while data:
-                packet = FotaPacket(0, datagram_id, seq_num, data)
+    @property
+    def data(self):
+        """@brief GETTER for the datagram data, without the header"""
+        return b"".join(packet.payload for packet in self._packet_list)
 
-                self._packet_list.append(packet)
-                seq_num += 1
-                total_len += packet.payload_len
+    def data_to_datagram(self, datagram_type, datagram_id, data, node_id) -> None:
+        """@brief split data into the header and data packets of one datagram"""
+        if len(data) > FOTA_MAX_DATAGRAM_SIZE:
+            raise ValueError("data exceeds the maximum datagram size")
 
-                data = file.read(128)
+        self._packet_list = []
+        for seq_num, offset in enumerate(range(0, len(data), FotaPacket.MAX_PAYLOAD_BYTES)):
+            payload = bytes(data[offset:offset + FotaPacket.MAX_PAYLOAD_BYTES])
+            self._packet_list.append(FotaPacket(FotaPacket.TYPE_DATA, datagram_id, seq_num, payload))
 
         self._packet_num = len(self._packet_list)
-
         datagram_crc = self.calculate_datagram_crc32()
 
         if self.datagram_header is None:
-            self.datagram_header = FotaDatagramHeader(node_id, total_len, self._packet_num, datagram_crc, datagram_id)
+            self._datagram_header = FotaDatagramHeader(node_id, len(data), self._packet_num, datagram_crc, datagram_id)
         else:
             self.datagram_header.target_node = node_id
-            self.datagram_header.type = 0
-            self.datagram_header.length = total_len
+            self.datagram_header.length = len(data)
             self.datagram_header.num_packets = self._packet_num
             self.datagram_header.datagram_crc32 = datagram_crc
             self.datagram_header.datagram_id = datagram_id
 
-            self.datagram_header.create_header_packet(datagram_crc)
+        self.datagram_header.type = datagram_type
+        self.datagram_header.create_header_packet()
+
+    def packets(self):
+        """@brief list every packet to transmit for this datagram, header first"""
+        return [self.datagram_header.header_packet] + self._packet_list
 
     def calculate_datagram_crc32(self) -> int:
-        """@brief create the crc32 from datagram"""
-        payloads = bytearray()
+        """@brief create the crc32 from datagram, over the data zero padded to whole words like the board"""
+        return CRC32_INST.calculate(self.data)
 
-        # don't include header packet
-        for packet in self._packet_list[1:]:
-            payloads += packet.payload
 
-        return CRC32_INST.calculate(payloads)
+def pack_firmware_metadata(binary_size, binary_crc32, version_major, version_minor, firmware_id, chunk_size) -> bytes:
+    """@brief build the FIRMWARE_METADATA datagram payload"""
+    return struct.pack(FIRMWARE_METADATA_STRUCT_FORMAT, binary_size, binary_crc32, version_major, version_minor,
+                       firmware_id.encode("utf-8")[:FOTA_FIRMWARE_ID_LENGTH - 1], chunk_size)
@@ -7,11 +7,10 @@
 
 from crc32 import CRC32
 
-# Note: Stolen from can_datagram/bootloader_id, so check for correct code
 STANDARD_CRC32_POLY = 0x04C11DB7
 
 # Endianness for byte conversion
-BYTE_ORDER = 'little'  # Note: Assumed from can_datagram, so confirm
+BYTE_ORDER = 'little'
 
 CRC32_INST = CRC32(STANDARD_CRC32_POLY)
 
@@ -22,7 +21,12 @@ class FotaPacket():
     """
     SOF = 0xAA
     EOF = 0xBB
-    MAX_PAYLOAD_BYTES = 64  # Note: Placeholder, so confirm
+    MAX_PAYLOAD_BYTES = 128
+    # SOF, type, datagram ID, sequence number, payload length, payload padded to MAX_PAYLOAD_BYTES, CRC32, EOF
+    SERIALIZED_SIZE = 1 + 1 + 4 + 1 + 2 + MAX_PAYLOAD_BYTES + 4 + 1
+
+    TYPE_DATA = 0
+    TYPE_HEADER = 1
 
     def __init__(self, packet_type: int, datagram_id: int, sequence_num: int, payload: bytes) -> None:
         """
@@ -35,6 +39,7 @@ class FotaPacket():
         self._sequence_num = sequence_num
         self._payload = payload
         self._payload_len = len(payload)
+        # The board checks the CRC over the zero padded payload, rounded up to whole words
         self._crc32_value = CRC32_INST.calculate(payload)
 
     def __repr__(self) -> str:
@@ -64,11 +69,38 @@ class FotaPacket():
         packet.append(self.sequence_num)
         packet += self.payload_len.to_bytes(2, BYTE_ORDER)
         packet += self.payload
+        packet += bytes(FotaPacket.MAX_PAYLOAD_BYTES - self.payload_len)
         packet += self.crc32_value.to_bytes(4, BYTE_ORDER)
         packet.append(FotaPacket.EOF)
 
         return packet
 
+    @classmethod
+    def unpack(cls, raw: bytes) -> "FotaPacket":
+        """
+        @brief Deserialize a packet received from the board, raises ValueError if it is malformed or corrupted
+        """
+        if len(raw) < FotaPacket.SERIALIZED_SIZE:
+            raise ValueError("Incomplete packet received")
+
+        if raw[0] != FotaPacket.SOF or raw[FotaPacket.SERIALIZED_SIZE - 1] != FotaPacket.EOF:
+            raise ValueError("Packet framing bytes are invalid")
+
+        payload_len = int.from_bytes(raw[7:9], BYTE_ORDER)
+        if payload_len > FotaPacket.MAX_PAYLOAD_BYTES:
+            raise ValueError("payload exceeds user-defined limit")
+
+        packet = cls(packet_type=raw[1],
+                     datagram_id=int.from_bytes(raw[2:6], BYTE_ORDER),
+                     sequence_num=raw[6],
+                     payload=bytes(raw[9:9 + payload_len]))
+
+        crc32_offset = 9 + FotaPacket.MAX_PAYLOAD_BYTES
+        if packet.crc32_value != int.from_bytes(raw[crc32_offset:crc32_offset + 4], BYTE_ORDER):
+            raise ValueError("Packet CRC32 mismatch")
+
+        return packet
+
     @property
     def packet_type(self):
         """
@@ -122,8 +154,8 @@ class FotaPacket():
         if not 0 <= datagram_id <= 0xFFFFFFFF:
             raise ValueError("datagram_id must fit in 4 bytes")
 
-        if not 0 <= sequence_num <= 0x07:
-            raise ValueError("sequence_num must be 3 bits")
+        if not 0 <= sequence_num <= 0xFF:
+            raise ValueError("sequence_num must be a single byte")
 
         if len(payload) > FotaPacket.MAX_PAYLOAD_BYTES:
             raise ValueError("payload exceeds user-defined limit")
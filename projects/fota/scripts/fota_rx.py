@@ -9,6 +9,79 @@
 
 import serial
 
+from fota_datagram import FotaDatagramHeader, CRC32_INST
+from fota_packet import FotaPacket
+
+
+class FotaDatagramReceiver:
+    """
+    @brief Reassembles the datagrams the board sends back from its serialized packets
+    """
+
+    def __init__(self) -> None:
+        """
+        @brief Initialize an empty receive buffer
+        """
+        self._buffer = bytearray()
+        self._pending = {}
+
+    def feed(self, data: bytes) -> list:
+        """
+        @brief Add received bytes, returns a list of (FotaDatagramHeader, data) for every datagram completed
+        """
+        self._buffer += data
+        datagrams = []
+
+        while True:
+            start = self._buffer.find(FotaPacket.SOF)
+            if start < 0:
+                self._buffer.clear()
+                break
+
+            del self._buffer[:start]
+            if len(self._buffer) < FotaPacket.SERIALIZED_SIZE:
+                break
+
+            try:
+                packet = FotaPacket.unpack(self._buffer[:FotaPacket.SERIALIZED_SIZE])
+            except ValueError:
+                # Corrupted or a payload byte that looked like SOF, resynchronize on the next one
+                del self._buffer[:1]
+                continue
+
+            del self._buffer[:FotaPacket.SERIALIZED_SIZE]
+
+            datagram = self._process_packet(packet)
+            if datagram is not None:
+                datagrams.append(datagram)
+
+        return datagrams
+
+    def _process_packet(self, packet: FotaPacket):
+        """
+        @brief Track a packet against its datagram, returns the datagram once every packet has arrived
+        """
+        if packet.packet_type == FotaPacket.TYPE_HEADER:
+            header = FotaDatagramHeader.from_packet(packet)
+            self._pending[packet.datagram_id] = (header, {})
+        elif packet.datagram_id not in self._pending:
+            # Data without its header, the board drops these too
+            return None
+
+        header, payloads = self._pending[packet.datagram_id]
+        if packet.packet_type == FotaPacket.TYPE_DATA and packet.sequence_num < header.num_packets:
+            payloads[packet.sequence_num] = packet.payload
+
+        if len(payloads) < header.num_packets:
+            return None
+
+        del self._pending[packet.datagram_id]
+        data = b"".join(payloads[seq_num] for seq_num in range(header.num_packets))[:header.length]
+        if CRC32_INST.calculate(data) != header.datagram_crc32:
+            return None
+
+        return header, data
+
 
 class FotaRx:
     """
@@ -20,6 +93,7 @@ class FotaRx:
         @brief Initialize FotaRx with a serial connection
         """
         self.ser = serial.Serial(port=port, baudrate=baudrate, timeout=timeout)
+        self._datagram_receiver = FotaDatagramReceiver()
 
     def __del__(self):
         """
@@ -36,6 +110,16 @@ class FotaRx:
 
         return None
 
+    def receive_datagrams(self) -> list:
+        """
+        @brief Read whatever bytes are waiting, returns a list of (FotaDatagramHeader, data) for each complete datagram
+        """
+        data = self.recieve()
+        if data is None:
+            return []
+
+        return self._datagram_receiver.feed(data)
+
     def close(self):
         """
         @brief Closes any serial connection
@@ -3,18 +3,33 @@
 #  @author  Midnight Sun Team #24 - MSXVI
 #  @brief   Core module for fota_python
 #
-#  @details
+#  @details Sends a firmware image as a FIRMWARE_METADATA datagram followed by FIRMWARE_CHUNK datagrams. Up to
+#           FOTA_DFU_WINDOW_SIZE chunks are in flight, the board answers every chunk with a selective acknowledgement
+#           and only the chunks it reports missing are retransmitted
 #
 #  @ingroup FOTA_Python
 
-from fota_datagram import FotaDatagram
-from fota_packet import FotaPacket
+import itertools
+import time
+
+from fota_datagram import (FotaDatagram, pack_firmware_metadata, CRC32_INST, FOTA_MAX_DATAGRAM_SIZE,
+                           FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK,
+                           FOTA_DATAGRAM_TYPE_SELECTIVE_ACK)
 from fota_packet_sender import FotaPacketSender
-from fota_ack import FotaAck
+from fota_ack import FotaSelectiveAck, FOTA_DFU_WINDOW_SIZE, FOTA_ERROR_BOOTLOADER_INVALID_STATE
 from fota_rx import FotaRx
 
 
 ACK_TIMEOUT = 5.0
+ACK_POLL_PERIOD = 0.01
+MAX_TIMEOUT_RETRIES = 5
+
+# Node ID of the RF board running the DFU, see fota.c
+FOTA_RF_BOARD_NODE_ID = 0
+
+# Erased flash value used to pad the binary to whole words
+FLASH_ERASED_BYTE = b"\xFF"
+FLASH_WORD_SIZE = 4
 
 
 class FotaTx():
@@ -25,64 +40,106 @@ class FotaTx():
     def __init__(self, packet_sender: FotaPacketSender, serial_receive: FotaRx):
         """@brief initialize the transport layer for the fota packet sender"""
         self._packet_sender = packet_sender
-        self._tx_queue = []
         self._serial_receive = serial_receive
 
-    def send_packet(self, packet: FotaPacket) -> bool:
-        """@brief send packet through serial """
-        self._packet_sender.send(packet)
-
-        ack = self.ack_wait()
+    def send_datagram(self, datagram: FotaDatagram) -> bool:
+        """@brief send the header and every data packet of a datagram"""
+        for packet in datagram.packets():
+            if not self._packet_sender.send(packet):
+                print("ERROR: could not send packet")
+                return False
+
+        return True
+
+    def send_firmware(self, binary: bytes, version_major: int, version_minor: int, firmware_id: str,
+                      chunk_size: int = FOTA_MAX_DATAGRAM_SIZE, target_node: int = FOTA_RF_BOARD_NODE_ID) -> bool:
+        """@brief transmit a firmware binary, returns True once the board reports every chunk written"""
+        # pylint: disable=too-many-arguments,too-many-positional-arguments,too-many-locals,too-many-branches
+        if not 0 < chunk_size <= FOTA_MAX_DATAGRAM_SIZE or chunk_size % FLASH_WORD_SIZE != 0:
+            raise ValueError("chunk_size must be a multiple of 4 up to the maximum datagram size")
+
+        # The board verifies the staged image in whole words
+        binary = bytes(binary) + FLASH_ERASED_BYTE * (-len(binary) % FLASH_WORD_SIZE)
+        chunks = [binary[offset:offset + chunk_size] for offset in range(0, len(binary), chunk_size)]
+
+        metadata = FotaDatagram()
+        metadata.data_to_datagram(FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, 0,
+                                  pack_firmware_metadata(len(binary), CRC32_INST.calculate(binary), version_major,
+                                                         version_minor, firmware_id, chunk_size),
+                                  target_node)
+
+        # Order in which chunks went out, a missing chunk sent before one that arrived was lost on the way
+        send_order = {}
+        send_count = itertools.count()
+
+        def send_chunk(chunk_id):
+            datagram = FotaDatagram()
+            datagram.data_to_datagram(FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK, chunk_id, chunks[chunk_id], target_node)
+            send_order[chunk_id] = next(send_count)
+            return self.send_datagram(datagram)
+
+        if not self.send_datagram(metadata):
+            return False
 
-        if ack.ack_status == 0:
-            return True
+        sack = None
+        next_chunk = 0
+        timeouts = 0
+        deadline = time.monotonic() + ACK_TIMEOUT
 
-        return False
+        while sack is None or sack.window_base_id < len(chunks):
+            window_base = 0 if sack is None else sack.window_base_id
 
-    def queue_datagram(self, datagram: FotaDatagram):
-        """@brief pack a datagram into a queue to send over transmit layer """
-        transmit_queue = []
+            # Keep the window full with chunks that were never sent
+            while next_chunk < min(len(chunks), window_base + FOTA_DFU_WINDOW_SIZE):
+                if not send_chunk(next_chunk):
+                    return False
+                next_chunk += 1
+
+            # A board that never got the metadata rejects every chunk with an empty window, wait for the line to
+            # go quiet and start over rather than resending the metadata once per rejected chunk
+            sacks = [FotaSelectiveAck(data) for header, data in self._serial_receive.receive_datagrams()
+                     if header.type == FOTA_DATAGRAM_TYPE_SELECTIVE_ACK]
+            sacks = [new_sack for new_sack in sacks
+                     if not (new_sack.err_code == FOTA_ERROR_BOOTLOADER_INVALID_STATE and
+                             new_sack.window_base_id == 0 and new_sack.window_bitmap == 0)]
+
+            if not sacks:
+                if time.monotonic() < deadline:
+                    time.sleep(ACK_POLL_PERIOD)
+                    continue
+
+                timeouts += 1
+                if timeouts > MAX_TIMEOUT_RETRIES:
+                    print("ERROR: no acknowledgement from the board")
+                    return False
 
-        transmit_queue.append(datagram.datagram_header)
+                # Either the last chunks or their acknowledgements were lost, resend everything still missing
+                if sack is None:
+                    if not self.send_datagram(metadata):
+                        return False
+                    missing = range(next_chunk)
+                else:
+                    missing = sack.missing_chunks(next_chunk)
 
-        for packet in datagram.packet_list:
-            transmit_queue.append(packet)
+                for chunk_id in missing:
+                    if not send_chunk(chunk_id):
+                        return False
 
-    def transmit(self) -> bool:
-        """@brief start tranmission of anything in tx_queue"""
+                deadline = time.monotonic() + ACK_TIMEOUT
+                continue
 
-        if not self._tx_queue:
-            print("Nothing in queue to transmit")
-            return False
+            timeouts = 0
+            deadline = time.monotonic() + ACK_TIMEOUT
 
-        print("Transmitting datagram")
+            for new_sack in sacks:
+                if sack is None or new_sack.window_base_id >= sack.window_base_id:
+                    sack = new_sack
 
-        try:
-            for packet in self._tx_queue:
-                status = self._packet_sender.send(packet)
+            last_received = max((send_order[chunk_id] for chunk_id in range(sack.window_base_id, next_chunk)
+                                 if sack.is_received(chunk_id)), default=-1)
 
-                if not status:
-                    print("ERROR: could not send packet, or did not receive ack")
+            for chunk_id in sack.missing_chunks(next_chunk):
+                if send_order[chunk_id] < last_received and not send_chunk(chunk_id):
                     return False
 
-            print("Finished transmitting Datagram")
-            return True
-
-        except Exception as error:
-            print(f"Unexpected error during transmission: {error}")
-            return False
-
-    def ack_wait(self) -> FotaAck:
-        """@brief method to receieve the acknowledgment and parse it into a class object"""
-        buffer = bytearray()
-        received_bytes = 0
-        expected_len = 1 + 1 + 4 + 256  # from ACK struct, see fota_ack.py
-
-        while received_bytes < expected_len:
-            buffer += self._serial_receive.recieve()
-
-        if received_bytes == expected_len:
-            return FotaAck(buffer)
-
-        print("ERROR: could not parse ack packet")
-        return None
+        return True
@@ -11,12 +11,46 @@
 #  @ingroup FOTA_Python
 
 
+import argparse
+import sys
+
+from fota_packet_sender import FotaPacketSender
+from fota_rx import FotaRx
+from fota_tx import FotaTx
+from fota_datagram import FOTA_MAX_DATAGRAM_SIZE
+
+
 def main():
     """
-    @brief Main function for fota
+    @brief Main function for fota, sends a firmware binary to the RF board
     """
-    print("Welcome to fota_python")
+    parser = argparse.ArgumentParser(description="Send a firmware binary over the FOTA XBee link")
+    parser.add_argument("binary", help="Firmware binary to send")
+    parser.add_argument("--tx-port", required=True, help="Serial port of the transmitting XBee")
+    parser.add_argument("--rx-port", help="Serial port of the receiving XBee, defaults to the transmit port")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--firmware-id", default="")
+    parser.add_argument("--version", default="0.0", help="Firmware version as major.minor")
+    parser.add_argument("--chunk-size", type=int, default=FOTA_MAX_DATAGRAM_SIZE,
+                        help="Bytes per firmware chunk, a multiple of 4")
+    args = parser.parse_args()
+
+    version_major, version_minor = (int(part) for part in args.version.split("."))
+
+    with open(args.binary, "rb") as file:
+        binary = file.read()
+
+    packet_sender = FotaPacketSender(args.tx_port, args.baudrate)
+    serial_receive = FotaRx(args.rx_port or args.tx_port, args.baudrate)
+
+    if not FotaTx(packet_sender, serial_receive).send_firmware(binary, version_major, version_minor,
+                                                                 args.firmware_id, args.chunk_size):
+        print("ERROR: firmware update failed")
+        return 1
+
+    print("Firmware update sent")
+    return 0
 
 
 if __name__ == "__main__":
-    main()
+    sys.exit(main())
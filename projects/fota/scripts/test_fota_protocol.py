@@ -0,0 +1,184 @@
+# pylint: skip-file
+'''This Module Tests the FOTA host sender against an emulated DFU on the RF board'''
+import struct
+import unittest
+
+import fota_tx
+from fota_ack import FOTA_DFU_WINDOW_SIZE, SACK_STRUCT_FORMAT, FOTA_ERROR_SUCCESS, \
+    FOTA_ERROR_BOOTLOADER_INVALID_STATE
+from fota_datagram import FotaDatagram, FotaDatagramHeader, pack_firmware_metadata, FIRMWARE_METADATA_STRUCT_FORMAT, \
+    FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK, FOTA_DATAGRAM_TYPE_SELECTIVE_ACK
+from fota_packet import FotaPacket
+from fota_rx import FotaDatagramReceiver
+from fota_tx import FotaTx
+
+# fota_calculate_crc32 on the board over the single word 0x04030201
+TEST_CRC32_01020304 = 0x1DABE74F
+
+TEST_CHUNK_SIZE = 256
+
+
+class FakeBoard:
+    '''Emulates fota_dfu.c: a metadata datagram, then chunks written through a window and a SACK per chunk'''
+
+    def __init__(self, drop=()):
+        self.receiver = FotaDatagramReceiver()
+        self.host_receiver = FotaDatagramReceiver()
+        self.drop = list(drop)
+        self.dropping = False
+        self.tx = bytearray()
+        self.image = None
+        self.chunk_size = 0
+        self.num_chunks = 0
+        self.window_base_id = 0
+        self.window_bitmap = 0
+        self.chunk_sends = []
+
+    # FotaPacketSender interface
+    def send(self, packet):
+        if packet.packet_type == FotaPacket.TYPE_HEADER:
+            key = (FotaDatagramHeader.from_packet(packet).type, packet.datagram_id)
+            if key[0] == FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK:
+                self.chunk_sends.append(packet.datagram_id)
+            self.dropping = key in self.drop
+            if self.dropping:
+                self.drop.remove(key)
+
+        if not self.dropping:
+            for header, data in self.receiver.feed(packet.pack()):
+                self._process(header, data)
+        return True
+
+    # FotaRx interface
+    def receive_datagrams(self):
+        data = bytes(self.tx)
+        self.tx.clear()
+        return self.host_receiver.feed(data)
+
+    def _process(self, header, data):
+        if header.type == FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA:
+            if self.image is None:
+                binary_size, _, _, _, _, self.chunk_size = struct.unpack(FIRMWARE_METADATA_STRUCT_FORMAT, data)
+                self.image = bytearray(b"\xFF" * binary_size)
+                self.num_chunks = -(-binary_size // self.chunk_size)
+            return
+
+        chunk_id = header.datagram_id
+        error = FOTA_ERROR_SUCCESS
+        if self.image is None:
+            error = FOTA_ERROR_BOOTLOADER_INVALID_STATE
+        elif 0 <= chunk_id - self.window_base_id < FOTA_DFU_WINDOW_SIZE and chunk_id < self.num_chunks:
+            offset = chunk_id * self.chunk_size
+            self.image[offset:offset + len(data)] = data
+            self.window_bitmap |= 1 << (chunk_id - self.window_base_id)
+            while self.window_bitmap & 1:
+                self.window_bitmap >>= 1
+                self.window_base_id += 1
+
+        sack = FotaDatagram()
+        sack.data_to_datagram(FOTA_DATAGRAM_TYPE_SELECTIVE_ACK, chunk_id,
+                              struct.pack(SACK_STRUCT_FORMAT, self.window_base_id, self.window_bitmap, error), 0)
+        for packet in sack.packets():
+            self.tx += packet.pack()
+
+
+def make_binary(size):
+    return bytes((i * 7 + (i >> 8)) & 0xFF for i in range(size))
+
+
+class TestFotaProtocol(unittest.TestCase):
+    '''Test the host side of the FOTA protocol'''
+
+    def setUp(self):
+        self.ack_timeout = fota_tx.ACK_TIMEOUT
+        fota_tx.ACK_TIMEOUT = 0.05
+
+    def tearDown(self):
+        fota_tx.ACK_TIMEOUT = self.ack_timeout
+
+    def test_packet_matches_board_layout(self):
+        '''Test packets are padded to the board's fixed size and use the board's CRC32'''
+        raw = FotaPacket(FotaPacket.TYPE_DATA, 0x01020304, 5, bytes([1, 2, 3, 4])).pack()
+        self.assertEqual(len(raw), FotaPacket.SERIALIZED_SIZE)
+        self.assertEqual(raw[:9], bytes([0xAA, 0x00, 0x04, 0x03, 0x02, 0x01, 0x05, 0x04, 0x00]))
+        self.assertEqual(raw[13:137], bytes(124))
+        self.assertEqual(int.from_bytes(raw[137:141], 'little'), TEST_CRC32_01020304)
+        self.assertEqual(raw[-1], 0xBB)
+
+        unpacked = FotaPacket.unpack(raw)
+        self.assertEqual(unpacked.payload, bytes([1, 2, 3, 4]))
+
+        corrupted = bytearray(raw)
+        corrupted[10] ^= 0x01
+        with self.assertRaises(ValueError):
+            FotaPacket.unpack(bytes(corrupted))
+
+    def test_metadata_carries_chunk_size(self):
+        '''Test the metadata datagram matches FotaDatagramPayload_FirmwareMetadata and its header carries the type'''
+        payload = pack_firmware_metadata(4096, 0xDEADBEEF, 1, 2, "steering", 1024)
+        self.assertEqual(len(payload), 272)
+        self.assertEqual(int.from_bytes(payload[268:272], 'little'), 1024)
+
+        datagram = FotaDatagram()
+        datagram.data_to_datagram(FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, 0, payload, 0)
+        header_payload = datagram.packets()[0].payload
+        self.assertEqual(len(header_payload), 12)
+        self.assertEqual(header_payload[7], FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA)
+        self.assertEqual([packet.sequence_num for packet in datagram.packets()[1:]], [0, 1, 2])
+
+    def test_send_firmware(self):
+        '''Test an unaligned binary is padded, written in order and every chunk is sent once'''
+        binary = make_binary(20 * TEST_CHUNK_SIZE + 3)
+        board = FakeBoard()
+
+        self.assertTrue(FotaTx(board, board).send_firmware(binary, 1, 0, "steering", TEST_CHUNK_SIZE))
+        self.assertEqual(bytes(board.image), binary + b"\xFF")
+        self.assertEqual(board.chunk_sends, list(range(21)))
+
+    def test_send_firmware_fills_window(self):
+        '''Test the sender keeps the window full and does not wait per chunk'''
+        binary = make_binary(80 * 16)
+        board = FakeBoard()
+
+        self.assertTrue(FotaTx(board, board).send_firmware(binary, 1, 0, "steering", 16))
+        self.assertEqual(bytes(board.image), binary)
+        self.assertEqual(board.chunk_sends[:FOTA_DFU_WINDOW_SIZE], list(range(FOTA_DFU_WINDOW_SIZE)))
+        self.assertEqual(len(board.chunk_sends), 80)
+
+    def test_lost_chunks_are_retransmitted(self):
+        '''Test only the lost chunks are retransmitted, including the last one which needs a timeout'''
+        binary = make_binary(10 * TEST_CHUNK_SIZE)
+        lost = [(FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK, 2), (FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK, 5),
+                (FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK, 9)]
+        board = FakeBoard(drop=lost)
+
+        self.assertTrue(FotaTx(board, board).send_firmware(binary, 1, 0, "steering", TEST_CHUNK_SIZE))
+        self.assertEqual(bytes(board.image), binary)
+        self.assertEqual(sorted(board.chunk_sends), sorted(list(range(10)) + [2, 5, 9]))
+
+    def test_lost_metadata_is_resent(self):
+        '''Test chunks rejected for missing metadata lead to the metadata and chunks being sent again'''
+        binary = make_binary(4 * TEST_CHUNK_SIZE)
+        board = FakeBoard(drop=[(FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, 0)])
+
+        self.assertTrue(FotaTx(board, board).send_firmware(binary, 1, 0, "steering", TEST_CHUNK_SIZE))
+        self.assertEqual(bytes(board.image), binary)
+        self.assertEqual(board.chunk_sends, list(range(4)) * 2)
+
+    def test_unresponsive_board_fails(self):
+        '''Test the sender gives up when the board never answers'''
+        board = FakeBoard(drop=[(FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, 0)] * (fota_tx.MAX_TIMEOUT_RETRIES + 2))
+
+        self.assertFalse(FotaTx(board, board).send_firmware(make_binary(64), 1, 0, "steering", 16))
+
+    def test_invalid_chunk_size(self):
+        '''Test chunk sizes the board would reject are refused'''
+        board = FakeBoard()
+
+        for chunk_size in (0, 6, 4096):
+            with self.assertRaises(ValueError):
+                FotaTx(board, board).send_firmware(make_binary(64), 1, 0, "steering", chunk_size)
+
+
+if __name__ == "__main__":
+    unittest.main()
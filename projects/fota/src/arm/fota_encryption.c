@@ -19,6 +19,7 @@
 #include "fota_encryption.h"
 
 #define FOTA_ENCRYPTION_WORD_SIZE 4U
+#define FOTA_CRC32_INIT_VALUE 0xFFFFFFFFU
 
 static CRC_HandleTypeDef s_crc_handle;
 
@@ -30,7 +31,7 @@ FotaError fota_encryption_init() {
   s_crc_handle.Init.CRCLength = CRC_POLYLENGTH_32B;
   s_crc_handle.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
   s_crc_handle.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_ENABLE;
-  s_crc_handle.Init.InitValue = 0xFFFFFFFFU;
+  s_crc_handle.Init.InitValue = FOTA_CRC32_INIT_VALUE;
   s_crc_handle.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
   s_crc_handle.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
 
@@ -41,6 +42,34 @@ FotaError fota_encryption_init() {
   return FOTA_ERROR_SUCCESS;
 }
 
+void fota_crc32_init(FotaCrc32Context *context) {
+  if (context == NULL) {
+    return;
+  }
+
+  context->crc = FOTA_CRC32_INIT_VALUE;
+}
+
+void fota_crc32_update(FotaCrc32Context *context, uint8_t *data, uint32_t length_words) {
+  if (context == NULL || data == NULL || length_words == 0U) {
+    return;
+  }
+
+  /* Resume from the context's running CRC, then restore the default for one-shot calculations */
+  WRITE_REG(s_crc_handle.Instance->INIT, context->crc);
+  __HAL_CRC_DR_RESET(&s_crc_handle);
+  context->crc = HAL_CRC_Accumulate(&s_crc_handle, (uint32_t *)data, length_words);
+  WRITE_REG(s_crc_handle.Instance->INIT, FOTA_CRC32_INIT_VALUE);
+}
+
+uint32_t fota_crc32_finalize(FotaCrc32Context *context) {
+  if (context == NULL) {
+    return 0U;
+  }
+
+  return context->crc;
+}
+
 uint32_t fota_calculate_crc32(uint8_t *data_start, uint32_t word_size) {
   if (data_start == NULL) {
     return 0U;
@@ -8,10 +8,12 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <string.h>
 
 /* Inter-component Headers */
 
 /* Intra-component Headers */
+#include "fota_datagram_payloads.h"
 #include "fota_dfu.h"
 #include "fota_encryption.h"
 #include "fota_error.h"
@@ -22,15 +24,36 @@
 #include "packet_manager.h"
 
 #define FOTA_RF_BOARD_NODE_ID 0U
+#define FOTA_NETWORK_UART_PORT UART_PORT_2
 
 static PacketManager packet_manager;
 static UartSettings network_uart_settings = { .tx = { .port = GPIO_PORT_A, .pin = 2U }, .rx = { .port = GPIO_PORT_A, .pin = 3U }, .baudrate = 115200U, .flow_control = UART_FLOW_CONTROL_NONE };
+static FotaDatagram sack_datagram;
+
+static FotaError fota_network_send(int8_t *data, uint32_t length) {
+  return network_tx(FOTA_NETWORK_UART_PORT, (uint8_t *)data, length);
+}
+
+/* Report the DFU receive window so the sender only retransmits the chunks that are missing */
+static FotaError fota_send_selective_ack(uint32_t datagram_id) {
+  FotaDatagramPayload_SelectiveAck sack;
+  fota_error_ok_or_return(fota_dfu_get_selective_ack(&sack));
+  fota_error_ok_or_return(fota_datagram_init(&sack_datagram, FOTA_DATAGRAM_TYPE_SELECTIVE_ACK, datagram_id, (uint8_t *)&sack, sizeof(sack)));
+  sack_datagram.header.target_node_id = FOTA_RF_BOARD_NODE_ID;
+
+  return packet_manager_send_datagram(&packet_manager, &sack_datagram, fota_network_send);
+}
 
 static void fota_datagram_complete_cb(FotaDatagram *datagram) {
   switch (datagram->header.target_node_id) {
     case FOTA_RF_BOARD_NODE_ID: {
       /* Trigger DFU */
-      if (fota_dfu_process(datagram) != FOTA_ERROR_SUCCESS) {
+      FotaError error = fota_dfu_process(datagram);
+
+      if (datagram->header.type == FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK) {
+        /* Every chunk is answered, duplicates included, so a lost acknowledgement is repaired by the next chunk */
+        fota_send_selective_ack(datagram->header.datagram_id);
+      } else if (error != FOTA_ERROR_SUCCESS) {
         /* Generate NACK response */
       }
     } break;
@@ -44,7 +67,7 @@ static void fota_datagram_complete_cb(FotaDatagram *datagram) {
 FotaError fota_init() {
   fota_startup();
 
-  packet_manager_init(&packet_manager, UART_PORT_2, &network_uart_settings, fota_datagram_complete_cb);
+  packet_manager_init(&packet_manager, FOTA_NETWORK_UART_PORT, &network_uart_settings, fota_datagram_complete_cb);
 
   fota_encryption_init();
 
@@ -19,6 +19,7 @@
 #define FOTA_DATAGRAM_HEADER_TOTAL_LENGTH_INDEX 0U
 #define FOTA_DATAGRAM_HEADER_NUM_PACKETS_INDEX 4U
 #define FOTA_DATAGRAM_HEADER_NODE_ID_INDEX 6U
+#define FOTA_DATAGRAM_HEADER_TYPE_INDEX 7U
 #define FOTA_DATAGRAM_HEADER_DATAGRAM_CRC32_INDEX 8U
 #define FOTA_DATAGRAM_BYTE_MASK 0xFFU
 #define FOTA_DATAGRAM_WORD_SIZE 4U
@@ -46,7 +47,8 @@ FotaError fota_datagram_init(FotaDatagram *datagram, FotaDatagramType type, uint
 
     datagram->header.datagram_crc32 = fota_calculate_crc32(data, length / FOTA_DATAGRAM_WORD_SIZE);
   } else {
-    datagram->header.datagram_crc32 = 0U;
+    /* An empty datagram still carries the CRC of no data, which is the CRC unit's initial value */
+    datagram->header.datagram_crc32 = fota_calculate_crc32(datagram->data, 0U);
   }
 
   return FOTA_ERROR_SUCCESS;
@@ -75,9 +77,9 @@ FotaError fota_datagram_to_packets(FotaDatagram *datagram, FotaPacket *packets,
   header->payload[FOTA_DATAGRAM_HEADER_NUM_PACKETS_INDEX] = (uint8_t)(datagram->header.num_packets & FOTA_DATAGRAM_BYTE_MASK);
   header->payload[FOTA_DATAGRAM_HEADER_NUM_PACKETS_INDEX + 1U] = (uint8_t)((datagram->header.num_packets >> 8U) & FOTA_DATAGRAM_BYTE_MASK);
 
-  /* Target node ID encoded in little-endian */
-  header->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX] = (uint8_t)(datagram->header.target_node_id & FOTA_DATAGRAM_BYTE_MASK);
-  header->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX + 1U] = (uint8_t)((datagram->header.target_node_id >> 8U) & FOTA_DATAGRAM_BYTE_MASK);
+  /* Target node ID and datagram type, so the receiver can tell metadata from firmware chunks */
+  header->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX] = datagram->header.target_node_id;
+  header->payload[FOTA_DATAGRAM_HEADER_TYPE_INDEX] = (uint8_t)(datagram->header.type & FOTA_DATAGRAM_BYTE_MASK);
 
   /* Datagram CRC32 stored in little-endian */
   header->payload[FOTA_DATAGRAM_HEADER_DATAGRAM_CRC32_INDEX] = (uint8_t)(datagram->header.datagram_crc32 & FOTA_DATAGRAM_BYTE_MASK);
@@ -149,7 +151,8 @@ FotaError fota_datagram_process_header_packet(FotaDatagram *datagram, FotaPacket
                                    ((uint32_t)packet->payload[FOTA_DATAGRAM_HEADER_TOTAL_LENGTH_INDEX + 1U] << 8U) | ((uint32_t)packet->payload[FOTA_DATAGRAM_HEADER_TOTAL_LENGTH_INDEX]));
 
   datagram->header.num_packets = ((uint16_t)packet->payload[FOTA_DATAGRAM_HEADER_NUM_PACKETS_INDEX + 1U] << 8U) | (uint16_t)packet->payload[FOTA_DATAGRAM_HEADER_NUM_PACKETS_INDEX];
-  datagram->header.target_node_id = ((uint16_t)packet->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX + 1U] << 8U) | (uint16_t)packet->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX];
+  datagram->header.target_node_id = packet->payload[FOTA_DATAGRAM_HEADER_NODE_ID_INDEX];
+  datagram->header.type = (FotaDatagramType)packet->payload[FOTA_DATAGRAM_HEADER_TYPE_INDEX];
 
   datagram->packets_received = 0U;
   datagram->is_complete = false;
@@ -76,24 +76,56 @@ static FotaError fota_dfu_write_chunk(FotaDatagram *datagram) {
   }
 
   FotaDatagramPayload_FirmwareChunk *chunk = (FotaDatagramPayload_FirmwareChunk *)datagram->data;
+  uint32_t chunk_id = datagram->header.datagram_id;
 
-  if (datagram->header.datagram_id != fota_dfu_context.expected_datagram_id) {
+  /* Retransmissions of written chunks are acknowledged again, flash cannot be rewritten without an erase */
+  if (chunk_id < fota_dfu_context.window_base_id) {
+    return FOTA_ERROR_SUCCESS;
+  }
+
+  uint32_t window_offset = chunk_id - fota_dfu_context.window_base_id;
+
+  if (chunk_id >= fota_dfu_context.num_chunks || window_offset >= FOTA_DFU_WINDOW_SIZE) {
     return FOTA_ERROR_BOOTLOADER_SEQUENCE_OUT_OF_ORDER;
   }
 
-  if ((fota_dfu_context.bytes_written + datagram->header.total_length) > fota_dfu_context.binary_size) {
+  if (fota_dfu_context.window_bitmap & (1U << window_offset)) {
+    return FOTA_ERROR_SUCCESS;
+  }
+
+  uint32_t offset = chunk_id * fota_dfu_context.chunk_size;
+  uint32_t expected_length = fota_dfu_context.binary_size - offset;
+
+  if (expected_length > fota_dfu_context.chunk_size) {
+    expected_length = fota_dfu_context.chunk_size;
+  }
+
+  if (datagram->header.total_length > expected_length) {
     return FOTA_ERROR_BOOTLOADER_BINARY_OVERSIZED;
   }
 
-  FotaError error = fota_flash_write(fota_dfu_context.current_write_addr, chunk->data, datagram->header.total_length);
+  if (datagram->header.total_length != expected_length) {
+    return FOTA_ERROR_BOOTLOADER_INVALID_DATAGRAM;
+  }
+
+  /* Only the last chunk can be unaligned. Pad it with erased flash so it can be written in whole words */
+  uint32_t write_length = (expected_length + FOTA_DFU_WORD_SIZE - 1U) & ~(FOTA_DFU_WORD_SIZE - 1U);
+  memset(&chunk->data[expected_length], 0xFFU, write_length - expected_length);
+
+  FotaError error = fota_flash_write(fota_dfu_context.staging_base_addr + offset, chunk->data, write_length);
 
   if (error != FOTA_ERROR_SUCCESS) {
     return error;
   }
 
-  fota_dfu_context.current_write_addr += datagram->header.total_length;
-  fota_dfu_context.bytes_written += datagram->header.total_length;
-  fota_dfu_context.expected_datagram_id++;
+  fota_dfu_context.bytes_written += expected_length;
+  fota_dfu_context.window_bitmap |= (1U << window_offset);
+
+  /* Slide the window past every contiguous chunk that has been written */
+  while (fota_dfu_context.window_bitmap & 1U) {
+    fota_dfu_context.window_bitmap >>= 1U;
+    fota_dfu_context.window_base_id++;
+  }
 
   return FOTA_ERROR_SUCCESS;
 }
@@ -114,10 +146,13 @@ FotaError fota_dfu_init(PacketManager *packet_manager, uintptr_t staging_base, u
   fota_dfu_context.packet_manager = packet_manager;
   fota_dfu_context.staging_base_addr = staging_base;
   fota_dfu_context.app_start_addr = app_start_addr;
-  fota_dfu_context.current_write_addr = staging_base;
   fota_dfu_context.bytes_written = 0U;
   fota_dfu_context.binary_size = 0U;
-  fota_dfu_context.expected_datagram_id = 0U;
+  fota_dfu_context.chunk_size = 0U;
+  fota_dfu_context.num_chunks = 0U;
+  fota_dfu_context.window_base_id = 0U;
+  fota_dfu_context.window_bitmap = 0U;
+  fota_dfu_context.last_error = FOTA_ERROR_SUCCESS;
   fota_dfu_context.state = FOTA_DFU_IDLE;
   fota_dfu_context.is_initialized = true;
 
@@ -142,14 +177,21 @@ FotaError fota_dfu_process(FotaDatagram *datagram) {
 
       FotaDatagramPayload_FirmwareMetadata *metadata = (FotaDatagramPayload_FirmwareMetadata *)datagram->data;
 
+      if (metadata->binary_size == 0U || metadata->chunk_size == 0U || metadata->chunk_size > FOTA_MAX_DATAGRAM_SIZE || (metadata->chunk_size % FOTA_DFU_WORD_SIZE) != 0U) {
+        return FOTA_ERROR_BOOTLOADER_INVALID_DATAGRAM;
+      }
+
       fota_dfu_context.binary_size = metadata->binary_size;
       fota_dfu_context.expected_crc32 = metadata->expected_binary_crc32;
       fota_dfu_context.version_major = metadata->version_major;
       fota_dfu_context.version_minor = metadata->version_minor;
       memcpy(fota_dfu_context.firmware_id, metadata->firmware_id, FOTA_FIRMWARE_ID_LENGTH);
+      fota_dfu_context.chunk_size = metadata->chunk_size;
+      fota_dfu_context.num_chunks = (metadata->binary_size + metadata->chunk_size - 1U) / metadata->chunk_size;
       fota_dfu_context.bytes_written = 0U;
-      fota_dfu_context.expected_datagram_id = 0U;
-      fota_dfu_context.current_write_addr = fota_dfu_context.staging_base_addr;
+      fota_dfu_context.window_base_id = 0U;
+      fota_dfu_context.window_bitmap = 0U;
+      fota_dfu_context.last_error = FOTA_ERROR_SUCCESS;
 
       uint32_t pages = (fota_dfu_context.binary_size + FOTA_PAGE_BYTES - 1U) / FOTA_PAGE_BYTES;
       FotaError error = fota_flash_erase(FOTA_ADDR_TO_PAGE(fota_dfu_context.staging_base_addr), pages);
@@ -168,11 +210,13 @@ FotaError fota_dfu_process(FotaDatagram *datagram) {
       }
 
       FotaError error = fota_dfu_write_chunk(datagram);
+      fota_dfu_context.last_error = error;
+
       if (error != FOTA_ERROR_SUCCESS) {
         return error;
       }
 
-      if (fota_dfu_context.bytes_written >= fota_dfu_context.binary_size) {
+      if (fota_dfu_context.window_base_id >= fota_dfu_context.num_chunks) {
         fota_dfu_context.state = FOTA_DFU_COMPLETE;
       }
     } break;
@@ -228,3 +272,19 @@ FotaError fota_dfu_process(FotaDatagram *datagram) {
 
   return FOTA_ERROR_SUCCESS;
 }
+
+FotaError fota_dfu_get_selective_ack(FotaDatagramPayload_SelectiveAck *sack) {
+  if (sack == NULL) {
+    return FOTA_ERROR_INVALID_ARGS;
+  }
+
+  if (!fota_dfu_context.is_initialized) {
+    return FOTA_ERROR_BOOTLOADER_UNINITIALIZED;
+  }
+
+  sack->window_base_id = fota_dfu_context.window_base_id;
+  sack->window_bitmap = fota_dfu_context.window_bitmap;
+  sack->error_code = (uint32_t)fota_dfu_context.last_error;
+
+  return FOTA_ERROR_SUCCESS;
+}
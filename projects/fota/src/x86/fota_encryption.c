@@ -11,6 +11,7 @@
 #include <stddef.h>
 
 /* Inter-component Headers */
+#include "crc.h"
 
 /* Intra-component Headers */
 #include "fota_encryption.h"
@@ -18,24 +19,40 @@
 
 #define FOTA_ENCRYPTION_WORD_SIZE 4U
 
-static uint32_t crc32_compute(uint8_t *data, uint32_t len_bytes) {
-  uint32_t crc = 0xFFFFFFFFU;
+FotaError fota_encryption_init() {
+  if (crc_init(CRC_LENGTH_32) != STATUS_CODE_OK) {
+    return FOTA_ERROR_INTERNAL_ERROR;
+  }
 
-  for (uint32_t i = 0U; i < len_bytes; ++i) {
-    crc ^= data[i];
-    for (uint8_t j = 0; j < 8U; ++j) {
-      if (crc & 1U)
-        crc = (crc >> 1) ^ 0xEDB88320U;
-      else
-        crc >>= 1;
-    }
+  return FOTA_ERROR_SUCCESS;
+}
+
+void fota_crc32_init(FotaCrc32Context *context) {
+  if (context == NULL) {
+    return;
   }
 
-  return ~crc;
+  CRCContext crc_context;
+  crc_start(&crc_context);
+  context->crc = crc_finalize(&crc_context);
 }
 
-FotaError fota_encryption_init() {
-  return FOTA_ERROR_SUCCESS;
+void fota_crc32_update(FotaCrc32Context *context, uint8_t *data, uint32_t length_words) {
+  if (context == NULL || data == NULL) {
+    return;
+  }
+
+  CRCContext crc_context = { .crc = context->crc };
+  crc_update(&crc_context, (const uint32_t *)data, length_words);
+  context->crc = crc_finalize(&crc_context);
+}
+
+uint32_t fota_crc32_finalize(FotaCrc32Context *context) {
+  if (context == NULL) {
+    return 0U;
+  }
+
+  return context->crc;
 }
 
 uint32_t fota_calculate_crc32(uint8_t *data_start, uint32_t word_size) {
@@ -43,12 +60,37 @@ uint32_t fota_calculate_crc32(uint8_t *data_start, uint32_t word_size) {
     return 0U;
   }
 
-  return crc32_compute(data_start, word_size * FOTA_ENCRYPTION_WORD_SIZE);
+  return crc_calculate((const uint32_t *)data_start, word_size);
 }
 
 uint32_t fota_calculate_crc32_on_flash_memory(uintptr_t flash_base_addr, uint32_t flash_size) {
   /* FOTA Flash layer will handle invalid addresses */
-  return 0;
+  if (flash_size == 0U) {
+    return 0U;
+  }
+
+  if ((flash_size % FOTA_ENCRYPTION_WORD_SIZE) != 0U || (flash_base_addr % FOTA_ENCRYPTION_WORD_SIZE) != 0U) {
+    return 0U;
+  }
+
+  uint8_t page_buf[FOTA_PAGE_BYTES];
+  FotaCrc32Context context;
+  fota_crc32_init(&context);
+
+  while (flash_size > 0U) {
+    uint32_t chunk = (flash_size > FOTA_PAGE_BYTES) ? FOTA_PAGE_BYTES : flash_size;
+
+    if (fota_flash_read(flash_base_addr, page_buf, chunk) != FOTA_ERROR_SUCCESS) {
+      return 0U;
+    }
+
+    fota_crc32_update(&context, page_buf, chunk / FOTA_ENCRYPTION_WORD_SIZE);
+
+    flash_base_addr += chunk;
+    flash_size -= chunk;
+  }
+
+  return fota_crc32_finalize(&context);
 }
 
 FotaError fota_verify_packet_encryption(FotaPacket *packet) {
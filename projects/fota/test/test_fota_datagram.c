@@ -289,3 +289,19 @@ void test_fota_header_packet_contains_target_node_id(void) {
   TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, err);
   TEST_ASSERT_EQUAL(0x2A, s_datagram_reconstructed.header.target_node_id);
 }
+
+TEST_IN_TASK
+void test_fota_header_packet_contains_datagram_type(void) {
+  FotaError err = fota_datagram_init(&s_datagram, FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, 0x1234, s_original_data, 128);
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, err);
+
+  uint16_t num_packets = 0;
+  err = fota_datagram_to_packets(&s_datagram, s_packets, &num_packets, FOTA_MAX_PACKETS_PER_DATAGRAM);
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, err);
+
+  /* The receiver starts every datagram as a firmware chunk until its header arrives */
+  s_datagram_reconstructed.header.type = FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK;
+  err = fota_datagram_process_header_packet(&s_datagram_reconstructed, &s_packets[0]);
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, err);
+  TEST_ASSERT_EQUAL(FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA, s_datagram_reconstructed.header.type);
+}
@@ -62,6 +62,7 @@ void test_fota_end_to_end() {
     .expected_binary_crc32 = expected_crc,
     .version_major = 1,
     .version_minor = 0,
+    .chunk_size = 64,
   };
 
   memcpy(metadata_payload.firmware_id, "TEST_FW_ID_01", 13);
@@ -102,3 +103,61 @@ void test_fota_end_to_end() {
   TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, err);
   TEST_ASSERT_EQUAL(0, memcmp(verify_buf, firmware_data, sizeof(firmware_data)));
 }
+
+void test_fota_out_of_order_chunks() {
+  const uintptr_t staging = APP_STAGING_START_ADDRESS;
+  const uintptr_t app_start = APP_ACTIVE_START_ADDRESS;
+  const uint32_t chunk_size = 64;
+
+  PacketManager dummy_pm = { 0 };
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_dfu_init(&dummy_pm, staging, app_start));
+
+  uint8_t firmware_data[500];
+  for (uint32_t i = 0; i < sizeof(firmware_data); i++) {
+    firmware_data[i] = (uint8_t)(i * 7U);
+  }
+
+  FotaDatagram metadata = { 0 };
+  metadata.header.type = FOTA_DATAGRAM_TYPE_FIRMWARE_METADATA;
+  metadata.is_complete = true;
+
+  FotaDatagramPayload_FirmwareMetadata metadata_payload = {
+    .binary_size = sizeof(firmware_data),
+    .expected_binary_crc32 = fota_calculate_crc32(firmware_data, sizeof(firmware_data) / 4),
+    .chunk_size = chunk_size,
+  };
+  memcpy(metadata.data, &metadata_payload, sizeof(metadata_payload));
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_dfu_process(&metadata));
+
+  // Chunk 2 is lost until the end, chunk 5 is duplicated and the short last chunk arrives first
+  const uint16_t arrival_order[] = { 7, 0, 1, 3, 5, 5, 4, 6, 2 };
+  const uint32_t expected_base[] = { 0, 1, 2, 2, 2, 2, 2, 2, 8 };
+  FotaDatagramPayload_SelectiveAck sack = { 0 };
+
+  for (uint32_t i = 0; i < sizeof(arrival_order) / sizeof(arrival_order[0]); i++) {
+    uint32_t offset = arrival_order[i] * chunk_size;
+    uint32_t chunk_len = (sizeof(firmware_data) - offset > chunk_size) ? chunk_size : (sizeof(firmware_data) - offset);
+
+    FotaDatagram chunk = { 0 };
+    chunk.header.type = FOTA_DATAGRAM_TYPE_FIRMWARE_CHUNK;
+    chunk.header.total_length = chunk_len;
+    chunk.header.datagram_id = arrival_order[i];
+    chunk.is_complete = true;
+    memcpy(chunk.data, firmware_data + offset, chunk_len);
+
+    TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_dfu_process(&chunk));
+    TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_dfu_get_selective_ack(&sack));
+    TEST_ASSERT_EQUAL(expected_base[i], sack.window_base_id);
+
+    // Chunks 3 to 7 are held in the window behind the missing chunk 2
+    if (arrival_order[i] == 6) {
+      TEST_ASSERT_EQUAL(0x3E, sack.window_bitmap);
+    }
+  }
+
+  TEST_ASSERT_EQUAL(0, sack.window_bitmap);
+
+  uint8_t verify_buf[sizeof(firmware_data)];
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_flash_read(app_start, verify_buf, sizeof(verify_buf)));
+  TEST_ASSERT_EQUAL(0, memcmp(verify_buf, firmware_data, sizeof(firmware_data)));
+}
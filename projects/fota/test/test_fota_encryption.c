@@ -0,0 +1,65 @@
+/************************************************************************************************
+ * @file   test_fota_encryption.c
+ *
+ * @brief  Unit tests for the FOTA CRC32
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "fota_encryption.h"
+#include "fota_flash.h"
+#include "fota_memory_map.h"
+
+#define TEST_IMAGE_SIZE (3U * FOTA_PAGE_BYTES + 64U)
+
+static uint8_t s_image[TEST_IMAGE_SIZE];
+
+void setup_test(void) {
+  for (uint32_t i = 0U; i < TEST_IMAGE_SIZE; i++) {
+    s_image[i] = (uint8_t)(i * 131U + 7U);
+  }
+}
+
+void teardown_test(void) {}
+
+void test_fota_crc32_matches_stm32_crc_unit(void) {
+  /* Reference value from the STM32 CRC unit with its reset configuration, for the word 0x12345678 */
+  uint8_t word[4] = { 0x78, 0x56, 0x34, 0x12 };
+  TEST_ASSERT_EQUAL_HEX32(0xDF8A8A2BU, fota_calculate_crc32(word, 1U));
+}
+
+void test_fota_crc32_incremental(void) {
+  uint32_t expected = fota_calculate_crc32(s_image, TEST_IMAGE_SIZE / 4U);
+
+  /* Odd word counts exercise the single word tail between updates */
+  FotaCrc32Context context;
+  fota_crc32_init(&context);
+  fota_crc32_update(&context, s_image, 3U);
+  fota_crc32_update(&context, s_image + 12U, 1U);
+  fota_crc32_update(&context, s_image + 16U, (TEST_IMAGE_SIZE - 16U) / 4U);
+
+  TEST_ASSERT_EQUAL_HEX32(expected, fota_crc32_finalize(&context));
+}
+
+void test_fota_crc32_on_flash_memory(void) {
+  const uintptr_t staging = APP_STAGING_START_ADDRESS;
+
+  TEST_ASSERT_EQUAL(FOTA_ERROR_SUCCESS, fota_flash_write(staging, s_image, TEST_IMAGE_SIZE));
+  TEST_ASSERT_EQUAL_HEX32(fota_calculate_crc32(s_image, TEST_IMAGE_SIZE / 4U), fota_calculate_crc32_on_flash_memory(staging, TEST_IMAGE_SIZE));
+
+  /* A single flipped bit anywhere in the image changes the CRC */
+  s_image[TEST_IMAGE_SIZE - 1U] ^= 0x01U;
+  TEST_ASSERT_NOT_EQUAL(fota_calculate_crc32(s_image, TEST_IMAGE_SIZE / 4U), fota_calculate_crc32_on_flash_memory(staging, TEST_IMAGE_SIZE));
+
+  TEST_ASSERT_EQUAL(0U, fota_calculate_crc32_on_flash_memory(staging + 2U, TEST_IMAGE_SIZE));
+}
@@ -26,7 +26,11 @@
  */
 
 typedef struct PowerManagerStorage {
-  uint16_t current_readings[NUM_OUTPUTS];
+  uint16_t current_readings[NUM_OUTPUTS]; /**< Currents from the last completed sweep, published to telemetry */
+  uint16_t sweep_readings[NUM_OUTPUTS];   /**< Currents of the sweep in progress */
+  OutputId mux_position;                  /**< Output currently selected on the current sense mux */
+  bool mux_selected;                      /**< Set once the mux has had a cycle to settle on mux_position */
+  uint32_t num_sweeps;                    /**< Number of completed sweeps */
 } PowerManagerStorage;
 
 #define FRONT_OPEN_LOAD_SWITCH_DELAY_MS 40U
@@ -50,7 +54,12 @@ StatusCode power_manager_set_output_group(OutputGroup group, bool enable);
 StatusCode power_manager_toggle_output_group(OutputGroup group);
 
 /**
- * @brief   Run current sensing
+ * @brief   Advance the current sense mux scan by one output
+ * @details Must be called right after adc_run. The conversion of the selected output is read, then the mux is
+ *          switched to the next enabled output so it settles before the next conversion. Readings are published
+ *          to telemetry once every enabled output has been sampled
+ * @return  STATUS_CODE_OK if the scan advanced successfully
+ *          STATUS_CODE_UNINITIALIZED if power_manager_init has not been called
  */
 StatusCode power_manager_run_current_sense();
 
@@ -62,7 +62,11 @@ void pre_loop_init() {
 
 void run_1000hz_cycle() {
   run_can_rx_all();
-  adc_run();
+
+  /* The current sense mux advances one output per conversion */
+  if (adc_run() == STATUS_CODE_OK) {
+    power_manager_run_current_sense();
+  }
 
   accel_pedal_run();
   brake_pedal_run();
@@ -79,7 +83,6 @@ void run_10hz_cycle() {
 
 void run_1hz_cycle() {
   run_can_tx_slow();
-  power_manager_run_current_sense();
 }
 
 #ifdef MS_PLATFORM_X86
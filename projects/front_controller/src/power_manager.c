@@ -8,6 +8,7 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <string.h>
 
 /* Inter-component Headers */
 #include "adc.h"
@@ -173,6 +174,23 @@ static void power_manager_set_telemetry() {
   }
 }
 
+/* Mux select pins are driven with the bits of the output ID, which matches the schematic mux indices */
+static void s_select_mux_output(OutputId output_id) {
+  gpio_set_state(&MUX_SEL_0, (output_id & 0x1U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
+  gpio_set_state(&MUX_SEL_1, (output_id & 0x2U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
+  gpio_set_state(&MUX_SEL_2, (output_id & 0x4U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
+  gpio_set_state(&MUX_SEL_3, (output_id & 0x8U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
+  s_power_manager_storage.mux_position = output_id;
+}
+
+/* First enabled output at or after output_id, NUM_OUTPUTS if there is none */
+static OutputId s_next_enabled_output(uint8_t output_id) {
+  while (output_id < NUM_OUTPUTS && !s_output_pin_enabled[output_id]) {
+    output_id++;
+  }
+  return (OutputId)output_id;
+}
+
 /************************************************************************************************
  * Public functions
  ************************************************************************************************/
@@ -185,6 +203,10 @@ StatusCode power_manager_init(FrontControllerStorage *storage) {
   front_controller_storage = storage;
   front_controller_storage->power_manager_storage = &s_power_manager_storage;
 
+  /* Every output starts disabled, so the current sense scan starts from an empty sweep */
+  memset(&s_power_manager_storage, 0, sizeof(s_power_manager_storage));
+  memset(s_output_pin_enabled, 0, sizeof(s_output_pin_enabled));
+
   for (uint8_t i = 0; i < NUM_OUTPUTS; i++) {
     gpio_init_pin(&output_pins[i], GPIO_OUTPUT_PUSH_PULL, GPIO_STATE_LOW);
   }
@@ -205,31 +227,41 @@ StatusCode power_manager_run_current_sense() {
     return STATUS_CODE_UNINITIALIZED;
   }
 
-  OutputGroupDef *mapped_group = output_group_map[OUTPUT_GROUP_ALL];
+  PowerManagerStorage *storage = front_controller_storage->power_manager_storage;
 
-  for (uint16_t i = 0; i < mapped_group->num_outputs; i++) {
-    /* Set mux select pins using the bits of i */
-    if (!s_output_pin_enabled[i]) {
-      continue;
+  /* The conversion that just finished sampled the output selected on the previous call */
+  bool sampled = storage->mux_selected && s_output_pin_enabled[storage->mux_position];
+  if (sampled) {
+    uint16_t sampled_voltage;
+    status_ok_or_return(adc_read_converted(&MUX_OUT, &sampled_voltage));
+
+    if (storage->mux_position == HORN) {
+      storage->sweep_readings[storage->mux_position] = power_sense_hi_current_calc(sampled_voltage);
+    } else {
+      storage->sweep_readings[storage->mux_position] = power_sense_lo_current_calc(sampled_voltage);
     }
-    gpio_set_state(&MUX_SEL_0, (i & 0x1U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
-    gpio_set_state(&MUX_SEL_1, (i & 0x2U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
-    gpio_set_state(&MUX_SEL_2, (i & 0x4U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
-    gpio_set_state(&MUX_SEL_3, (i & 0x8U) ? GPIO_STATE_HIGH : GPIO_STATE_LOW);
+  }
 
-    adc_run();
+  OutputId next_output = s_next_enabled_output(storage->mux_selected ? storage->mux_position + 1U : 0U);
 
-    uint16_t sampled_voltage;
-    adc_read_converted(&MUX_OUT, &sampled_voltage);
+  if (next_output == NUM_OUTPUTS) {
+    /* Every enabled output has been sampled, publish the sweep and start the next one */
+    if (sampled) {
+      memcpy(storage->current_readings, storage->sweep_readings, sizeof(storage->current_readings));
+      power_manager_set_telemetry();
+      storage->num_sweeps++;
+    }
 
-    if (i == HORN) {
-      front_controller_storage->power_manager_storage->current_readings[i] = power_sense_hi_current_calc(sampled_voltage);
-    } else {
-      front_controller_storage->power_manager_storage->current_readings[i] = power_sense_lo_current_calc(sampled_voltage);
+    next_output = s_next_enabled_output(0U);
+    if (next_output == NUM_OUTPUTS) {
+      storage->mux_selected = false;
+      return STATUS_CODE_OK;
     }
   }
 
-  power_manager_set_telemetry();
+  /* Switching now lets the mux settle for the rest of the cycle, before the next conversion */
+  s_select_mux_output(next_output);
+  storage->mux_selected = true;
 
   return STATUS_CODE_OK;
 }
@@ -0,0 +1,148 @@
+/************************************************************************************************
+ * @file   test_power_manager.c
+ *
+ * @brief  Unit tests for the power manager current sense scan
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "adc.h"
+#include "gpio.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "front_controller.h"
+#include "front_controller_hw_defs.h"
+#include "front_controller_setters.h"
+#include "power_manager.h"
+#include "power_outputs.h"
+
+/* Conversions lose up to 1mV, which is 3mA on the horn's high side sense */
+#define TEST_CURRENT_TOLERANCE 3U
+
+static FrontControllerStorage mock_storage = { 0 };
+static GpioAddress s_mux_out = GPIO_FRONT_CONTROLLER_MUX_OUTPUT;
+static GpioAddress s_mux_sel[] = { GPIO_FRONT_CONTROLLER_MUX_SEL_0, GPIO_FRONT_CONTROLLER_MUX_SEL_1, GPIO_FRONT_CONTROLLER_MUX_SEL_2, GPIO_FRONT_CONTROLLER_MUX_SEL_3 };
+
+/* Sense voltage of each output in mV, indexed by mux position */
+static uint16_t s_sense_mv[NUM_OUTPUTS];
+static uint32_t s_num_conversions = 0U;
+
+/* The mux passes through the sense voltage of the output its select pins point at */
+static uint16_t s_mux_source(GpioAddress *address, void *context) {
+  uint8_t position = 0U;
+  for (uint8_t i = 0U; i < sizeof(s_mux_sel) / sizeof(s_mux_sel[0]); i++) {
+    if (gpio_get_state(&s_mux_sel[i]) == GPIO_STATE_HIGH) {
+      position |= (1U << i);
+    }
+  }
+
+  s_num_conversions++;
+  return (position < NUM_OUTPUTS) ? s_sense_mv[position] : 0U;
+}
+
+/* One 1000hz cycle, as run by main */
+static void s_run_cycle(void) {
+  TEST_ASSERT_OK(adc_run());
+  TEST_ASSERT_OK(power_manager_run_current_sense());
+}
+
+static uint16_t s_expected_current(OutputId output_id) {
+  /* Low side outputs sense 1000mA/V, the horn is on the high side at 3000mA/V */
+  return (output_id == HORN) ? s_sense_mv[output_id] * 3U : s_sense_mv[output_id] / 10U;
+}
+
+void setup_test(void) {
+  adc_deinit();
+  s_num_conversions = 0U;
+
+  for (uint8_t i = 0U; i < NUM_OUTPUTS; i++) {
+    s_sense_mv[i] = 100U * (i + 1U);
+  }
+
+  TEST_ASSERT_OK(power_manager_init(&mock_storage));
+  TEST_ASSERT_OK(adc_init());
+  TEST_ASSERT_OK(adc_set_mock_source(&s_mux_out, s_mux_source, NULL));
+}
+
+void teardown_test(void) {}
+
+TEST_IN_TASK
+void test_sweep_reads_every_output(void) {
+  PowerManagerStorage *storage = mock_storage.power_manager_storage;
+  TEST_ASSERT_OK(power_manager_toggle_output_group(OUTPUT_GROUP_ALL));
+
+  /* The first cycle only selects the first output, then each cycle samples one output */
+  for (uint8_t i = 0U; i < NUM_OUTPUTS; i++) {
+    s_run_cycle();
+    TEST_ASSERT_EQUAL_UINT32(0U, storage->num_sweeps);
+  }
+  s_run_cycle();
+  TEST_ASSERT_EQUAL_UINT32(1U, storage->num_sweeps);
+
+  /* One ADC scan per output, with no extra conversions */
+  TEST_ASSERT_EQUAL_UINT32(NUM_OUTPUTS + 1U, s_num_conversions);
+
+  for (uint8_t i = 0U; i < NUM_OUTPUTS; i++) {
+    TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, s_expected_current(i), storage->current_readings[i]);
+  }
+
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, s_expected_current(HORN), g_tx_struct.fc_power_group_B_horn_current);
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, s_expected_current(LEFT_SIG), g_tx_struct.fc_power_lights_group_left_sig_current);
+}
+
+TEST_IN_TASK
+void test_sweep_publishes_only_when_complete(void) {
+  PowerManagerStorage *storage = mock_storage.power_manager_storage;
+  TEST_ASSERT_OK(power_manager_toggle_output_group(OUTPUT_GROUP_ALL));
+
+  for (uint8_t i = 0U; i <= NUM_OUTPUTS; i++) {
+    s_run_cycle();
+  }
+
+  /* New readings stay in the sweep until every output has been sampled again */
+  s_sense_mv[HORN] = 1000U;
+  s_run_cycle();
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, 3000U, storage->sweep_readings[HORN]);
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, 300U, storage->current_readings[HORN]);
+
+  for (uint8_t i = 1U; i < NUM_OUTPUTS; i++) {
+    s_run_cycle();
+  }
+  TEST_ASSERT_EQUAL_UINT32(2U, storage->num_sweeps);
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, 3000U, storage->current_readings[HORN]);
+}
+
+TEST_IN_TASK
+void test_sweep_skips_disabled_outputs(void) {
+  PowerManagerStorage *storage = mock_storage.power_manager_storage;
+  TEST_ASSERT_OK(power_manager_toggle_output_group(OUTPUT_GROUP_HAZARD_LIGHTS));
+
+  /* Only the two signal lights are sampled, so a sweep completes every two cycles */
+  s_run_cycle();
+  s_run_cycle();
+  s_run_cycle();
+  TEST_ASSERT_EQUAL_UINT32(1U, storage->num_sweeps);
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, s_expected_current(RIGHT_SIG), storage->current_readings[RIGHT_SIG]);
+  TEST_ASSERT_UINT16_WITHIN(TEST_CURRENT_TOLERANCE, s_expected_current(LEFT_SIG), storage->current_readings[LEFT_SIG]);
+  TEST_ASSERT_EQUAL_UINT16(0U, storage->current_readings[HORN]);
+
+  s_run_cycle();
+  s_run_cycle();
+  TEST_ASSERT_EQUAL_UINT32(2U, storage->num_sweeps);
+
+  /* With nothing enabled the scan idles without publishing */
+  TEST_ASSERT_OK(power_manager_toggle_output_group(OUTPUT_GROUP_HAZARD_LIGHTS));
+  s_run_cycle();
+  s_run_cycle();
+  TEST_ASSERT_EQUAL_UINT32(2U, storage->num_sweeps);
+  TEST_ASSERT_FALSE(storage->mux_selected);
+}
@@ -10,6 +10,8 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
 
 /* Inter-component Headers */
 #include "can.h"
@@ -39,6 +41,35 @@
 #define BMI323_CHIP_ID 0x43U
 #define BMI323_MAX_NUM_DATA 16U
 
+/** @brief  Output data rate of both sensors, 400Hz */
+#define BMI323_ODR 0xAU
+/** @brief  Sample period at BMI323_ODR, used before two sensor timestamps are available */
+#define BMI323_ODR_PERIOD_S (1.0f / 400.0f)
+/** @brief  Sensor time resolution, 39.0625us per LSB */
+#define BMI323_SENSOR_TIME_S 0.0000390625f
+
+/** @brief  FIFO frame with accelerometer, gyroscope and sensor time enabled, in 16-bit words */
+#define BMI323_FIFO_FRAME_WORDS 7U
+/** @brief  Frames read in one SPI burst, limited by the SPI transaction size */
+#define BMI323_FIFO_BURST_FRAMES (SPI_MAX_NUM_DATA / (BMI323_FIFO_FRAME_WORDS * sizeof(uint16_t)))
+/** @brief  Frames queued before the watermark interrupt fires, 20ms at 400Hz */
+#define BMI323_FIFO_WATERMARK_FRAMES 8U
+/** @brief  Frames returned by one bmi323_read_fifo call */
+#define BMI323_FIFO_MAX_SAMPLES 32U
+/** @brief  Accelerometer X value of a frame without new accelerometer data */
+#define BMI323_FIFO_ACCEL_DUMMY 0x7F01U
+/** @brief  Gyroscope X value of a frame without new gyroscope data */
+#define BMI323_FIFO_GYRO_DUMMY 0x7F02U
+
+#define BMI323_FIFO_CONF_TIME_EN (1U << 8U)
+#define BMI323_FIFO_CONF_ACC_EN (1U << 9U)
+#define BMI323_FIFO_CONF_GYR_EN (1U << 10U)
+#define BMI323_FIFO_CTRL_FLUSH (1U << 0U)
+#define BMI323_FIFO_FILL_LEVEL_MASK 0x07FFU
+#define BMI323_IO_INT_CTRL_INT1_ACTIVE_HIGH (1U << 0U)
+#define BMI323_IO_INT_CTRL_INT1_OUTPUT_EN (1U << 2U)
+#define BMI323_INT_MAP2_FWM_INT1 (1U << 12U)
+
 /*
 this might be 13 or 14 idk
 #define BMI3_ACC_DP_OFF_XYZ_13_BIT_MASK              UINT16_C(0x1FFF)
@@ -86,6 +117,9 @@ typedef enum {
   BMI323_REG_ERROR_STATUS = 0x02, /**< Error Status Register */
   BMI323_REG_RESET = 0x63,        /**< Soft Reset Command Register */
 
+  /* Sensor Time Registers */
+  BMI323_REG_SENSOR_TIME_0 = 0x0A, /**< Sensor Time Low Word */
+
   /* Accelerometer Registers */
   BMI323_REG_ACCEL_REG_ADDR = 0x03, /**< Accelerometer Data Start Address */
   BMI323_REG_ACCEL_X_L = 0x12,      /**< Accelerometer X-axis Low Byte */
@@ -121,10 +155,20 @@ typedef enum {
   BMI323_REG_PWR_CTRL4 = 0x6F, /**< Power Control 4 Register */
 
   /* Interrupt Registers */
-  BMI323_REG_INT_CONFIG = 0x50, /**< Interrupt Configuration Register */
-  BMI323_REG_INT_STATUS = 0x51, /**< Interrupt Status Register */
-  BMI323_REG_INT_EN_1 = 0x52,   /**< Interrupt Enable 1 Register */
-  BMI323_REG_INT_EN_2 = 0x53,   /**< Interrupt Enable 2 Register */
+  BMI323_REG_INT_CONFIG = 0x50,  /**< Interrupt Configuration Register */
+  BMI323_REG_INT_STATUS = 0x51,  /**< Interrupt Status Register */
+  BMI323_REG_INT_EN_1 = 0x52,    /**< Interrupt Enable 1 Register */
+  BMI323_REG_INT_EN_2 = 0x53,    /**< Interrupt Enable 2 Register */
+  BMI323_REG_IO_INT_CTRL = 0x38, /**< Interrupt Pin Configuration Register */
+  BMI323_REG_INT_CONF = 0x39,    /**< Interrupt Latching Register */
+  BMI323_REG_INT_MAP2 = 0x3B,    /**< Interrupt Mapping 2 Register */
+
+  /* FIFO Registers */
+  BMI323_REG_FIFO_FILL_LEVEL = 0x15, /**< FIFO Fill Level in words */
+  BMI323_REG_FIFO_DATA = 0x16,       /**< FIFO Data Output, each read pops the next word */
+  BMI323_REG_FIFO_WATERMARK = 0x35,  /**< FIFO Watermark in words */
+  BMI323_REG_FIFO_CONF = 0x36,       /**< FIFO Frame Configuration Register */
+  BMI323_REG_FIFO_CTRL = 0x37,       /**< FIFO Control Register */
 
   /* Status Registers */
   BMI323_REG_STATUS_REG = 0x1E,  /**< Status Register */
@@ -178,6 +222,13 @@ typedef struct {
   float z;
 } Axes;
 
+/** @brief  Accelerometer and gyroscope frame read from the FIFO */
+typedef struct {
+  Axes accel; /**< Acceleration in Gs */
+  Axes gyro;  /**< Angular velocity in degrees per second */
+  float dt;   /**< Time since the previous frame in seconds, from the sensor time */
+} Bmi323Sample;
+
 typedef struct {
   SpiPort spi_port;
   SpiSettings spi_settings;
@@ -193,10 +244,26 @@ typedef struct {
   Axes gyro;
   AccelGainOffsetValues accel_go_values;
   GyroGainOffsetValues gyro_go_values;
+  Bmi323Sample fifo_samples[BMI323_FIFO_MAX_SAMPLES]; /**< Frames from the last bmi323_read_fifo call */
+  uint8_t num_fifo_samples;                           /**< Number of valid frames in fifo_samples */
+  uint8_t num_fifo_frames_read;                       /**< Frames popped by the last bmi323_read_fifo call, dummy frames included */
+  uint16_t last_sensor_time;                          /**< Sensor time of the newest frame read */
+  bool has_sensor_time;                               /**< Set once a frame has been read since the FIFO was flushed */
 } Bmi323Storage;
 
 StatusCode bmi323_init(Bmi323Storage *storage);
 
 StatusCode bmi323_update();
 
+/**
+ * @brief   Drain queued frames from the FIFO with burst reads
+ * @details Pops up to BMI323_FIFO_MAX_SAMPLES frames and keeps the valid ones in storage->fifo_samples.
+ *          Frames left in the FIFO are read by the next call, so callers loop while num_fifo_frames_read
+ *          comes back at the limit. Dummy frames are dropped, so num_fifo_samples can be lower
+ * @param   storage Pointer to the BMI323 storage
+ * @return  STATUS_CODE_OK if the FIFO was read successfully
+ *          STATUS_CODE_INVALID_ARGS if storage is NULL
+ */
+StatusCode bmi323_read_fifo(Bmi323Storage *storage);
+
 /** @} */
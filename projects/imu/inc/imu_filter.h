@@ -0,0 +1,138 @@
+#pragma once
+
+/************************************************************************************************
+ * @file   imu_filter.h
+ *
+ * @brief  Header file for the IMU orientation filter
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Inter-component Headers */
+#include "status.h"
+
+/* Intra-component Headers */
+#include "bmi323.h"
+
+/**
+ * @defgroup imu
+ * @brief    imu Firmware
+ * @{
+ */
+
+#define DELTA_T 0.1f
+#define PI 3.14159265358f
+#define GYRO_MEAN_ERROR (PI * (5.0f / 180.0f))
+#define BETA 0.8660254f * GYRO_MEAN_ERROR
+
+struct quaternion {
+  float q1;
+  float q2;
+  float q3;
+  float q4;
+};
+
+/** @brief  Madgwick filter state, one per sensor so the filter can be run from several contexts */
+typedef struct {
+  struct quaternion q; /**< Orientation estimate, unit quaternion with the real component in q1 */
+  float beta;          /**< Gain of the accelerometer correction, in radians per second */
+  float roll;          /**< Roll in degrees, valid while euler_valid is set */
+  float pitch;         /**< Pitch in degrees, valid while euler_valid is set */
+  float yaw;           /**< Yaw in degrees, valid while euler_valid is set */
+  bool euler_valid;    /**< Cleared by every update, the angles are only recomputed when read */
+} ImuFilter;
+
+struct quaternion quat_mult(struct quaternion q_L, struct quaternion q_R);
+static inline void quat_scalar(struct quaternion *q, float scalar) {
+  q->q1 *= scalar;
+  q->q2 *= scalar;
+  q->q3 *= scalar;
+  q->q4 *= scalar;
+}
+static inline void quat_add(struct quaternion *Sum, struct quaternion L, struct quaternion R) {
+  Sum->q1 = L.q1 + R.q1;
+  Sum->q2 = L.q2 + R.q2;
+  Sum->q3 = L.q3 + R.q3;
+  Sum->q4 = L.q4 + R.q4;
+}
+
+static inline void quat_sub(struct quaternion *Sum, struct quaternion L, struct quaternion R) {
+  Sum->q1 = L.q1 - R.q1;
+  Sum->q2 = L.q2 - R.q2;
+  Sum->q3 = L.q3 - R.q3;
+  Sum->q4 = L.q4 - R.q4;
+}
+
+static inline struct quaternion quat_conjugate(struct quaternion q) {
+  q.q2 = -q.q2;
+  q.q3 = -q.q3;
+  q.q4 = -q.q4;
+  return q;
+}
+
+static inline float quat_Norm(struct quaternion q) {
+  return sqrt(q.q1 * q.q1 + q.q2 * q.q2 + q.q3 * q.q3 + q.q4 * q.q4);
+}
+
+static inline void quat_Normalization(struct quaternion *q) {
+  float norm = quat_Norm(*q);
+  q->q1 /= norm;
+  q->q2 /= norm;
+  q->q3 /= norm;
+  q->q4 /= norm;
+}
+
+/**
+ * @brief   Reset the filter to the identity orientation
+ * @param   filter Pointer to the filter state
+ * @param   beta Gain of the accelerometer correction, BETA for the BMI323
+ * @return  STATUS_CODE_OK if the filter was initialized successfully
+ *          STATUS_CODE_INVALID_ARGS if filter is NULL
+ */
+StatusCode imu_filter_init(ImuFilter *filter, float beta);
+
+/**
+ * @brief   Run one step of the filter
+ * @details The accelerometer correction is skipped when the acceleration is zero, leaving gyroscope integration only
+ * @param   filter Pointer to the filter state
+ * @param   ax Acceleration along x, any unit as it is normalized
+ * @param   ay Acceleration along y
+ * @param   az Acceleration along z
+ * @param   gx Angular velocity about x in radians per second
+ * @param   gy Angular velocity about y in radians per second
+ * @param   gz Angular velocity about z in radians per second
+ * @param   dt Time since the previous step in seconds
+ */
+void imu_filter_update(ImuFilter *filter, float ax, float ay, float az, float gx, float gy, float gz, float dt);
+
+/**
+ * @brief   Run the filter on every frame read from the BMI323 FIFO
+ * @details Gyroscope readings are converted from degrees to radians per second, each frame uses its own dt
+ * @param   filter Pointer to the filter state
+ * @param   samples Frames in the order they were sampled
+ * @param   num_samples Number of frames in samples
+ * @return  STATUS_CODE_OK if the frames were filtered successfully
+ *          STATUS_CODE_INVALID_ARGS if filter or samples is NULL
+ */
+StatusCode imu_filter_update_batch(ImuFilter *filter, const Bmi323Sample *samples, size_t num_samples);
+
+/**
+ * @brief   Get the orientation as euler angles in degrees
+ * @details The conversion is only done when the orientation changed since the last call, so callers only pay
+ *          for it at the rate the angles are published
+ * @param   filter Pointer to the filter state
+ * @param   roll Rotation about x
+ * @param   pitch Rotation about y
+ * @param   yaw Rotation about z
+ * @return  STATUS_CODE_OK if the angles were read successfully
+ *          STATUS_CODE_INVALID_ARGS if any argument is NULL
+ */
+StatusCode imu_filter_get_euler(ImuFilter *filter, float *roll, float *pitch, float *yaw);
+
+/** @} */
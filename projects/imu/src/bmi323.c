@@ -52,6 +52,9 @@ static StatusCode s_set_multi_register(Bmi323Registers reg, uint16_t *data, uint
 static StatusCode get_gyroscope_data(Axes *gyro);
 static StatusCode get_accel_data(Axes *accel);
 
+static StatusCode s_configure_fifo();
+static void s_parse_fifo_frame(Bmi323Storage *storage, const uint16_t *frame);
+
 // static StatusCode get_gyro_offset_gain(GyroGainOffsetValues *gyro_go_values);
 static StatusCode set_gyro_offset_gain(GyroGainOffsetValues *gyro_go_values);
 // static StatusCode get_accel_offset_gain(AccelGainOffsetValues *accel_go_values);
@@ -501,6 +504,53 @@ static void s_calculate_gyro_offset() {
   imu_storage->gyro_go_values.gyro_offset_z = (uint16_t)gyr_z_off;
 }
 
+static StatusCode s_configure_fifo() {
+  /* Every frame carries accel, gyro and the sensor time it was sampled at */
+  status_ok_or_return(s_set_register(BMI323_REG_FIFO_CONF, BMI323_FIFO_CONF_ACC_EN | BMI323_FIFO_CONF_GYR_EN | BMI323_FIFO_CONF_TIME_EN));
+  status_ok_or_return(s_set_register(BMI323_REG_FIFO_WATERMARK, BMI323_FIFO_WATERMARK_FRAMES * BMI323_FIFO_FRAME_WORDS));
+
+  /* INT1 is push-pull active high and not latched, so it rises each time the fill level reaches the watermark */
+  status_ok_or_return(s_set_register(BMI323_REG_IO_INT_CTRL, BMI323_IO_INT_CTRL_INT1_ACTIVE_HIGH | BMI323_IO_INT_CTRL_INT1_OUTPUT_EN));
+  status_ok_or_return(s_set_register(BMI323_REG_INT_CONF, 0U));
+  status_ok_or_return(s_set_register(BMI323_REG_INT_MAP2, BMI323_INT_MAP2_FWM_INT1));
+
+  status_ok_or_return(s_set_register(BMI323_REG_FIFO_CTRL, BMI323_FIFO_CTRL_FLUSH));
+  imu_storage->num_fifo_samples = 0U;
+  imu_storage->has_sensor_time = false;
+
+  return STATUS_CODE_OK;
+}
+
+static void s_parse_fifo_frame(Bmi323Storage *storage, const uint16_t *frame) {
+  /* Frame layout is accel X/Y/Z, gyro X/Y/Z, then the low word of the sensor time */
+  if (frame[0U] == BMI323_FIFO_ACCEL_DUMMY || frame[3U] == BMI323_FIFO_GYRO_DUMMY) {
+    return;
+  }
+
+  Bmi323Sample *sample = &storage->fifo_samples[storage->num_fifo_samples];
+  float accel_lsb = s_accel_lsb_lookup[storage->settings->accel_range];
+  float gyro_lsb = s_gyro_lsb_lookup[storage->settings->gyro_range];
+
+  sample->accel.x = (float)(int16_t)frame[0U] / accel_lsb;
+  sample->accel.y = (float)(int16_t)frame[1U] / accel_lsb;
+  sample->accel.z = (float)(int16_t)frame[2U] / accel_lsb;
+  sample->gyro.x = (float)(int16_t)frame[3U] / gyro_lsb;
+  sample->gyro.y = (float)(int16_t)frame[4U] / gyro_lsb;
+  sample->gyro.z = (float)(int16_t)frame[5U] / gyro_lsb;
+
+  /* The 16-bit sensor time wraps every 2.56s, far longer than the FIFO can hold */
+  uint16_t sensor_time = frame[6U];
+  if (storage->has_sensor_time) {
+    sample->dt = (float)(uint16_t)(sensor_time - storage->last_sensor_time) * BMI323_SENSOR_TIME_S;
+  } else {
+    sample->dt = BMI323_ODR_PERIOD_S;
+  }
+
+  storage->last_sensor_time = sensor_time;
+  storage->has_sensor_time = true;
+  storage->num_fifo_samples++;
+}
+
 static uint8_t s_get_chip_id() {
   uint16_t chip_id = 0U;
 
@@ -554,7 +604,7 @@ StatusCode bmi323_init(Bmi323Storage *storage) {
   acc_conf &= ~(0b111 << 4);
   acc_conf |= (imu_storage->settings->accel_range << 4);
   acc_conf &= ~(0b1111);
-  acc_conf |= 0b1110;
+  acc_conf |= BMI323_ODR;
   acc_conf &= ~(0b111 << 12);
   acc_conf |= (0x7 << 12);
 
@@ -571,7 +621,7 @@ StatusCode bmi323_init(Bmi323Storage *storage) {
   gyr_conf &= ~(0b111 << 4);
   gyr_conf |= (imu_storage->settings->gyro_range << 4);
   gyr_conf &= ~(0b1111);
-  gyr_conf |= 0b1110;
+  gyr_conf |= BMI323_ODR;
   gyr_conf &= ~(0b111 << 12);
   gyr_conf |= (0x7 << 12);
 
@@ -588,6 +638,8 @@ StatusCode bmi323_init(Bmi323Storage *storage) {
 
   // gyro_crt_calibration();
 
+  status_ok_or_return(s_configure_fifo());
+
   return STATUS_CODE_OK;
 }
 
@@ -603,3 +655,43 @@ StatusCode bmi323_update(Bmi323Storage *storage) {
 
   return STATUS_CODE_OK;
 }
+
+StatusCode bmi323_read_fifo(Bmi323Storage *storage) {
+  if (storage == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  storage->num_fifo_samples = 0U;
+  storage->num_fifo_frames_read = 0U;
+
+  uint16_t fill_level = 0U;
+  status_ok_or_return(s_get_register(BMI323_REG_FIFO_FILL_LEVEL, &fill_level));
+
+  uint16_t num_frames = (fill_level & BMI323_FIFO_FILL_LEVEL_MASK) / BMI323_FIFO_FRAME_WORDS;
+  if (num_frames > BMI323_FIFO_MAX_SAMPLES) {
+    num_frames = BMI323_FIFO_MAX_SAMPLES;
+  }
+
+  /* Reads of FIFO_DATA do not auto-increment, so one burst pops several whole frames */
+  uint16_t burst[BMI323_FIFO_BURST_FRAMES * BMI323_FIFO_FRAME_WORDS];
+
+  while (num_frames > 0U) {
+    uint16_t burst_frames = (num_frames > BMI323_FIFO_BURST_FRAMES) ? BMI323_FIFO_BURST_FRAMES : num_frames;
+    status_ok_or_return(s_get_multi_register(BMI323_REG_FIFO_DATA, burst, burst_frames * BMI323_FIFO_FRAME_WORDS));
+
+    for (uint16_t frame = 0U; frame < burst_frames; frame++) {
+      s_parse_fifo_frame(storage, &burst[frame * BMI323_FIFO_FRAME_WORDS]);
+    }
+
+    storage->num_fifo_frames_read += burst_frames;
+    num_frames -= burst_frames;
+  }
+
+  /* Keep the latest reading available like bmi323_update does */
+  if (storage->num_fifo_samples > 0U) {
+    storage->accel = storage->fifo_samples[storage->num_fifo_samples - 1U].accel;
+    storage->gyro = storage->fifo_samples[storage->num_fifo_samples - 1U].gyro;
+  }
+
+  return STATUS_CODE_OK;
+}
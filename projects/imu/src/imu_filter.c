@@ -0,0 +1,164 @@
+/************************************************************************************************
+ * @file   imu_filter.c
+ *
+ * @brief  Madgwick orientation filter for the BMI323
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+
+/* Inter-component Headers */
+
+/* Intra-component Headers */
+#include "imu_filter.h"
+
+#define IMU_FILTER_DEG_TO_RAD (PI / 180.0f)
+#define IMU_FILTER_RAD_TO_DEG (180.0f / PI)
+
+/*
+ * The Cortex-M4 FPU has single cycle multiplies but takes 14 cycles for each vdiv and vsqrt, so every
+ * normalization is one square root and one divide, and the components are scaled by the reciprocal
+ */
+static inline float s_inv_sqrt(float x) {
+  return 1.0f / sqrtf(x);
+}
+
+struct quaternion quat_mult(struct quaternion L, struct quaternion R) {
+  struct quaternion product;
+  product.q1 = (L.q1 * R.q1) - (L.q2 * R.q2) - (L.q3 * R.q3) - (L.q4 * R.q4);
+  product.q2 = (L.q1 * R.q2) + (L.q2 * R.q1) + (L.q3 * R.q4) - (L.q4 * R.q3);
+  product.q3 = (L.q1 * R.q3) - (L.q2 * R.q4) + (L.q3 * R.q1) + (L.q4 * R.q2);
+  product.q4 = (L.q1 * R.q4) + (L.q2 * R.q3) - (L.q3 * R.q2) + (L.q4 * R.q1);
+
+  return product;
+}
+
+StatusCode imu_filter_init(ImuFilter *filter, float beta) {
+  if (filter == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  // initialize with as unit vector with real component  = 1
+  filter->q.q1 = 1.0f;
+  filter->q.q2 = 0.0f;
+  filter->q.q3 = 0.0f;
+  filter->q.q4 = 0.0f;
+  filter->beta = beta;
+  filter->euler_valid = false;
+
+  return STATUS_CODE_OK;
+}
+
+/*
+ Equation numbers refer to Madgwick's paper. The quaternion product with the gyroscope reading (12) and the
+ gradient J_g' * F_g (20, 25, 26) are multiplied out by hand, so the zeros in the gravity reference and the
+ Jacobian cancel instead of being multiplied, and the products shared between terms are computed once.
+ */
+void imu_filter_update(ImuFilter *filter, float ax, float ay, float az, float gx, float gy, float gz, float dt) {
+  float q1 = filter->q.q1;
+  float q2 = filter->q.q2;
+  float q3 = filter->q.q3;
+  float q4 = filter->q.q4;
+
+  // equation (12) dq/dt = (1/2)q*w, with the real component of w being zero
+  float q_dot1 = 0.5f * (-q2 * gx - q3 * gy - q4 * gz);
+  float q_dot2 = 0.5f * (q1 * gx + q3 * gz - q4 * gy);
+  float q_dot3 = 0.5f * (q1 * gy - q2 * gz + q4 * gx);
+  float q_dot4 = 0.5f * (q1 * gz + q2 * gy - q3 * gx);
+
+  float accel_norm_sq = ax * ax + ay * ay + az * az;
+  if (accel_norm_sq > 0.0f) {
+    float inv_accel_norm = s_inv_sqrt(accel_norm_sq);
+    ax *= inv_accel_norm;
+    ay *= inv_accel_norm;
+    az *= inv_accel_norm;
+
+    float _2q1 = 2.0f * q1;
+    float _2q2 = 2.0f * q2;
+    float _2q3 = 2.0f * q3;
+    float _2q4 = 2.0f * q4;
+
+    // objective function for gravity, equation (25)
+    float f1 = _2q2 * q4 - _2q1 * q3 - ax;
+    float f2 = _2q1 * q2 + _2q3 * q4 - ay;
+    float f3 = 1.0f - _2q2 * q2 - _2q3 * q3 - az;
+
+    // gradient = J_g'*F_g, equations (20) and (26)
+    float s1 = _2q2 * f2 - _2q3 * f1;
+    float s2 = _2q4 * f1 + _2q1 * f2 - 2.0f * _2q2 * f3;
+    float s3 = _2q4 * f2 - _2q1 * f1 - 2.0f * _2q3 * f3;
+    float s4 = _2q2 * f1 + _2q3 * f2;
+
+    // The gradient is zero when the estimate already matches gravity, leaving nothing to correct
+    float gradient_norm_sq = s1 * s1 + s2 * s2 + s3 * s3 + s4 * s4;
+    if (gradient_norm_sq > 0.0f) {
+      // normalized gradient scaled by beta, equations (42-44)
+      float step = filter->beta * s_inv_sqrt(gradient_norm_sq);
+      q_dot1 -= step * s1;
+      q_dot2 -= step * s2;
+      q_dot3 -= step * s3;
+      q_dot4 -= step * s4;
+    }
+  }
+
+  // Integrate orientation rate to find position, then normalize to keep a unit quaternion
+  q1 += q_dot1 * dt;
+  q2 += q_dot2 * dt;
+  q3 += q_dot3 * dt;
+  q4 += q_dot4 * dt;
+
+  float inv_norm = s_inv_sqrt(q1 * q1 + q2 * q2 + q3 * q3 + q4 * q4);
+  filter->q.q1 = q1 * inv_norm;
+  filter->q.q2 = q2 * inv_norm;
+  filter->q.q3 = q3 * inv_norm;
+  filter->q.q4 = q4 * inv_norm;
+  filter->euler_valid = false;
+}
+
+StatusCode imu_filter_update_batch(ImuFilter *filter, const Bmi323Sample *samples, size_t num_samples) {
+  if (filter == NULL || samples == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  for (size_t i = 0U; i < num_samples; i++) {
+    const Bmi323Sample *sample = &samples[i];
+    imu_filter_update(filter, sample->accel.x, sample->accel.y, sample->accel.z, sample->gyro.x * IMU_FILTER_DEG_TO_RAD, sample->gyro.y * IMU_FILTER_DEG_TO_RAD,
+                      sample->gyro.z * IMU_FILTER_DEG_TO_RAD, sample->dt);
+  }
+
+  return STATUS_CODE_OK;
+}
+
+/*
+ Assume right hand system
+ Roll is about the x axis, represented as phi
+ Pitch is about the y axis, represented as theta
+ Yaw is about the z axis, represented as psi (trident looking greek symbol)
+ */
+StatusCode imu_filter_get_euler(ImuFilter *filter, float *roll, float *pitch, float *yaw) {
+  if (filter == NULL || roll == NULL || pitch == NULL || yaw == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!filter->euler_valid) {
+    const struct quaternion *q = &filter->q;
+
+    // Rounding can push the sine of the pitch just past +-1 at the poles
+    float sin_pitch = 2.0f * (q->q2 * q->q4 + q->q1 * q->q3);
+    sin_pitch = fminf(fmaxf(sin_pitch, -1.0f), 1.0f);
+
+    filter->yaw = atan2f(2.0f * (q->q2 * q->q3 - q->q1 * q->q4), 2.0f * (q->q1 * q->q1 + q->q2 * q->q2) - 1.0f) * IMU_FILTER_RAD_TO_DEG;  // equation (7)
+    filter->pitch = -asinf(sin_pitch) * IMU_FILTER_RAD_TO_DEG;                                                                            // equation (8)
+    filter->roll = atan2f(2.0f * (q->q3 * q->q4 - q->q1 * q->q2), 2.0f * (q->q1 * q->q1 + q->q4 * q->q4) - 1.0f) * IMU_FILTER_RAD_TO_DEG;
+    filter->euler_valid = true;
+  }
+
+  *roll = filter->roll;
+  *pitch = filter->pitch;
+  *yaw = filter->yaw;
+
+  return STATUS_CODE_OK;
+}
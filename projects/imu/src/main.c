@@ -16,6 +16,7 @@
 #include "log.h"
 #include "master_tasks.h"
 #include "mcu.h"
+#include "notify.h"
 #include "tasks.h"
 
 /* Intra-component Headers */
@@ -35,32 +36,40 @@ Bmi323Settings bmi323_settings = {
             .sclk = IMU_SPI_SCLK,
             .cs = IMU_SPI_NSS,
         },
+    .int1 = IMU_SPI_INT1,
+    .int2 = IMU_SPI_INT2,
     .accel_range = IMU_ACCEL_RANGE_2G,
     .gyro_range = IMU_GYRO_RANGE_500_DEG,
 };
 
-float roll = 0.0, pitch = 0.0, yaw = 0.0;
+static ImuFilter s_imu_filter;
+static uint32_t s_notification = 0U;
+static uint32_t s_cycles_since_fifo = 0U;
+
 void pre_loop_init() {
   imu_init(&bmi323_storage, &bmi323_settings);
+  imu_filter_init(&s_imu_filter, BETA);
   for (float i = 0; i < 1000; i++) {
-    imu_filter(0.05, 0.05, 0.9, 0, 0, 0);
-    eulerAngles(q_est, &roll, &pitch, &yaw);
+    imu_filter_update(&s_imu_filter, 0.05, 0.05, 0.9, 0, 0, 0, DELTA_T);
   }
 }
 
-void run_1000hz_cycle() {}
-
-void run_10hz_cycle() {
-  bmi323_update(&bmi323_storage);
-  // LOG_DEBUG("BMI323 ACCEL - x: %d%%, y: %d%%, z: %d%%\r\n", (int)(bmi323_storage.accel.x * 100), (int)(bmi323_storage.accel.y * 100), (int)(bmi323_storage.accel.z * 100));
-  // delay_ms(10);
+void run_1000hz_cycle() {
+  notify_get(&s_notification);
 
-  imu_filter(bmi323_storage.accel.x, bmi323_storage.accel.y, bmi323_storage.accel.z, bmi323_storage.gyro.x, bmi323_storage.gyro.y, bmi323_storage.gyro.z);
-  eulerAngles(q_est, &roll, &pitch, &yaw);
-  // LOG_DEBUG("BMI323 ORIENTATION DEGREES - roll: %d%%, ptich: %d%%, yaw: %d%%\r\n", (int)(roll), (int)(pitch), (int)(yaw));
+  /* Drain on the watermark, or after one watermark period in case an edge was missed */
+  if (notify_check_event(&s_notification, IMU_FIFO_WATERMARK_EVENT) || ++s_cycles_since_fifo >= IMU_FIFO_TIMEOUT_CYCLES) {
+    s_cycles_since_fifo = 0U;
+    imu_process_fifo(&bmi323_storage, &s_imu_filter);
+  }
 }
 
+void run_10hz_cycle() {}
+
 void run_1hz_cycle() {
+  float roll, pitch, yaw;
+  imu_filter_get_euler(&s_imu_filter, &roll, &pitch, &yaw);
+
   LOG_DEBUG("BMI323 ACCEL - x: %d%%, y: %d%%, z: %d%%\r\n", (int)(bmi323_storage.accel.x * 100), (int)(bmi323_storage.accel.y * 100), (int)(bmi323_storage.accel.z * 100));
   delay_ms(10);
   LOG_DEBUG("BMI323 GYRO - x: %d%%, y: %d%%, z: %d%%\r\n", (int)(bmi323_storage.gyro.x), (int)(bmi323_storage.gyro.y), (int)(bmi323_storage.gyro.z));
@@ -0,0 +1,238 @@
+/************************************************************************************************
+ * @file   test_bmi323.c
+ *
+ * @brief  Test file for the BMI323 FIFO readout
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "spi.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "bmi323.h"
+#include "imu.h"
+#include "imu_filter.h"
+#include "imu_hw_defs.h"
+
+#define TEST_READ_BIT 0x80U
+#define TEST_REG_ADDR_MASK 0x7FU
+#define TEST_NUM_REGISTERS 0x80U
+#define TEST_FIFO_WORDS 1024U
+#define TEST_SOFT_RESET 0xDEAFU
+
+/* 2.5ms between frames at 400Hz */
+#define TEST_FRAME_SENSOR_TICKS 64U
+
+/** @brief  BMI323 register file and FIFO, answering SPI transactions like the sensor */
+typedef struct {
+  uint16_t registers[TEST_NUM_REGISTERS];
+  uint16_t fifo[TEST_FIFO_WORDS];
+  size_t fifo_head;
+  size_t fifo_count;
+  size_t num_fifo_bursts;
+  size_t num_transactions;
+} TestBmi323Model;
+
+static TestBmi323Model s_model;
+
+static Bmi323Settings s_settings = {
+  .spi_port = IMU_SPI_PORT,
+  .accel_range = IMU_ACCEL_RANGE_2G,
+  .gyro_range = IMU_GYRO_RANGE_500_DEG,
+};
+
+static Bmi323Storage s_storage;
+
+static uint16_t s_model_read_word(TestBmi323Model *model, uint8_t reg, size_t index) {
+  if (reg == BMI323_REG_FIFO_DATA) {
+    /* An empty FIFO reads back dummy frames */
+    if (model->fifo_count == 0U) {
+      return BMI323_FIFO_ACCEL_DUMMY;
+    }
+    uint16_t word = model->fifo[model->fifo_head];
+    model->fifo_head = (model->fifo_head + 1U) % TEST_FIFO_WORDS;
+    model->fifo_count--;
+    return word;
+  }
+
+  if (reg == BMI323_REG_FIFO_FILL_LEVEL) {
+    return (uint16_t)model->fifo_count;
+  }
+
+  /* Other registers auto-increment through a burst */
+  return model->registers[(reg + index) % TEST_NUM_REGISTERS];
+}
+
+static StatusCode s_model_exchange(const uint8_t *tx_data, size_t tx_len, uint8_t *rx_data, size_t rx_len, void *context) {
+  TestBmi323Model *model = context;
+  uint8_t reg = tx_data[0U] & TEST_REG_ADDR_MASK;
+  model->num_transactions++;
+
+  if (tx_data[0U] & TEST_READ_BIT) {
+    if (reg == BMI323_REG_FIFO_DATA) {
+      model->num_fifo_bursts++;
+    }
+    for (size_t i = 0U; i < rx_len / sizeof(uint16_t); i++) {
+      uint16_t word = s_model_read_word(model, reg, i);
+      rx_data[2U * i] = word & 0xFFU;
+      rx_data[2U * i + 1U] = word >> 8U;
+    }
+    return STATUS_CODE_OK;
+  }
+
+  if (tx_len < 3U) {
+    return STATUS_CODE_OK;
+  }
+
+  uint16_t value = tx_data[1U] | (tx_data[2U] << 8U);
+  if (reg == BMI323_REG_FIFO_CTRL && (value & BMI323_FIFO_CTRL_FLUSH)) {
+    model->fifo_count = 0U;
+  } else if (reg == BMI323_REG_CMD && value == TEST_SOFT_RESET) {
+    memset(model->registers, 0, sizeof(model->registers));
+    model->registers[BMI323_REG_CHIP_ID] = BMI323_CHIP_ID;
+  } else {
+    model->registers[reg] = value;
+  }
+
+  return STATUS_CODE_OK;
+}
+
+static void s_push_word(uint16_t word) {
+  s_model.fifo[(s_model.fifo_head + s_model.fifo_count) % TEST_FIFO_WORDS] = word;
+  s_model.fifo_count++;
+}
+
+static void s_push_frame(int16_t accel_x, int16_t gyro_x, uint16_t sensor_time) {
+  s_push_word((uint16_t)accel_x);
+  s_push_word(0U);
+  s_push_word(16384U);
+  s_push_word((uint16_t)gyro_x);
+  s_push_word(0U);
+  s_push_word(0U);
+  s_push_word(sensor_time);
+}
+
+void setup_test(void) {
+  memset(&s_model, 0, sizeof(s_model));
+  memset(&s_storage, 0, sizeof(s_storage));
+  s_model.registers[BMI323_REG_CHIP_ID] = BMI323_CHIP_ID;
+
+  TEST_ASSERT_OK(spi_set_mock_device(IMU_SPI_PORT, s_model_exchange, &s_model));
+
+  s_storage.settings = &s_settings;
+  TEST_ASSERT_OK(bmi323_init(&s_storage));
+  s_model.num_transactions = 0U;
+}
+
+void teardown_test(void) {
+  spi_set_mock_device(IMU_SPI_PORT, NULL, NULL);
+}
+
+void test_fifo_configured_on_init(void) {
+  TEST_ASSERT_EQUAL_HEX16(BMI323_FIFO_CONF_ACC_EN | BMI323_FIFO_CONF_GYR_EN | BMI323_FIFO_CONF_TIME_EN, s_model.registers[BMI323_REG_FIFO_CONF]);
+  TEST_ASSERT_EQUAL_UINT16(BMI323_FIFO_WATERMARK_FRAMES * BMI323_FIFO_FRAME_WORDS, s_model.registers[BMI323_REG_FIFO_WATERMARK]);
+  TEST_ASSERT_EQUAL_HEX16(BMI323_INT_MAP2_FWM_INT1, s_model.registers[BMI323_REG_INT_MAP2]);
+  TEST_ASSERT_EQUAL_HEX16(BMI323_IO_INT_CTRL_INT1_ACTIVE_HIGH | BMI323_IO_INT_CTRL_INT1_OUTPUT_EN, s_model.registers[BMI323_REG_IO_INT_CTRL]);
+  TEST_ASSERT_EQUAL_HEX16(BMI323_ODR, s_model.registers[BMI323_REG_ACC_CONF] & 0xFU);
+  TEST_ASSERT_EQUAL_HEX16(BMI323_ODR, s_model.registers[BMI323_REG_GYRO_CONF] & 0xFU);
+}
+
+void test_fifo_burst_read(void) {
+  const uint16_t num_frames = 20U;
+  for (uint16_t i = 0U; i < num_frames; i++) {
+    s_push_frame((int16_t)(i * 100), (int16_t)(-i * 10), (uint16_t)(1000U + i * TEST_FRAME_SENSOR_TICKS));
+  }
+
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(num_frames, s_storage.num_fifo_samples);
+  TEST_ASSERT_EQUAL(0U, s_model.fifo_count);
+
+  /* One fill level read, then whole frames in as few bursts as the SPI transaction size allows */
+  size_t num_bursts = (num_frames + BMI323_FIFO_BURST_FRAMES - 1U) / BMI323_FIFO_BURST_FRAMES;
+  TEST_ASSERT_EQUAL(num_bursts, s_model.num_fifo_bursts);
+  TEST_ASSERT_EQUAL(1U + num_bursts, s_model.num_transactions);
+
+  /* The first frame has no earlier timestamp, the rest use the sensor time */
+  TEST_ASSERT_EQUAL_FLOAT(BMI323_ODR_PERIOD_S, s_storage.fifo_samples[0].dt);
+  for (uint16_t i = 1U; i < num_frames; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0025f, s_storage.fifo_samples[i].dt);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, (float)(i * 100) / 16384.0f, s_storage.fifo_samples[i].accel.x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, (float)(-i * 10) / 65.6f, s_storage.fifo_samples[i].gyro.x);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, s_storage.fifo_samples[i].accel.z);
+  }
+
+  /* The newest frame is also the current reading */
+  TEST_ASSERT_EQUAL_FLOAT(s_storage.fifo_samples[num_frames - 1U].accel.x, s_storage.accel.x);
+}
+
+void test_fifo_sensor_time_wraps(void) {
+  s_push_frame(0, 0, 0xFFF0U);
+  s_push_frame(0, 0, 0x0030U);
+
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(2U, s_storage.num_fifo_samples);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0x40U * BMI323_SENSOR_TIME_S, s_storage.fifo_samples[1].dt);
+
+  /* Timestamps carry over between reads */
+  s_push_frame(0, 0, 0x0030U + TEST_FRAME_SENSOR_TICKS);
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(1U, s_storage.num_fifo_samples);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0025f, s_storage.fifo_samples[0].dt);
+}
+
+void test_fifo_drained_over_several_reads(void) {
+  const uint16_t num_frames = BMI323_FIFO_MAX_SAMPLES + 5U;
+  for (uint16_t i = 0U; i < num_frames; i++) {
+    s_push_frame(0, 0, (uint16_t)(i * TEST_FRAME_SENSOR_TICKS));
+  }
+
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(BMI323_FIFO_MAX_SAMPLES, s_storage.num_fifo_samples);
+
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(5U, s_storage.num_fifo_samples);
+  TEST_ASSERT_EQUAL(0U, s_model.fifo_count);
+}
+
+void test_fifo_skips_dummy_frames(void) {
+  s_push_frame(100, 0, 0U);
+  s_push_frame((int16_t)BMI323_FIFO_ACCEL_DUMMY, 0, TEST_FRAME_SENSOR_TICKS);
+  s_push_frame(100, 0, 2U * TEST_FRAME_SENSOR_TICKS);
+
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(2U, s_storage.num_fifo_samples);
+  TEST_ASSERT_EQUAL(3U, s_storage.num_fifo_frames_read);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.005f, s_storage.fifo_samples[1].dt);
+}
+
+void test_process_fifo_drains_past_dummy_frames(void) {
+  ImuFilter filter;
+  TEST_ASSERT_OK(imu_filter_init(&filter, BETA));
+
+  /* A dummy frame in the first full read leaves fewer samples than frames popped */
+  const uint16_t num_frames = BMI323_FIFO_MAX_SAMPLES + 5U;
+  for (uint16_t i = 0U; i < num_frames; i++) {
+    int16_t accel_x = (i == 3U) ? (int16_t)BMI323_FIFO_ACCEL_DUMMY : 0;
+    s_push_frame(accel_x, 0, (uint16_t)(i * TEST_FRAME_SENSOR_TICKS));
+  }
+
+  TEST_ASSERT_OK(imu_process_fifo(&s_storage, &filter));
+  TEST_ASSERT_EQUAL(0U, s_model.fifo_count);
+  TEST_ASSERT_EQUAL(5U, s_storage.num_fifo_samples);
+}
+
+void test_fifo_empty(void) {
+  TEST_ASSERT_OK(bmi323_read_fifo(&s_storage));
+  TEST_ASSERT_EQUAL(0U, s_storage.num_fifo_samples);
+  TEST_ASSERT_EQUAL(0U, s_model.num_fifo_bursts);
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, bmi323_read_fifo(NULL));
+}
@@ -0,0 +1,211 @@
+/************************************************************************************************
+ * @file   test_imu_filter.c
+ *
+ * @brief  Test file for the IMU orientation filter
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Inter-component Headers */
+#include "log.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "imu_filter.h"
+
+#define TEST_DT (1.0f / 800.0f)
+#define TEST_NUM_STEPS 4000U
+#define TEST_BENCH_SAMPLES 200000U
+#define TEST_DEG_TO_RAD (PI / 180.0f)
+
+static struct quaternion s_reference_q;
+static ImuFilter s_filter;
+
+/* The filter as it was before the expanded math, kept to check the new one against */
+static void s_reference_filter(float ax, float ay, float az, float gx, float gy, float gz, float dt) {
+  struct quaternion q_est_prev = s_reference_q;
+  struct quaternion q_est_dot = { 0 };
+  struct quaternion q_a = { 0, ax, ay, az };
+  float F_g[3] = { 0 };
+  float J_g[3][4] = { 0 };
+  struct quaternion gradient = { 0 };
+
+  struct quaternion q_w = { 0, gx, gy, gz };
+  quat_scalar(&q_w, 0.5);
+  q_w = quat_mult(q_est_prev, q_w);
+
+  quat_Normalization(&q_a);
+  F_g[0] = 2 * (q_est_prev.q2 * q_est_prev.q4 - q_est_prev.q1 * q_est_prev.q3) - q_a.q2;
+  F_g[1] = 2 * (q_est_prev.q1 * q_est_prev.q2 + q_est_prev.q3 * q_est_prev.q4) - q_a.q3;
+  F_g[2] = 2 * (0.5 - q_est_prev.q2 * q_est_prev.q2 - q_est_prev.q3 * q_est_prev.q3) - q_a.q4;
+
+  J_g[0][0] = -2 * q_est_prev.q3;
+  J_g[0][1] = 2 * q_est_prev.q4;
+  J_g[0][2] = -2 * q_est_prev.q1;
+  J_g[0][3] = 2 * q_est_prev.q2;
+  J_g[1][0] = 2 * q_est_prev.q2;
+  J_g[1][1] = 2 * q_est_prev.q1;
+  J_g[1][2] = 2 * q_est_prev.q4;
+  J_g[1][3] = 2 * q_est_prev.q3;
+  J_g[2][0] = 0;
+  J_g[2][1] = -4 * q_est_prev.q2;
+  J_g[2][2] = -4 * q_est_prev.q3;
+  J_g[2][3] = 0;
+
+  gradient.q1 = J_g[0][0] * F_g[0] + J_g[1][0] * F_g[1] + J_g[2][0] * F_g[2];
+  gradient.q2 = J_g[0][1] * F_g[0] + J_g[1][1] * F_g[1] + J_g[2][1] * F_g[2];
+  gradient.q3 = J_g[0][2] * F_g[0] + J_g[1][2] * F_g[1] + J_g[2][2] * F_g[2];
+  gradient.q4 = J_g[0][3] * F_g[0] + J_g[1][3] * F_g[1] + J_g[2][3] * F_g[2];
+  quat_Normalization(&gradient);
+
+  quat_scalar(&gradient, BETA);
+  quat_sub(&q_est_dot, q_w, gradient);
+  quat_scalar(&q_est_dot, dt);
+  quat_add(&s_reference_q, q_est_prev, q_est_dot);
+  quat_Normalization(&s_reference_q);
+}
+
+static void s_reference_euler(struct quaternion q, float *roll, float *pitch, float *yaw) {
+  *yaw = atan2f((2 * q.q2 * q.q3 - 2 * q.q1 * q.q4), (2 * q.q1 * q.q1 + 2 * q.q2 * q.q2 - 1));
+  *pitch = -asinf(2 * q.q2 * q.q4 + 2 * q.q1 * q.q3);
+  *roll = atan2f((2 * q.q3 * q.q4 - 2 * q.q1 * q.q2), (2 * q.q1 * q.q1 + 2 * q.q4 * q.q4 - 1));
+
+  *yaw *= (180.0f / PI);
+  *pitch *= (180.0f / PI);
+  *roll *= (180.0f / PI);
+}
+
+/* Slow tilt about x and y with a yaw rate, the accelerometer seeing gravity with a little vibration */
+static void s_make_sample(size_t step, Bmi323Sample *sample) {
+  float t = step * TEST_DT;
+  sample->accel.x = 0.3f * sinf(0.5f * t) + 0.02f * sinf(90.0f * t);
+  sample->accel.y = 0.2f * cosf(0.7f * t);
+  sample->accel.z = 0.95f + 0.02f * cosf(70.0f * t);
+  sample->gyro.x = 10.0f * cosf(0.7f * t);
+  sample->gyro.y = -8.0f * sinf(0.5f * t);
+  sample->gyro.z = 20.0f;
+  sample->dt = TEST_DT;
+}
+
+static double s_elapsed_ms(const struct timespec *start, const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1000.0 + (end->tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+void setup_test(void) {
+  s_reference_q = (struct quaternion){ 1, 0, 0, 0 };
+  TEST_ASSERT_OK(imu_filter_init(&s_filter, BETA));
+}
+
+void teardown_test(void) {}
+
+void test_filter_matches_reference(void) {
+  for (size_t step = 0U; step < TEST_NUM_STEPS; step++) {
+    Bmi323Sample sample;
+    s_make_sample(step, &sample);
+
+    s_reference_filter(sample.accel.x, sample.accel.y, sample.accel.z, sample.gyro.x * TEST_DEG_TO_RAD, sample.gyro.y * TEST_DEG_TO_RAD, sample.gyro.z * TEST_DEG_TO_RAD, sample.dt);
+    TEST_ASSERT_OK(imu_filter_update_batch(&s_filter, &sample, 1U));
+  }
+
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, s_reference_q.q1, s_filter.q.q1);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, s_reference_q.q2, s_filter.q.q2);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, s_reference_q.q3, s_filter.q.q3);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, s_reference_q.q4, s_filter.q.q4);
+
+  float roll, pitch, yaw;
+  float ref_roll, ref_pitch, ref_yaw;
+  s_reference_euler(s_reference_q, &ref_roll, &ref_pitch, &ref_yaw);
+  TEST_ASSERT_OK(imu_filter_get_euler(&s_filter, &roll, &pitch, &yaw));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, ref_roll, roll);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, ref_pitch, pitch);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, ref_yaw, yaw);
+}
+
+void test_filter_converges_to_gravity(void) {
+  /* Tilted 30 degrees about x, the roll is read back with the sign convention of equation (7) */
+  for (size_t step = 0U; step < 10000U; step++) {
+    imu_filter_update(&s_filter, 0.0f, 0.5f, 0.8660254f, 0.0f, 0.0f, 0.0f, DELTA_T);
+  }
+
+  float roll, pitch, yaw;
+  TEST_ASSERT_OK(imu_filter_get_euler(&s_filter, &roll, &pitch, &yaw));
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 30.0f, fabsf(roll));
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, 0.0f, pitch);
+}
+
+void test_filter_gyro_only_without_accel(void) {
+  /* A zero acceleration would normalize to NaN, so only the gyroscope is integrated */
+  for (size_t step = 0U; step < 800U; step++) {
+    imu_filter_update(&s_filter, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, PI / 2.0f, TEST_DT);
+  }
+
+  /* A quarter turn about z */
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, cosf(PI / 4.0f), s_filter.q.q1);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, sinf(PI / 4.0f), s_filter.q.q4);
+
+  /* Already aligned with gravity, the gradient is zero and must not be normalized */
+  TEST_ASSERT_OK(imu_filter_init(&s_filter, BETA));
+  imu_filter_update(&s_filter, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, TEST_DT);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, s_filter.q.q1);
+  TEST_ASSERT_FALSE(isnan(s_filter.q.q2));
+}
+
+void test_filter_euler_is_lazy(void) {
+  float roll, pitch, yaw;
+  TEST_ASSERT_FALSE(s_filter.euler_valid);
+  TEST_ASSERT_OK(imu_filter_get_euler(&s_filter, &roll, &pitch, &yaw));
+  TEST_ASSERT_TRUE(s_filter.euler_valid);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, roll);
+
+  /* Every update invalidates the cached angles */
+  imu_filter_update(&s_filter, 0.0f, 0.5f, 0.8660254f, 0.0f, 0.0f, 0.0f, TEST_DT);
+  TEST_ASSERT_FALSE(s_filter.euler_valid);
+
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, imu_filter_init(NULL, BETA));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, imu_filter_update_batch(&s_filter, NULL, 1U));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, imu_filter_get_euler(&s_filter, NULL, &pitch, &yaw));
+}
+
+void test_filter_throughput(void) {
+  static Bmi323Sample samples[BMI323_FIFO_MAX_SAMPLES];
+  struct timespec start, end;
+  float roll, pitch, yaw;
+
+  for (size_t i = 0U; i < BMI323_FIFO_MAX_SAMPLES; i++) {
+    s_make_sample(i, &samples[i]);
+  }
+
+  /* Previously every sample was filtered and converted to euler angles */
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t n = 0U; n < TEST_BENCH_SAMPLES; n += BMI323_FIFO_MAX_SAMPLES) {
+    for (size_t i = 0U; i < BMI323_FIFO_MAX_SAMPLES; i++) {
+      const Bmi323Sample *sample = &samples[i];
+      s_reference_filter(sample->accel.x, sample->accel.y, sample->accel.z, sample->gyro.x * TEST_DEG_TO_RAD, sample->gyro.y * TEST_DEG_TO_RAD, sample->gyro.z * TEST_DEG_TO_RAD,
+                         sample->dt);
+      s_reference_euler(s_reference_q, &roll, &pitch, &yaw);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double reference_ms = s_elapsed_ms(&start, &end);
+
+  /* Now a FIFO read is filtered in one batch and the angles are converted when published */
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t n = 0U; n < TEST_BENCH_SAMPLES; n += BMI323_FIFO_MAX_SAMPLES) {
+    imu_filter_update_batch(&s_filter, samples, BMI323_FIFO_MAX_SAMPLES);
+  }
+  imu_filter_get_euler(&s_filter, &roll, &pitch, &yaw);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double filter_ms = s_elapsed_ms(&start, &end);
+
+  LOG_DEBUG("Filter %u samples: %.3f ms batched, %.3f ms reference (%.1f ns per sample)\n", TEST_BENCH_SAMPLES, filter_ms, reference_ms, filter_ms * 1e6 / TEST_BENCH_SAMPLES);
+
+  TEST_ASSERT_FALSE(isnan(s_filter.q.q1));
+}
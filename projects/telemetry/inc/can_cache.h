@@ -10,6 +10,7 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -49,41 +50,89 @@ typedef enum {
   NUM_CAN_MSG_PRIORITIES,
 } CanMsgPriority;
 
+/** @brief  Largest CAN ID that can be cached, covers every 11-bit standard ID */
+#define CAN_CACHE_MAX_ID 0x7FFU
+
 /**
  * @brief   Per-message cache entry
  * @details One entry exists for every CAN message that targets the telemetry board.
- *          Task A populates data and sets pending; Task B drains pending entries and transmits.
+ *          Every entry has a single writer: CAN-received entries are written by the updater task,
+ *          telemetry-internal and WS22 entries by the scheduler task. Data is published with a
+ *          sequence lock, so neither task needs a critical section to update or read an entry.
+ *          The entry is pending while its sequence differs from the last transmitted sequence.
  */
 typedef struct {
-  uint32_t can_id;            /**< Raw 11-bit CAN bus ID used to match incoming messages */
-  uint8_t length;             /**< DLC: number of valid data bytes */
-  uint8_t data[8];            /**< Cached payload */
-  CanMsgPriority priority;    /**< Priority tier this entry belongs to */
-  bool pending;               /**< True when data has been updated but not yet transmitted */
-  uint32_t last_updated_tick; /**< Tick count when this entry last received a CAN message; 0 = never */
-  uint32_t last_tx_tick;      /**< Tick count when this entry was last transmitted; 0 = never */
-  uint32_t tx_cooldown_ticks; /**< Minimum ticks between TX; 0 = no rate limit */
+  uint32_t can_id;                /**< Raw 11-bit CAN bus ID used to match incoming messages */
+  uint8_t length;                 /**< DLC: number of valid data bytes */
+  uint8_t data[8];                /**< Cached payload */
+  CanMsgPriority priority;        /**< Priority tier this entry belongs to */
+  atomic_uint_least32_t sequence; /**< Sequence lock counter, odd while data is being written */
+  uint32_t tx_sequence;           /**< Sequence of the last transmitted data, scheduler task only */
+  uint32_t last_updated_tick;     /**< Tick count when this entry last received a CAN message; 0 = never */
+  volatile uint32_t last_tx_tick; /**< Tick count when this entry was last transmitted; 0 = never */
+  uint32_t tx_cooldown_ticks;     /**< Minimum ticks between TX; 0 = no rate limit */
+  uint8_t tx_reference[8];        /**< Payload last transmitted, delta datagram reference, scheduler task only */
+  uint32_t last_keyframe_tick;    /**< Tick count when a full datagram was last transmitted, scheduler task only */
 } CanMessageCache;
 
 /**
- * @brief   High-priority (fast-cycle) message cache
- * @details Currently empty — no fast-cycle messages target telemetry.
+ * @brief   Contiguous message cache, ordered HIGH, MEDIUM then LOW priority
+ * @details HIGH: currently empty, no fast-cycle messages target telemetry.
+ *          MEDIUM: 22 entries from rear_controller, steering, front_controller, and IMU.
+ *          LOW: front_controller power group messages and telemetry-internal entries.
+ */
+extern CanMessageCache g_can_cache[];
+extern const size_t g_can_cache_size;
+
+/** @brief  First entry of each priority tier within g_can_cache */
+extern CanMessageCache *const g_can_cache_tiers[NUM_CAN_MSG_PRIORITIES];
+/** @brief  Number of entries in each priority tier */
+extern const size_t g_can_cache_tier_sizes[NUM_CAN_MSG_PRIORITIES];
+
+/**
+ * @brief   Find the cache entry of a CAN ID
+ * @details Constant-time lookup through a CAN ID indexed table built at compile time
+ * @param   can_id Raw CAN ID
+ * @return  Pointer to the cache entry, NULL if the ID is not cached
+ */
+CanMessageCache *can_cache_lookup(uint32_t can_id);
+
+/**
+ * @brief   Publish new data to a cache entry
+ * @details The entry becomes pending if the data changed or the heartbeat period has elapsed since it
+ *          was last transmitted. Must only be called by the task that owns the entry
+ * @param   entry Cache entry to update
+ * @param   data Payload of at least entry->length bytes
+ * @param   now Current tick count
+ * @param   heartbeat_ticks Ticks after which unchanged data is sent again
+ */
+void can_cache_update(CanMessageCache *entry, const uint8_t *data, uint32_t now, uint32_t heartbeat_ticks);
+
+/**
+ * @brief   Check if an entry holds data that has not been transmitted
+ * @param   entry Cache entry to check
+ * @return  true if the entry is pending
  */
-extern CanMessageCache g_can_cache_high[];
-extern const size_t g_can_cache_high_size;
+bool can_cache_is_pending(CanMessageCache *entry);
 
 /**
- * @brief   Medium-priority (medium-cycle) message cache
- * @details Contains 22 entries from rear_controller, steering, front_controller, and IMU.
+ * @brief   Take a consistent snapshot of a pending entry
+ * @details Never waits for the writer. An entry that is being written is reported as not pending
+ *          and is picked up again on the next pass
+ * @param   entry Cache entry to read
+ * @param   data Buffer of 8 bytes to store the payload
+ * @param   sequence Returns the sequence of the snapshot, passed to can_cache_mark_transmitted()
+ * @return  true if a pending snapshot was taken
  */
-extern CanMessageCache g_can_cache_medium[];
-extern const size_t g_can_cache_medium_size;
+bool can_cache_read_pending(CanMessageCache *entry, uint8_t *data, uint32_t *sequence);
 
 /**
- * @brief   Low-priority (slow-cycle) message cache
- * @details Contains 3 entries from front_controller power group messages.
+ * @brief   Mark a snapshot as transmitted
+ * @details Data published after the snapshot keeps the entry pending
+ * @param   entry Cache entry that was transmitted
+ * @param   sequence Sequence returned by can_cache_read_pending()
+ * @param   now Current tick count
  */
-extern CanMessageCache g_can_cache_low[];
-extern const size_t g_can_cache_low_size;
+void can_cache_mark_transmitted(CanMessageCache *entry, uint32_t sequence, uint32_t now);
 
 /** @} */
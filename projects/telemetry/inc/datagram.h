@@ -38,6 +38,22 @@
  */
 #define DATAGRAM_METADATA_SIZE 5U
 
+/** @brief  Start of frame indicator for delta datagrams */
+#define DATAGRAM_DELTA_START_FRAME 0xADU
+/** @brief  Bit offset of the DLC in the delta datagram header, below it is the 11-bit CAN ID */
+#define DATAGRAM_DELTA_DLC_SHIFT 11U
+
+/**
+ * @brief   Delta datagram metadata size
+ * @details A delta datagram carries the payload XORed with the last payload sent for the same ID.
+ *          Unchanged bytes XOR to zero and are elided, so only changed bytes are sent.
+ *          1 byte for start frame
+ *          2 bytes for DLC (bits 14-11) and ID (bits 10-0), big-endian
+ *          1 byte for change mask, bit i set if payload byte i is sent
+ *          1 byte for end frame
+ */
+#define DATAGRAM_DELTA_METADATA_SIZE 5U
+
 #pragma pack(push, 1)
 /**
  * @brief   Datagram storage class
@@ -66,6 +82,21 @@ StatusCode decode_can_message(Datagram *datagram, CanMessage *msg);
  */
 StatusCode encode_datagram(Datagram *datagram, uint32_t id, uint8_t dlc, const uint8_t *data);
 
+/**
+ * @brief   Encode id/dlc/data as a delta datagram against the last payload sent for the id
+ * @details The receiver needs the same reference, so a full datagram from encode_datagram()
+ *          must be sent periodically as a keyframe
+ * @param   buffer    Buffer of at least dlc + DATAGRAM_DELTA_METADATA_SIZE bytes
+ * @param   length    Set to the number of bytes written to buffer
+ * @param   id        Raw 11-bit CAN ID
+ * @param   dlc       Payload length in bytes, up to 8
+ * @param   data      Pointer to payload
+ * @param   reference Pointer to the payload last sent for this id
+ * @return  STATUS_CODE_OK if the datagram was encoded
+ *          STATUS_CODE_INVALID_ARGS if one of the parameters are incorrect
+ */
+StatusCode encode_delta_datagram(uint8_t *buffer, size_t *length, uint32_t id, uint8_t dlc, const uint8_t *data, const uint8_t *reference);
+
 /**
  * @brief   Log the decoded datagram for debug purposes
  * @param   datagram Pointer to the datagram to be debugged
@@ -0,0 +1,97 @@
+#pragma once
+
+/************************************************************************************************
+ * @file    sd_logger.h
+ *
+ * @brief   SD card CAN logger
+ *
+ * @date    2026-10-16
+ * @author  Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+
+/* Inter-component Headers */
+#include "can_msg.h"
+
+/* Intra-component Headers */
+#include "status.h"
+#include "telemetry.h"
+
+/**
+ * @defgroup telemetry
+ * @brief    telemetry Firmware
+ * @{
+ */
+
+/**
+ * @brief   Size of each of the two RAM log buffers
+ * @details A power of two between 4 and 16 KiB, so every flush is a run of whole sectors that
+ *          either spans or evenly divides a cluster
+ */
+#define SD_LOGGER_BUFFER_SIZE 8192U
+
+/** @brief  Bytes preallocated contiguously for each log file, a new file is started when full */
+#define SD_LOGGER_FILE_SIZE (32UL * 1024UL * 1024UL)
+
+/** @brief  A partially filled buffer is handed to the card once it is this old */
+#define SD_LOGGER_FLUSH_PERIOD_MS 1000U
+
+/** @brief  CAN ID of the records that pad a partially filled buffer */
+#define SD_LOGGER_PADDING_ID 0xFFFFU
+
+#pragma pack(push, 1)
+/**
+ * @brief   Log record of one received CAN message
+ * @details Records are 16 bytes so a sector always holds whole records
+ */
+typedef struct {
+  uint32_t tick;    /**< Tick count when the message was received */
+  uint16_t id;      /**< Raw CAN ID, SD_LOGGER_PADDING_ID for padding */
+  uint8_t dlc;      /**< Number of valid data bytes */
+  uint8_t sequence; /**< Low byte of the record count, the log ends where the sequence breaks */
+  uint8_t data[8];  /**< Message payload */
+} SdLogRecord;
+#pragma pack(pop)
+
+/**
+ * @brief   Logger statistics
+ */
+typedef struct {
+  uint32_t frames_logged;     /**< Messages copied into a log buffer */
+  uint32_t frames_dropped;    /**< Messages dropped because both buffers were waiting for the card */
+  uint32_t bytes_written;     /**< Bytes written to the card */
+  uint32_t write_errors;      /**< Failed buffer writes, the buffer is written again once the card is remounted */
+  uint32_t max_write_ticks;   /**< Worst-case time to write one buffer */
+  uint32_t total_write_ticks; /**< Total time spent writing buffers */
+} SdLoggerStats;
+
+/**
+ * @brief   Start logging received CAN messages to the SD card
+ * @details Spawns a low priority task that mounts the card and flushes full buffers.
+ *          The SD card driver must be linked first
+ * @param   storage Pointer to the telemetry storage
+ * @return  STATUS_CODE_OK if the logger task was started
+ *          STATUS_CODE_INVALID_ARGS if storage is NULL
+ */
+StatusCode sd_logger_init(TelemetryStorage *storage);
+
+/**
+ * @brief   Copy a received CAN message into the active log buffer
+ * @details Must only be called from a single task. Never blocks on the card: when the active
+ *          buffer is full and the other one is still being written the message is dropped
+ * @param   message Pointer to the received message
+ * @return  STATUS_CODE_OK if the message was logged
+ *          STATUS_CODE_UNINITIALIZED if the logger is not running
+ *          STATUS_CODE_RESOURCE_EXHAUSTED if the message was dropped
+ */
+StatusCode sd_logger_log_can(const CanMessage *message);
+
+/**
+ * @brief   Get a snapshot of the logger statistics
+ * @param   stats Pointer to the statistics to be filled
+ */
+void sd_logger_get_stats(SdLoggerStats *stats);
+
+/** @} */
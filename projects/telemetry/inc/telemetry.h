@@ -32,6 +32,7 @@
 typedef struct {
   UartPort uart_port;                     /**< UART Port for the telemetry interface (XBee, ELRS, etc.) */
   UartSettings uart_settings;             /**< UART Settings for the telemetry interface */
+  bool compressed_stream;                 /**< Send delta datagrams between periodic full keyframes */
   uint32_t message_transmit_frequency_hz; /**< Transmission frequency of telemetry data packets */
   SdSpiPort sd_spi_port;                  /**< SPI Port for SD card interface */
   SdSpiSettings sd_spi_settings;          /**< SPI Settings for SD card interface */
@@ -0,0 +1,150 @@
+# @file    telemetry_decoder.py
+#  @date    2026-10-16
+#  @author  Midnight Sun Team #24 - MSXVI
+#  @brief   Decoder for the telemetry datagram stream received over XBee
+#
+#  @details Decodes full datagrams and the delta datagrams of the compressed stream.
+#           Full datagrams double as keyframes: a delta datagram is only applied once a full
+#           datagram has been received for its ID, so the decoder resyncs after lost bytes
+#
+#  @ingroup Telemetry_Python
+
+import argparse
+import serial
+
+DATAGRAM_START_FRAME = 0xAA
+DATAGRAM_DELTA_START_FRAME = 0xAD
+DATAGRAM_END_FRAME = 0xBB
+
+DATAGRAM_METADATA_SIZE = 5
+DATAGRAM_DELTA_METADATA_SIZE = 5
+DATAGRAM_DELTA_DLC_SHIFT = 11
+DATAGRAM_MAX_DLC = 8
+CAN_ID_MASK = 0x7FF
+
+
+class TelemetryDecoder:
+    """
+    @brief Stream decoder that turns received bytes into (CAN ID, payload) pairs
+    """
+
+    def __init__(self):
+        """
+        @brief Initialize the decoder with no references
+        """
+        self._buffer = bytearray()
+        self._references = {}
+        self.dropped_bytes = 0
+        self.unsynced_deltas = 0
+
+    def feed(self, data: bytes):
+        """
+        @brief Decode every complete datagram in the received bytes
+        @param data Bytes received from the XBee
+        @return List of (can_id, payload bytes) tuples in the order they were sent
+        """
+        self._buffer.extend(data)
+        messages = []
+
+        while self._buffer:
+            start = self._buffer[0]
+
+            if start == DATAGRAM_START_FRAME:
+                result = self._parse_full()
+            elif start == DATAGRAM_DELTA_START_FRAME:
+                result = self._parse_delta()
+            else:
+                result = False
+
+            if result is None:
+                break  # Incomplete datagram, wait for more bytes
+            if result is False:
+                del self._buffer[0]
+                self.dropped_bytes += 1
+                continue
+
+            length, message = result
+            del self._buffer[:length]
+            if message is not None:
+                messages.append(message)
+
+        return messages
+
+    def _parse_full(self):
+        """
+        @brief Parse a full datagram at the start of the buffer
+        @return None if incomplete, False if invalid, otherwise (length, message)
+        """
+        if len(self._buffer) < 4:
+            return None
+
+        can_id = (self._buffer[1] << 8) | self._buffer[2]
+        dlc = self._buffer[3]
+        if dlc > DATAGRAM_MAX_DLC or can_id > CAN_ID_MASK:
+            return False
+
+        length = dlc + DATAGRAM_METADATA_SIZE
+        if len(self._buffer) < length:
+            return None
+        if self._buffer[length - 1] != DATAGRAM_END_FRAME:
+            return False
+
+        payload = bytes(self._buffer[4:4 + dlc])
+        self._references[can_id] = payload
+        return length, (can_id, payload)
+
+    def _parse_delta(self):
+        """
+        @brief Parse a delta datagram at the start of the buffer
+        @return None if incomplete, False if invalid, otherwise (length, message)
+        """
+        if len(self._buffer) < 4:
+            return None
+
+        header = (self._buffer[1] << 8) | self._buffer[2]
+        can_id = header & CAN_ID_MASK
+        dlc = header >> DATAGRAM_DELTA_DLC_SHIFT
+        change_mask = self._buffer[3]
+        if dlc > DATAGRAM_MAX_DLC or (change_mask >> dlc) != 0:
+            return False
+
+        length = bin(change_mask).count("1") + DATAGRAM_DELTA_METADATA_SIZE
+        if len(self._buffer) < length:
+            return None
+        if self._buffer[length - 1] != DATAGRAM_END_FRAME:
+            return False
+
+        reference = self._references.get(can_id)
+        if reference is None or len(reference) != dlc:
+            self.unsynced_deltas += 1
+            return length, None  # Wait for the next keyframe of this ID
+
+        payload = bytearray(reference)
+        deltas = iter(self._buffer[4:length - 1])
+        for i in range(dlc):
+            if change_mask & (1 << i):
+                payload[i] ^= next(deltas)
+
+        payload = bytes(payload)
+        self._references[can_id] = payload
+        return length, (can_id, payload)
+
+
+def main():
+    """
+    @brief Print every datagram received on the XBee serial port
+    """
+    parser = argparse.ArgumentParser(description="Decode the telemetry XBee stream")
+    parser.add_argument("port", help="Serial port the XBee is connected to, e.g. /dev/ttyUSB0")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    args = parser.parse_args()
+
+    decoder = TelemetryDecoder()
+    with serial.Serial(args.port, args.baudrate, timeout=1) as ser:
+        while True:
+            for can_id, payload in decoder.feed(ser.read(max(1, ser.in_waiting))):
+                print(f"0x{can_id:03x} [{len(payload)}] {payload.hex(' ')}")
+
+
+if __name__ == "__main__":
+    main()
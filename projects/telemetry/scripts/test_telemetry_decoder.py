@@ -0,0 +1,66 @@
+# pylint: skip-file
+'''This Module Tests methods in telemetry_decoder.py'''
+import unittest
+
+from telemetry_decoder import TelemetryDecoder
+
+TEST_CAN_ID = 0x1C5
+TEST_DATA = bytes([0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80])
+
+
+def full_datagram(can_id, data):
+    return bytes([0xAA, can_id >> 8, can_id & 0xFF, len(data)]) + data + bytes([0xBB])
+
+
+def delta_datagram(can_id, data, reference):
+    header = (len(data) << 11) | can_id
+    mask = 0
+    deltas = bytearray()
+    for i, (new, old) in enumerate(zip(data, reference)):
+        if new != old:
+            mask |= 1 << i
+            deltas.append(new ^ old)
+    return bytes([0xAD, header >> 8, header & 0xFF, mask]) + deltas + bytes([0xBB])
+
+
+class TestTelemetryDecoder(unittest.TestCase):
+    '''Test telemetry stream decoding'''
+
+    def test_full_datagram(self):
+        '''Test a full datagram is decoded as is'''
+        decoder = TelemetryDecoder()
+        self.assertEqual(decoder.feed(full_datagram(TEST_CAN_ID, TEST_DATA)), [(TEST_CAN_ID, TEST_DATA)])
+
+    def test_delta_after_keyframe(self):
+        '''Test delta datagrams are applied to the last payload of their ID'''
+        changed = bytes([0x10, 0x21, 0x30, 0x40, 0x50, 0x60, 0x70, 0x00])
+        unchanged = delta_datagram(TEST_CAN_ID, changed, changed)
+        self.assertEqual(len(unchanged), 5)
+
+        decoder = TelemetryDecoder()
+        stream = full_datagram(TEST_CAN_ID, TEST_DATA) + delta_datagram(TEST_CAN_ID, changed, TEST_DATA) + unchanged
+        self.assertEqual(decoder.feed(stream), [(TEST_CAN_ID, TEST_DATA), (TEST_CAN_ID, changed), (TEST_CAN_ID, changed)])
+
+    def test_delta_without_keyframe(self):
+        '''Test delta datagrams are dropped until a keyframe arrives'''
+        decoder = TelemetryDecoder()
+        self.assertEqual(decoder.feed(delta_datagram(TEST_CAN_ID, TEST_DATA, bytes(8))), [])
+        self.assertEqual(decoder.unsynced_deltas, 1)
+
+    def test_resync_after_garbage(self):
+        '''Test the decoder skips bytes that do not start a valid datagram'''
+        decoder = TelemetryDecoder()
+        stream = bytes([0x00, 0xAA, 0x12]) + full_datagram(TEST_CAN_ID, TEST_DATA)
+        self.assertEqual(decoder.feed(stream), [(TEST_CAN_ID, TEST_DATA)])
+        self.assertEqual(decoder.dropped_bytes, 3)
+
+    def test_split_stream(self):
+        '''Test a datagram split across reads is decoded once complete'''
+        decoder = TelemetryDecoder()
+        stream = full_datagram(TEST_CAN_ID, TEST_DATA)
+        self.assertEqual(decoder.feed(stream[:6]), [])
+        self.assertEqual(decoder.feed(stream[6:]), [(TEST_CAN_ID, TEST_DATA)])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -9,6 +9,7 @@
 
 /* Standard library Headers */
 #include <stddef.h>
+#include <string.h>
 
 /* Inter-component Headers */
 
@@ -16,59 +17,150 @@
 #include "can_cache.h"
 
 /* CAN IDs come from can/tools/system_dbc.dbc. Priority tier is the message cycle rate
-   in the source board's YAML (fast→HIGH, medium→MEDIUM, slow→LOW). */
+   in the source board's YAML (fast→HIGH, medium→MEDIUM, slow→LOW).
+   Each tier is listed once as X(name, can_id, dlc); the cache, the tier bounds and the
+   CAN ID lookup table are all expanded from these lists. */
 
-/* No fast-cycle messages target telemetry — placeholder keeps the array valid. */
-CanMessageCache g_can_cache_high[] = {
-  { 0 },
+/* No fast-cycle messages target telemetry. */
+#define CAN_CACHE_HIGH_ENTRIES(X)
+
+#define CAN_CACHE_MEDIUM_ENTRIES(X)       \
+  /* rear_controller messages */          \
+  X(rear_controller_status, 17U, 4U)      \
+  X(battery_stats_A, 33U, 6U)             \
+  X(battery_stats_B, 49U, 6U)             \
+  X(power_input_stats, 65U, 8U)           \
+  /* steering */                          \
+  X(steering, 96U, 5U)                    \
+  /* front_controller */                  \
+  X(drive_status, 1365U, 5U)              \
+  /* imu */                               \
+  X(accel_data, 1827U, 6U)                \
+  X(gyro_data, 1843U, 6U)                 \
+  /* rear_controller AFE messages */      \
+  X(AFE_discharge_bitset, 1825U, 8U)      \
+  X(AFE1_status_A, 1841U, 7U)             \
+  X(AFE1_status_B, 1857U, 7U)             \
+  X(AFE1_status_C, 1873U, 7U)             \
+  X(AFE1_status_D, 1889U, 7U)             \
+  X(AFE1_status_E, 1905U, 7U)             \
+  X(AFE1_status_F, 1921U, 7U)             \
+  X(AFE2_status_A, 1937U, 7U)             \
+  X(AFE2_status_B, 1953U, 7U)             \
+  X(AFE2_status_C, 1969U, 7U)             \
+  X(AFE2_status_D, 1985U, 7U)             \
+  X(AFE2_status_E, 2001U, 7U)             \
+  X(AFE2_status_F, 2017U, 7U)             \
+  X(AFE_temperature, 2033U, 8U)
+
+#define CAN_CACHE_LOW_ENTRIES(X)                                                 \
+  /* ---- CAN-received slow-cycle messages ---- */                               \
+  X(fc_power_group_A, 1525U, 8U)                                                 \
+  X(fc_power_lights_group, 1573U, 8U)                                            \
+  X(fc_power_group_B, 1621U, 4U)                                                 \
+  /* ---- Telemetry-internal messages (populated by scheduler) ---- */           \
+  X(telemetry_stats, TELEMETRY_STATS_CAN_ID, TELEMETRY_STATS_DLC)               \
+  /* ---- WS22 synthetic messages (floats re-encoded as scaled integers) ---- */ \
+  X(ws22_status, WS22_TELEMETRY_STATUS_ID, WS22_TELEMETRY_DLC)                   \
+  X(ws22_bus, WS22_TELEMETRY_BUS_ID, WS22_TELEMETRY_DLC)                         \
+  X(ws22_velocity, WS22_TELEMETRY_VELOCITY_ID, WS22_TELEMETRY_DLC)               \
+  X(ws22_temp, WS22_TELEMETRY_TEMP_ID, WS22_TELEMETRY_DLC)                       \
+  X(ws22_drive_cmd, WS22_TELEMETRY_DRIVE_CMD_ID, WS22_TELEMETRY_DLC)
+
+#define CAN_CACHE_SLOT(name, id, dlc) CAN_CACHE_SLOT_##name,
+#define CAN_CACHE_COUNT(name, id, dlc) +1U
+#define CAN_CACHE_INDEX(name, id, dlc) [(id)] = CAN_CACHE_SLOT_##name + 1U,
+#define CAN_CACHE_ENTRY(name, id, dlc, tier) { .can_id = (id), .length = (dlc), .priority = (tier) },
+#define CAN_CACHE_HIGH_ENTRY(name, id, dlc) CAN_CACHE_ENTRY(name, id, dlc, CAN_MSG_PRIORITY_HIGH)
+#define CAN_CACHE_MEDIUM_ENTRY(name, id, dlc) CAN_CACHE_ENTRY(name, id, dlc, CAN_MSG_PRIORITY_MEDIUM)
+#define CAN_CACHE_LOW_ENTRY(name, id, dlc) CAN_CACHE_ENTRY(name, id, dlc, CAN_MSG_PRIORITY_LOW)
+
+#define CAN_CACHE_HIGH_SIZE (0U CAN_CACHE_HIGH_ENTRIES(CAN_CACHE_COUNT))
+#define CAN_CACHE_MEDIUM_SIZE (0U CAN_CACHE_MEDIUM_ENTRIES(CAN_CACHE_COUNT))
+#define CAN_CACHE_LOW_SIZE (0U CAN_CACHE_LOW_ENTRIES(CAN_CACHE_COUNT))
+
+/** @brief  Cache slot of every entry, in cache order */
+typedef enum {
+  CAN_CACHE_HIGH_ENTRIES(CAN_CACHE_SLOT) CAN_CACHE_MEDIUM_ENTRIES(CAN_CACHE_SLOT) CAN_CACHE_LOW_ENTRIES(CAN_CACHE_SLOT) NUM_CAN_CACHE_SLOTS,
+} CanCacheSlot;
+
+/* The lookup table stores slot + 1 in a byte so that 0 means not cached */
+_Static_assert(NUM_CAN_CACHE_SLOTS < UINT8_MAX, "CAN cache lookup table entries must fit in a byte");
+
+CanMessageCache g_can_cache[] = {
+  CAN_CACHE_HIGH_ENTRIES(CAN_CACHE_HIGH_ENTRY) CAN_CACHE_MEDIUM_ENTRIES(CAN_CACHE_MEDIUM_ENTRY) CAN_CACHE_LOW_ENTRIES(CAN_CACHE_LOW_ENTRY)
 };
-const size_t g_can_cache_high_size = 0U;
-
-CanMessageCache g_can_cache_medium[] = {
-  /* rear_controller messages */
-  { .can_id = 17U, .length = 4U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* rear_controller_status */
-  { .can_id = 33U, .length = 6U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* battery_stats_A        */
-  { .can_id = 49U, .length = 6U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* battery_stats_B        */
-  { .can_id = 65U, .length = 8U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* power_input_stats      */
-  /* steering */
-  { .can_id = 96U, .length = 5U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* steering               */
-  /* front_controller */
-  { .can_id = 1365U, .length = 5U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* drive_status           */
-  /* imu */
-  { .can_id = 1827U, .length = 6U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* accel_data             */
-  { .can_id = 1843U, .length = 6U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* gyro_data              */
-  /* rear_controller AFE messages */
-  { .can_id = 1825U, .length = 8U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE_discharge_bitset   */
-  { .can_id = 1841U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_A          */
-  { .can_id = 1857U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_B          */
-  { .can_id = 1873U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_C          */
-  { .can_id = 1889U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_D          */
-  { .can_id = 1905U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_E          */
-  { .can_id = 1921U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE1_status_F          */
-  { .can_id = 1937U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_A          */
-  { .can_id = 1953U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_B          */
-  { .can_id = 1969U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_C          */
-  { .can_id = 1985U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_D          */
-  { .can_id = 2001U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_E          */
-  { .can_id = 2017U, .length = 7U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE2_status_F          */
-  { .can_id = 2033U, .length = 8U, .priority = CAN_MSG_PRIORITY_MEDIUM }, /* AFE_temperature        */
+const size_t g_can_cache_size = NUM_CAN_CACHE_SLOTS;
+
+CanMessageCache *const g_can_cache_tiers[NUM_CAN_MSG_PRIORITIES] = {
+  [CAN_MSG_PRIORITY_HIGH] = &g_can_cache[0U],
+  [CAN_MSG_PRIORITY_MEDIUM] = &g_can_cache[CAN_CACHE_HIGH_SIZE],
+  [CAN_MSG_PRIORITY_LOW] = &g_can_cache[CAN_CACHE_HIGH_SIZE + CAN_CACHE_MEDIUM_SIZE],
+};
+
+const size_t g_can_cache_tier_sizes[NUM_CAN_MSG_PRIORITIES] = {
+  [CAN_MSG_PRIORITY_HIGH] = CAN_CACHE_HIGH_SIZE,
+  [CAN_MSG_PRIORITY_MEDIUM] = CAN_CACHE_MEDIUM_SIZE,
+  [CAN_MSG_PRIORITY_LOW] = CAN_CACHE_LOW_SIZE,
 };
-const size_t g_can_cache_medium_size = sizeof(g_can_cache_medium) / sizeof(g_can_cache_medium[0]);
-
-CanMessageCache g_can_cache_low[] = {
-  /* ---- CAN-received slow-cycle messages ---- */
-  { .can_id = 1525U, .length = 8U, .priority = CAN_MSG_PRIORITY_LOW }, /* fc_power_group_A      */
-  { .can_id = 1573U, .length = 8U, .priority = CAN_MSG_PRIORITY_LOW }, /* fc_power_lights_group */
-  { .can_id = 1621U, .length = 4U, .priority = CAN_MSG_PRIORITY_LOW }, /* fc_power_group_B      */
-
-  /* ---- Telemetry-internal messages (populated by scheduler, not CAN RX) ---- */
-  { .can_id = TELEMETRY_STATS_CAN_ID, .length = TELEMETRY_STATS_DLC, .priority = CAN_MSG_PRIORITY_LOW }, /* telemetry_stats       */
-
-  /* ---- WS22 synthetic messages (floats re-encoded as scaled integers) ---- */
-  { .can_id = WS22_TELEMETRY_STATUS_ID, .length = WS22_TELEMETRY_DLC, .priority = CAN_MSG_PRIORITY_LOW },    /* ws22_status    */
-  { .can_id = WS22_TELEMETRY_BUS_ID, .length = WS22_TELEMETRY_DLC, .priority = CAN_MSG_PRIORITY_LOW },       /* ws22_bus       */
-  { .can_id = WS22_TELEMETRY_VELOCITY_ID, .length = WS22_TELEMETRY_DLC, .priority = CAN_MSG_PRIORITY_LOW },  /* ws22_velocity  */
-  { .can_id = WS22_TELEMETRY_TEMP_ID, .length = WS22_TELEMETRY_DLC, .priority = CAN_MSG_PRIORITY_LOW },      /* ws22_temp      */
-  { .can_id = WS22_TELEMETRY_DRIVE_CMD_ID, .length = WS22_TELEMETRY_DLC, .priority = CAN_MSG_PRIORITY_LOW }, /* ws22_drive_cmd */
+
+/* Duplicate CAN IDs override an earlier initializer, which -Woverride-init rejects */
+static const uint8_t s_can_cache_index[CAN_CACHE_MAX_ID + 1U] = {
+  CAN_CACHE_HIGH_ENTRIES(CAN_CACHE_INDEX) CAN_CACHE_MEDIUM_ENTRIES(CAN_CACHE_INDEX) CAN_CACHE_LOW_ENTRIES(CAN_CACHE_INDEX)
 };
-const size_t g_can_cache_low_size = sizeof(g_can_cache_low) / sizeof(g_can_cache_low[0]);
+
+CanMessageCache *can_cache_lookup(uint32_t can_id) {
+  if (can_id > CAN_CACHE_MAX_ID || s_can_cache_index[can_id] == 0U) {
+    return NULL;
+  }
+
+  return &g_can_cache[s_can_cache_index[can_id] - 1U];
+}
+
+void can_cache_update(CanMessageCache *entry, const uint8_t *data, uint32_t now, uint32_t heartbeat_ticks) {
+  entry->last_updated_tick = now;
+
+  bool data_changed = (memcmp(entry->data, data, entry->length) != 0);
+  bool heartbeat_due = ((now - entry->last_tx_tick) >= heartbeat_ticks);
+
+  if (!data_changed && !heartbeat_due) {
+    return;
+  }
+
+  /* The owner is the only writer, so the sequence can be advanced without a read-modify-write */
+  uint32_t sequence = atomic_load_explicit(&entry->sequence, memory_order_relaxed);
+  atomic_store_explicit(&entry->sequence, sequence + 1U, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  memcpy(entry->data, data, entry->length);
+
+  atomic_store_explicit(&entry->sequence, sequence + 2U, memory_order_release);
+}
+
+bool can_cache_is_pending(CanMessageCache *entry) {
+  return atomic_load_explicit(&entry->sequence, memory_order_acquire) != entry->tx_sequence;
+}
+
+bool can_cache_read_pending(CanMessageCache *entry, uint8_t *data, uint32_t *sequence) {
+  uint32_t start = atomic_load_explicit(&entry->sequence, memory_order_acquire);
+
+  /* Odd while the owner is writing; the scheduler must not spin on a preempted writer */
+  if (start == entry->tx_sequence || (start & 1U) != 0U) {
+    return false;
+  }
+
+  memcpy(data, entry->data, sizeof(entry->data));
+
+  atomic_thread_fence(memory_order_acquire);
+  if (atomic_load_explicit(&entry->sequence, memory_order_relaxed) != start) {
+    return false;
+  }
+
+  *sequence = start;
+  return true;
+}
+
+void can_cache_mark_transmitted(CanMessageCache *entry, uint32_t sequence, uint32_t now) {
+  entry->tx_sequence = sequence;
+  entry->last_tx_tick = now;
+}
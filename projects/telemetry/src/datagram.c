@@ -48,6 +48,33 @@ StatusCode encode_datagram(Datagram *datagram, uint32_t id, uint8_t dlc, const u
   return STATUS_CODE_OK;
 }
 
+StatusCode encode_delta_datagram(uint8_t *buffer, size_t *length, uint32_t id, uint8_t dlc, const uint8_t *data, const uint8_t *reference) {
+  if (buffer == NULL || length == NULL || data == NULL || reference == NULL || id > 0x7FFU || dlc > 8U) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  uint16_t header = (uint16_t)(((uint16_t)dlc << DATAGRAM_DELTA_DLC_SHIFT) | id);
+  uint8_t change_mask = 0U;
+  size_t offset = 4U;
+
+  for (size_t i = 0; i < dlc; ++i) {
+    uint8_t delta = data[i] ^ reference[i];
+    if (delta != 0U) {
+      change_mask |= (uint8_t)(1U << i);
+      buffer[offset++] = delta;
+    }
+  }
+
+  buffer[0] = DATAGRAM_DELTA_START_FRAME;
+  buffer[1] = (uint8_t)(header >> 8U);
+  buffer[2] = (uint8_t)(header & 0xFFU);
+  buffer[3] = change_mask;
+  buffer[offset++] = DATAGRAM_END_FRAME;
+
+  *length = offset;
+  return STATUS_CODE_OK;
+}
+
 void log_decoded_message(Datagram *datagram) {
   delay_ms(5);
   LOG_DEBUG("Start frame: 0x%0x. End frame: 0x%0x\n", datagram->start_frame, datagram->data[datagram->dlc]);
@@ -34,6 +34,7 @@ TelemetryConfig telemetry_config = {
   .message_transmit_frequency_hz = 1000U,
   .uart_port = TELEMETRY_XBEE_UART_PORT,
   .uart_settings = { .tx = GPIO_TELEMETRY_UART_TX, .rx = GPIO_TELEMETRY_UART_RX, .baudrate = TELEMETRY_XBEE_UART_BAUDRATE, .flow_control = TELEMETRY_XBEE_UART_FLOW_CONTROL },
+  .compressed_stream = false,
   .sd_spi_port = SPI_PORT_2,
   .sd_spi_settings = { .baudrate = SD_SPI_BAUDRATE_2_5MHZ,
                        .mode = SD_SPI_MODE_1,
@@ -106,6 +106,7 @@ static char s_disk_path[4U] = { "/sd" };
 static SdSpiPort s_spi_port;
 static SdSpiSettings *s_spi_settings;
 static bool s_is_initialized = false;
+static bool s_is_block_addressed = false;
 
 /************************************************************************************************
  * Private helper functions
@@ -242,6 +243,19 @@ static StatusCode s_sd_get_data_response(void) {
   return STATUS_CODE_INTERNAL_ERROR;
 }
 
+/* SDHC/SDXC cards are addressed in blocks, standard capacity cards in bytes */
+static uint32_t s_block_address(LBA_t sector) {
+  return s_is_block_addressed ? (uint32_t)sector : (uint32_t)sector * 512U;
+}
+
+static StatusCode s_sd_write_data_block(uint8_t token, const BYTE *buff) {
+  sd_spi_tx(s_spi_port, &token, 1U);
+  sd_spi_tx(s_spi_port, (uint8_t *)buff, 512U);
+  sd_spi_tx(s_spi_port, (uint8_t[]){ 0xFF, 0xFF }, 2U);
+
+  return s_sd_get_data_response();
+}
+
 /************************************************************************************************
  * SD Card driver functions
  ************************************************************************************************/
@@ -312,6 +326,7 @@ static DSTATUS sd_card_init(BYTE pdrv) {
   /* Step 5: Read OCR */
   r1 = s_send_sd_cmd(SD_CMD_READ_OCR, 0U, 0xFFU, SD_RESPONSE_R3);
   bool is_sdhc = (r1.r2 & 0x40U);
+  s_is_block_addressed = is_sdhc;
 
   /* Step 6: If not SDHC set block length to 512 */
   if (!is_sdhc) {
@@ -342,7 +357,7 @@ static DRESULT sd_read_blocks(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
   DRESULT result = RES_OK;
 
   while (count--) {
-    SdResponse r1 = s_send_sd_cmd(SD_CMD_READ_SINGLE_BLOCK, sector * 512U, 0xFFU, SD_RESPONSE_R1);
+    SdResponse r1 = s_send_sd_cmd(SD_CMD_READ_SINGLE_BLOCK, s_block_address(sector), 0xFFU, SD_RESPONSE_R1);
 
     if (r1.r1 != SD_R1_NO_ERROR) {
       result = RES_ERROR;
@@ -385,8 +400,8 @@ static DRESULT sd_read_blocks(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
 }
 
 static DRESULT sd_write_blocks(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) {
-  while (count--) {
-    SdResponse r1 = s_send_sd_cmd(SD_CMD_WRITE_SINGLE_BLOCK, sector * 512U, 0xFFU, SD_RESPONSE_R1);
+  if (count == 1U) {
+    SdResponse r1 = s_send_sd_cmd(SD_CMD_WRITE_SINGLE_BLOCK, s_block_address(sector), 0xFFU, SD_RESPONSE_R1);
 
     if (r1.r1 != SD_R1_NO_ERROR) {
       return RES_ERROR;
@@ -394,14 +409,41 @@ static DRESULT sd_write_blocks(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT c
 
     s_read_byte();
 
-    sd_spi_tx(s_spi_port, (uint8_t[]){ SD_TOKEN_START_DATA_SINGLE_BLOCK_WRITE }, 1);
-    sd_spi_tx(s_spi_port, (uint8_t *)buff, 512);
-    sd_spi_tx(s_spi_port, (uint8_t[]){ 0xFF, 0xFF }, 2);
+    if (s_sd_write_data_block(SD_TOKEN_START_DATA_SINGLE_BLOCK_WRITE, buff) != STATUS_CODE_OK) return RES_ERROR;
+  } else {
+    /* Contiguous sectors are streamed with one command so the card programs them back to back */
+    SdResponse r1 = s_send_sd_cmd(SD_CMD_WRITE_MULTI_BLOCK, s_block_address(sector), 0xFFU, SD_RESPONSE_R1);
+
+    if (r1.r1 != SD_R1_NO_ERROR) {
+      return RES_ERROR;
+    }
 
-    if (s_sd_get_data_response() != STATUS_CODE_OK) return RES_ERROR;
+    s_read_byte();
 
-    buff += 512U;
-    sector++;
+    DRESULT result = RES_OK;
+    while (count--) {
+      if (s_sd_write_data_block(SD_TOKEN_START_DATA_MULTI_BLOCK_WRITE, buff) != STATUS_CODE_OK) {
+        result = RES_ERROR;
+        break;
+      }
+
+      buff += 512U;
+    }
+
+    /* The stop token is sent even after an error so the card leaves the write state */
+    sd_spi_cs_set_state(s_spi_port, GPIO_STATE_LOW);
+    sd_spi_tx(s_spi_port, (uint8_t[]){ SD_TOKEN_STOP_DATA_MULTI_BLOCK_WRITE }, 1U);
+    s_read_byte();
+
+    if (!s_wait_for_ready()) {
+      result = RES_ERROR;
+    }
+
+    if (result != RES_OK) {
+      sd_spi_cs_set_state(s_spi_port, GPIO_STATE_HIGH);
+      s_read_byte();
+      return result;
+    }
   }
 
   sd_spi_cs_set_state(s_spi_port, GPIO_STATE_HIGH);
@@ -0,0 +1,279 @@
+/************************************************************************************************
+ * @file    sd_logger.c
+ *
+ * @brief   SD card CAN logger
+ *
+ * @date    2026-10-16
+ * @author  Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "ff.h"
+#include "log.h"
+#include "ms_semaphore.h"
+#include "notify.h"
+#include "tasks.h"
+
+/* Intra-component Headers */
+#include "sd_logger.h"
+
+#define SD_LOGGER_EVENT_BUFFER_READY 0U
+#define SD_LOGGER_RETRY_PERIOD_MS 5000U
+#define SD_LOGGER_MAX_FILE_INDEX 99999U
+
+_Static_assert(sizeof(SdLogRecord) == 16U, "Log records must evenly fill a sector");
+_Static_assert((SD_LOGGER_BUFFER_SIZE % 512U) == 0U, "Log buffers must hold whole sectors");
+_Static_assert((SD_LOGGER_FILE_SIZE % SD_LOGGER_BUFFER_SIZE) == 0U, "Log files must hold whole buffers");
+
+/* Buffers alternate between the writer and the flush task. A buffer belongs to the flush task while it is ready */
+static uint8_t s_log_buffers[2U][SD_LOGGER_BUFFER_SIZE];
+static atomic_bool s_buffer_ready[2U];
+static atomic_bool s_is_logging;
+
+/* Shared by the writer and the flush task, which hands over a stale fill buffer */
+static Mutex s_fill_mutex;
+static size_t s_fill_buffer = 0U;
+static size_t s_fill_length = 0U;
+static uint32_t s_fill_start_tick = 0U;
+
+/* Writer task only */
+static uint8_t s_sequence = 0U;
+
+/* Flush task only */
+static FATFS s_fs;
+static FIL s_file;
+static bool s_file_preallocated = false;
+static uint32_t s_file_index = 0U;
+static size_t s_flush_buffer = 0U;
+
+static volatile SdLoggerStats s_stats;
+
+static FRESULT s_mount(void) {
+  FRESULT result = f_mount(&s_fs, "", 1);
+
+#ifdef MS_PLATFORM_X86
+  /* A fresh card image has no file system yet */
+  if (result == FR_NO_FILESYSTEM) {
+    static uint8_t s_mkfs_work[FF_MAX_SS];
+    result = f_mkfs("", NULL, s_mkfs_work, sizeof(s_mkfs_work));
+    if (result == FR_OK) {
+      result = f_mount(&s_fs, "", 1);
+    }
+  }
+#endif
+
+  return result;
+}
+
+static FRESULT s_open_next_file(void) {
+  char file_name[16U];
+  FRESULT result = FR_EXIST;
+
+  while (result == FR_EXIST && s_file_index <= SD_LOGGER_MAX_FILE_INDEX) {
+    snprintf(file_name, sizeof(file_name), "CAN%05u.LOG", (unsigned int)s_file_index++);
+    result = f_open(&s_file, file_name, FA_WRITE | FA_CREATE_NEW);
+  }
+
+  if (result != FR_OK) {
+    return result;
+  }
+
+  /* A contiguous preallocation keeps FAT and directory updates out of the write path */
+  s_file_preallocated = (f_expand(&s_file, SD_LOGGER_FILE_SIZE, 1U) == FR_OK);
+  if (!s_file_preallocated) {
+    LOG_DEBUG("No contiguous space for %s, logging without preallocation\n", file_name);
+  }
+
+  return f_sync(&s_file);
+}
+
+/* A buffer that fails to write stays ready, and logging stops until the card is remounted */
+static StatusCode s_write_buffer(size_t buffer) {
+  if (f_tell(&s_file) + SD_LOGGER_BUFFER_SIZE > SD_LOGGER_FILE_SIZE) {
+    f_close(&s_file);
+    if (s_open_next_file() != FR_OK) {
+      s_stats.write_errors++;
+      atomic_store(&s_is_logging, false);
+      return STATUS_CODE_INTERNAL_ERROR;
+    }
+  }
+
+  UINT bytes_written = 0U;
+  uint32_t start_tick = (uint32_t)xTaskGetTickCount();
+  FRESULT result = f_write(&s_file, s_log_buffers[buffer], SD_LOGGER_BUFFER_SIZE, &bytes_written);
+
+  /* Only a growing file needs its directory entry updated */
+  if (result == FR_OK && !s_file_preallocated) {
+    result = f_sync(&s_file);
+  }
+  uint32_t write_ticks = (uint32_t)xTaskGetTickCount() - start_tick;
+
+  if (result != FR_OK || bytes_written != SD_LOGGER_BUFFER_SIZE) {
+    LOG_DEBUG("SD log write failed: %d\n", result);
+    s_stats.write_errors++;
+    atomic_store(&s_is_logging, false);
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  s_stats.bytes_written += bytes_written;
+  s_stats.total_write_ticks += write_ticks;
+  if (write_ticks > s_stats.max_write_ticks) {
+    s_stats.max_write_ticks = write_ticks;
+  }
+
+  return STATUS_CODE_OK;
+}
+
+static StatusCode s_start_logging(void) {
+  f_unmount("");
+
+  if (s_mount() != FR_OK || s_open_next_file() != FR_OK) {
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  /* Buffers queued before a failure, including the one that failed, are written to the new file */
+  atomic_store(&s_is_logging, true);
+
+  LOG_DEBUG("SD logging started\n");
+  return STATUS_CODE_OK;
+}
+
+static uint32_t s_flush_stale_buffer(void);
+
+/*
+ Low priority task writing full buffers to the card, in the order they were filled. It wakes when a buffer
+ fills or when the fill buffer goes stale, so a quiet bus still reaches the card within the flush period
+ */
+TASK(sd_logger_flush, TASK_STACK_1024) {
+  uint32_t notification = 0U;
+
+  while (true) {
+    if (!atomic_load(&s_is_logging) && s_start_logging() != STATUS_CODE_OK) {
+      vTaskDelay(pdMS_TO_TICKS(SD_LOGGER_RETRY_PERIOD_MS));
+      continue;
+    }
+
+    uint32_t wait_ms = s_flush_stale_buffer();
+
+    while (atomic_load(&s_buffer_ready[s_flush_buffer]) && s_write_buffer(s_flush_buffer) == STATUS_CODE_OK) {
+      atomic_store(&s_buffer_ready[s_flush_buffer], false);
+      s_flush_buffer ^= 1U;
+    }
+
+    notify_wait(&notification, wait_ms);
+  }
+}
+
+/* Hand the fill buffer to the flush task, padding the unused tail. Called with the fill mutex held, returns false if the flush task still owns the other buffer */
+static bool s_swap_buffers(void) {
+  size_t next_buffer = s_fill_buffer ^ 1U;
+
+  if (atomic_load(&s_buffer_ready[next_buffer])) {
+    return false;
+  }
+
+  /* 0xFF padding reads back as SD_LOGGER_PADDING_ID records */
+  memset(&s_log_buffers[s_fill_buffer][s_fill_length], 0xFF, SD_LOGGER_BUFFER_SIZE - s_fill_length);
+  atomic_store(&s_buffer_ready[s_fill_buffer], true);
+  notify(sd_logger_flush, SD_LOGGER_EVENT_BUFFER_READY);
+
+  s_fill_buffer = next_buffer;
+  s_fill_length = 0U;
+  return true;
+}
+
+/* Hand over a partially filled buffer once it reaches the flush period. Returns the time until the fill buffer goes stale */
+static uint32_t s_flush_stale_buffer(void) {
+  uint32_t wait_ms = SD_LOGGER_FLUSH_PERIOD_MS;
+
+  ms_mutex_lock(&s_fill_mutex, BLOCK_INDEFINITELY);
+
+  if (s_fill_length > 0U) {
+    TickType_t age_ticks = xTaskGetTickCount() - s_fill_start_tick;
+    TickType_t period_ticks = pdMS_TO_TICKS(SD_LOGGER_FLUSH_PERIOD_MS);
+
+    if (age_ticks < period_ticks) {
+      wait_ms = (period_ticks - age_ticks) * portTICK_PERIOD_MS;
+    } else if (s_swap_buffers()) {
+      wait_ms = SD_LOGGER_FLUSH_PERIOD_MS;
+    } else {
+      /* The other buffer is written below, retry straight after */
+      wait_ms = 0U;
+    }
+  }
+
+  ms_mutex_unlock(&s_fill_mutex);
+
+  return wait_ms;
+}
+
+StatusCode sd_logger_init(TelemetryStorage *storage) {
+  if (storage == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  atomic_init(&s_buffer_ready[0U], false);
+  atomic_init(&s_buffer_ready[1U], false);
+  atomic_init(&s_is_logging, false);
+  status_ok_or_return(ms_mutex_init(&s_fill_mutex));
+
+  return tasks_init_task(sd_logger_flush, TASK_PRIORITY(1), NULL);
+}
+
+StatusCode sd_logger_log_can(const CanMessage *message) {
+  if (message == NULL) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  if (!atomic_load(&s_is_logging)) {
+    return STATUS_CODE_UNINITIALIZED;
+  }
+
+  uint32_t now = (uint32_t)xTaskGetTickCount();
+
+  /* Held for one record copy, or the padding of a full buffer, never across a card write */
+  ms_mutex_lock(&s_fill_mutex, BLOCK_INDEFINITELY);
+
+  if ((s_fill_length + sizeof(SdLogRecord) > SD_LOGGER_BUFFER_SIZE) && !s_swap_buffers()) {
+    ms_mutex_unlock(&s_fill_mutex);
+    s_stats.frames_dropped++;
+    return STATUS_CODE_RESOURCE_EXHAUSTED;
+  }
+
+  if (s_fill_length == 0U) {
+    s_fill_start_tick = now;
+  }
+
+  SdLogRecord *record = (SdLogRecord *)&s_log_buffers[s_fill_buffer][s_fill_length];
+  record->tick = now;
+  record->id = (uint16_t)message->id.raw;
+  record->dlc = message->dlc;
+  record->sequence = s_sequence++;
+  memcpy(record->data, message->data_u8, sizeof(record->data));
+
+  s_fill_length += sizeof(SdLogRecord);
+  ms_mutex_unlock(&s_fill_mutex);
+
+  s_stats.frames_logged++;
+
+  return STATUS_CODE_OK;
+}
+
+void sd_logger_get_stats(SdLoggerStats *stats) {
+  if (stats == NULL) {
+    return;
+  }
+
+  stats->frames_logged = s_stats.frames_logged;
+  stats->frames_dropped = s_stats.frames_dropped;
+  stats->bytes_written = s_stats.bytes_written;
+  stats->write_errors = s_stats.write_errors;
+  stats->max_write_ticks = s_stats.max_write_ticks;
+  stats->total_write_ticks = s_stats.total_write_ticks;
+}
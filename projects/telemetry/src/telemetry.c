@@ -24,6 +24,7 @@
 /* Intra-component Headers */
 #include "bmi323.h"
 #include "sd_card_interface.h"
+#include "sd_logger.h"
 #include "telemetry.h"
 #include "telemetry_hw_defs.h"
 #include "xb_transmit.h"
@@ -61,6 +62,7 @@ StatusCode telemetry_init(TelemetryStorage *telemetry_storage, TelemetryConfig *
   queue_init(&telemetry_storage->datagram_queue);
   bmi323_init(bmi323_storage);
   sd_card_link_driver(telemetry_storage->config->sd_spi_port, &telemetry_storage->config->sd_spi_settings);
+  sd_logger_init(telemetry_storage);
   xb_transmit_init(telemetry_storage, telemetry_storage->config);
 
   gpio_init_pin(&s_telemetry_board_led, GPIO_OUTPUT_PUSH_PULL, GPIO_STATE_HIGH);
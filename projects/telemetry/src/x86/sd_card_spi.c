@@ -8,26 +8,363 @@
  ************************************************************************************************/
 
 /* Standard library Headers */
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /* Inter-component Headers */
+#include "FreeRTOS.h"
 #include "gpio.h"
+#include "log.h"
+#include "task.h"
 
 /* Intra-component Headers */
 #include "sd_card_spi.h"
 
+/*
+ * The x86 backend emulates an SDHC card in SPI mode on top of an image file, so the unmodified
+ * SD card driver and FatFs run against it. Only the commands used by the driver are answered.
+ * The chip select line is not modelled, the card always listens.
+ * SPI clocking and block programming take simulated time in FreeRTOS ticks, so log throughput
+ * and write latency can be measured.
+ */
+
+#ifndef SD_CARD_IMAGE_FILENAME
+#define SD_CARD_IMAGE_FILENAME "Midsun_x86_sd_card"
+#endif
+
+#ifndef SD_CARD_IMAGE_SECTORS
+#define SD_CARD_IMAGE_SECTORS 131072U /* 64 MiB */
+#endif
+
+#ifndef SD_CARD_PROGRAM_LATENCY_US
+#define SD_CARD_PROGRAM_LATENCY_US 250U
+#endif
+
+#define SD_SIM_BLOCK_SIZE 512U
+#define SD_SIM_CMD_SIZE 6U
+#define SD_SIM_CRC_SIZE 2U
+#define SD_SIM_MAX_RESPONSE (SD_SIM_BLOCK_SIZE + 16U)
+
+#define SD_SIM_R1_IDLE 0x01U
+#define SD_SIM_R1_ILLEGAL_COMMAND 0x04U
+#define SD_SIM_R1_ADDRESS_ERROR 0x20U
+#define SD_SIM_TOKEN_SINGLE 0xFEU
+#define SD_SIM_TOKEN_MULTI 0xFCU
+#define SD_SIM_TOKEN_STOP 0xFDU
+#define SD_SIM_DATA_ACCEPTED 0x05U
+#define SD_SIM_DATA_WRITE_ERROR 0x0DU
+
+/** @brief  Receive state of the emulated card */
+typedef enum {
+  SD_SIM_STATE_IDLE = 0,   /**< Waiting for a command */
+  SD_SIM_STATE_COMMAND,    /**< Receiving a command frame */
+  SD_SIM_STATE_WAIT_TOKEN, /**< Waiting for the start token of a write block */
+  SD_SIM_STATE_DATA,       /**< Receiving a write block and its CRC */
+} SdSimState;
+
+/** @brief  Emulated SD card */
+typedef struct {
+  int image_fd;                                      /**< Card image file */
+  SdSimState state;                                  /**< Receive state */
+  bool in_idle;                                      /**< Card has not completed initialization */
+  bool app_command;                                  /**< Previous command was CMD55 */
+  bool multi_block;                                  /**< Current write is a CMD25 */
+  uint32_t block;                                    /**< Next block to be written */
+  uint8_t command[SD_SIM_CMD_SIZE];                  /**< Command frame being received */
+  size_t command_length;                             /**< Bytes of the command frame received */
+  uint8_t data[SD_SIM_BLOCK_SIZE + SD_SIM_CRC_SIZE]; /**< Write block being received */
+  size_t data_length;                                /**< Bytes of the write block received */
+  uint8_t response[SD_SIM_MAX_RESPONSE];             /**< Bytes the card clocks out next */
+  size_t response_length;                            /**< Number of queued response bytes */
+  size_t response_pos;                               /**< Next response byte to clock out */
+  uint32_t spi_clock_hz;                             /**< Simulated SPI clock */
+  uint64_t pending_us;                               /**< Simulated time not yet waited for */
+} SdSimCard;
+
+typedef struct {
+  bool initialized;
+} SdSpiPortData;
+
+static SdSpiPortData s_port[NUM_SD_SPI_PORTS];
+static SdSimCard s_card = { .image_fd = -1, .in_idle = true };
+
+static void s_add_latency(uint64_t latency_us) {
+  s_card.pending_us += latency_us;
+
+  /* Whole ticks are waited, the remainder carries over to the next transfer */
+  uint64_t tick_us = portTICK_PERIOD_MS * 1000U;
+  if (s_card.pending_us >= tick_us && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+    vTaskDelay((TickType_t)(s_card.pending_us / tick_us));
+    s_card.pending_us %= tick_us;
+  }
+}
+
+static void s_queue_response(const uint8_t *bytes, size_t length) {
+  if (s_card.response_length + length > SD_SIM_MAX_RESPONSE) {
+    return;
+  }
+
+  memcpy(&s_card.response[s_card.response_length], bytes, length);
+  s_card.response_length += length;
+}
+
+static void s_queue_r1(uint8_t r1) {
+  /* One byte of command response delay (Ncr) */
+  s_queue_response((uint8_t[]){ 0xFFU, r1 }, 2U);
+}
+
+static uint8_t s_r1_status(void) {
+  return s_card.in_idle ? SD_SIM_R1_IDLE : 0x00U;
+}
+
+static void s_queue_data_block(const uint8_t *block, size_t length) {
+  /* Access delay (Nac) before the start token, then the block and a dummy CRC */
+  s_queue_response((uint8_t[]){ 0xFFU, 0xFFU, SD_SIM_TOKEN_SINGLE }, 3U);
+  s_queue_response(block, length);
+  s_queue_response((uint8_t[]){ 0xFFU, 0xFFU }, SD_SIM_CRC_SIZE);
+}
+
+static void s_queue_csd(void) {
+  /* CSD version 2.0, capacity is (C_SIZE + 1) * 512 KiB */
+  uint32_t c_size = (SD_CARD_IMAGE_SECTORS / 1024U) - 1U;
+  uint8_t csd[16] = { 0x40U, 0x0EU, 0x00U, 0x32U, 0x5BU, 0x59U, 0x00U };
+  csd[7] = (uint8_t)((c_size >> 16U) & 0x3FU);
+  csd[8] = (uint8_t)(c_size >> 8U);
+  csd[9] = (uint8_t)c_size;
+  csd[10] = 0x7FU;
+  csd[11] = 0x80U;
+  csd[12] = 0x0AU;
+  csd[13] = 0x40U;
+  csd[15] = 0x01U;
+
+  s_queue_data_block(csd, sizeof(csd));
+}
+
+static bool s_block_in_range(uint32_t block) {
+  return block < SD_CARD_IMAGE_SECTORS;
+}
+
+static void s_handle_command(void) {
+  uint8_t index = s_card.command[0] & 0x3FU;
+  uint32_t arg = ((uint32_t)s_card.command[1] << 24U) | ((uint32_t)s_card.command[2] << 16U) | ((uint32_t)s_card.command[3] << 8U) | s_card.command[4];
+  bool app_command = s_card.app_command;
+
+  s_card.app_command = false;
+  s_card.response_length = 0U;
+  s_card.response_pos = 0U;
+
+  switch (index) {
+    case 0U:
+      s_card.in_idle = true;
+      s_queue_r1(SD_SIM_R1_IDLE);
+      break;
+    case 8U:
+      s_queue_r1(s_r1_status());
+      s_queue_response((uint8_t[]){ 0x00U, 0x00U, (uint8_t)((arg >> 8U) & 0x0FU), (uint8_t)arg }, 4U);
+      break;
+    case 9U:
+      s_queue_r1(s_r1_status());
+      s_queue_csd();
+      break;
+    case 16U:
+      s_queue_r1(s_r1_status());
+      break;
+    case 17U: {
+      if (!s_block_in_range(arg)) {
+        s_queue_r1(SD_SIM_R1_ADDRESS_ERROR);
+        break;
+      }
+
+      uint8_t block[SD_SIM_BLOCK_SIZE] = { 0 };
+      if (pread(s_card.image_fd, block, SD_SIM_BLOCK_SIZE, (off_t)arg * SD_SIM_BLOCK_SIZE) < 0) {
+        LOG_DEBUG("SD image read failed\n");
+      }
+
+      s_queue_r1(0x00U);
+      s_queue_data_block(block, SD_SIM_BLOCK_SIZE);
+      break;
+    }
+    case 24U:
+    case 25U:
+      if (!s_block_in_range(arg)) {
+        s_queue_r1(SD_SIM_R1_ADDRESS_ERROR);
+        break;
+      }
+
+      s_card.block = arg;
+      s_card.multi_block = (index == 25U);
+      s_card.state = SD_SIM_STATE_WAIT_TOKEN;
+      s_queue_r1(0x00U);
+      break;
+    case 41U:
+      if (!app_command) {
+        s_queue_r1(s_r1_status() | SD_SIM_R1_ILLEGAL_COMMAND);
+        break;
+      }
+
+      s_card.in_idle = false;
+      s_queue_r1(0x00U);
+      break;
+    case 55U:
+      s_card.app_command = true;
+      s_queue_r1(s_r1_status());
+      break;
+    case 58U:
+      /* OCR with power up complete and card capacity status set */
+      s_queue_r1(s_r1_status());
+      s_queue_response((uint8_t[]){ 0xC0U, 0xFFU, 0x80U, 0x00U }, 4U);
+      break;
+    default:
+      s_queue_r1(s_r1_status() | SD_SIM_R1_ILLEGAL_COMMAND);
+      break;
+  }
+}
+
+static void s_program_block(void) {
+  uint8_t data_response = SD_SIM_DATA_ACCEPTED;
+
+  if (!s_block_in_range(s_card.block) || pwrite(s_card.image_fd, s_card.data, SD_SIM_BLOCK_SIZE, (off_t)s_card.block * SD_SIM_BLOCK_SIZE) < 0) {
+    data_response = SD_SIM_DATA_WRITE_ERROR;
+  }
+
+  s_card.block++;
+  s_card.response_length = 0U;
+  s_card.response_pos = 0U;
+
+  /* Data response followed by busy until the block is programmed */
+  s_queue_response((uint8_t[]){ data_response, 0x00U, 0x00U }, 3U);
+  s_add_latency(SD_CARD_PROGRAM_LATENCY_US);
+}
+
+static uint8_t s_exchange_byte(uint8_t in) {
+  uint8_t out = 0xFFU;
+
+  if (s_card.response_pos < s_card.response_length) {
+    out = s_card.response[s_card.response_pos++];
+  }
+
+  switch (s_card.state) {
+    case SD_SIM_STATE_IDLE:
+      if ((in & 0xC0U) == 0x40U) {
+        s_card.command[0] = in;
+        s_card.command_length = 1U;
+        s_card.state = SD_SIM_STATE_COMMAND;
+      }
+      break;
+    case SD_SIM_STATE_COMMAND:
+      s_card.command[s_card.command_length++] = in;
+      if (s_card.command_length == SD_SIM_CMD_SIZE) {
+        s_card.state = SD_SIM_STATE_IDLE;
+        s_handle_command();
+      }
+      break;
+    case SD_SIM_STATE_WAIT_TOKEN:
+      if (in == (s_card.multi_block ? SD_SIM_TOKEN_MULTI : SD_SIM_TOKEN_SINGLE)) {
+        s_card.data_length = 0U;
+        s_card.state = SD_SIM_STATE_DATA;
+      } else if (s_card.multi_block && in == SD_SIM_TOKEN_STOP) {
+        s_card.response_length = 0U;
+        s_card.response_pos = 0U;
+        s_queue_response((uint8_t[]){ 0xFFU, 0x00U }, 2U);
+        s_card.state = SD_SIM_STATE_IDLE;
+      }
+      break;
+    case SD_SIM_STATE_DATA:
+      s_card.data[s_card.data_length++] = in;
+      if (s_card.data_length == sizeof(s_card.data)) {
+        s_card.state = s_card.multi_block ? SD_SIM_STATE_WAIT_TOKEN : SD_SIM_STATE_IDLE;
+        s_program_block();
+      }
+      break;
+    default:
+      break;
+  }
+
+  return out;
+}
+
+static void s_clock_bytes(size_t length) {
+  s_add_latency(((uint64_t)length * 8U * 1000000U) / s_card.spi_clock_hz);
+}
+
+static StatusCode s_open_image(void) {
+  if (s_card.image_fd >= 0) {
+    return STATUS_CODE_OK;
+  }
+
+  s_card.image_fd = open(SD_CARD_IMAGE_FILENAME, O_RDWR | O_CREAT, 0644);
+  if (s_card.image_fd < 0) {
+    LOG_DEBUG("Failed to open SD card image %s\n", SD_CARD_IMAGE_FILENAME);
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  /* A new image reads back as zeroes until the card is formatted */
+  struct stat image_stat;
+  off_t image_size = (off_t)SD_CARD_IMAGE_SECTORS * SD_SIM_BLOCK_SIZE;
+  if (fstat(s_card.image_fd, &image_stat) != 0 || (image_stat.st_size < image_size && ftruncate(s_card.image_fd, image_size) != 0)) {
+    close(s_card.image_fd);
+    s_card.image_fd = -1;
+    return STATUS_CODE_INTERNAL_ERROR;
+  }
+
+  return STATUS_CODE_OK;
+}
+
 StatusCode sd_spi_init(SdSpiPort spi, const SdSpiSettings *settings) {
+  if (spi >= NUM_SD_SPI_PORTS || settings == NULL || settings->baudrate >= NUM_SD_SPI_BAUDRATES) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  status_ok_or_return(s_open_image());
+
+  s_card.spi_clock_hz = 312500U << settings->baudrate;
+  s_port[spi].initialized = true;
+
   return STATUS_CODE_OK;
 }
 
 StatusCode sd_spi_tx(SdSpiPort spi, uint8_t *tx_data, size_t tx_len) {
+  if (spi >= NUM_SD_SPI_PORTS || !s_port[spi].initialized || tx_data == NULL || tx_len == 0U) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  for (size_t i = 0U; i < tx_len; i++) {
+    s_exchange_byte(tx_data[i]);
+  }
+  s_clock_bytes(tx_len);
+
   return STATUS_CODE_OK;
 }
 
 StatusCode sd_spi_rx(SdSpiPort spi, uint8_t *rx_data, size_t rx_len, uint8_t placeholder) {
+  if (spi >= NUM_SD_SPI_PORTS || !s_port[spi].initialized || rx_data == NULL || rx_len == 0U) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  for (size_t i = 0U; i < rx_len; i++) {
+    rx_data[i] = s_exchange_byte(placeholder);
+  }
+  s_clock_bytes(rx_len);
+
   return STATUS_CODE_OK;
 }
 
 StatusCode sd_spi_exchange(SdSpiPort spi, uint8_t *tx_data, size_t tx_len, uint8_t *rx_data, size_t rx_len) {
+  if (spi >= NUM_SD_SPI_PORTS || !s_port[spi].initialized || (tx_len == 0U && rx_len == 0U)) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  size_t len = (tx_len > rx_len) ? tx_len : rx_len;
+  for (size_t i = 0U; i < len; i++) {
+    uint8_t rx = s_exchange_byte((i < tx_len) ? tx_data[i] : 0xFFU);
+    if (i < rx_len) {
+      rx_data[i] = rx;
+    }
+  }
+  s_clock_bytes(len);
+
   return STATUS_CODE_OK;
 }
 
@@ -36,9 +373,15 @@ StatusCode sd_spi_cs_set_state(SdSpiPort spi, GpioState state) {
 }
 
 GpioState sd_spi_cs_get_state(SdSpiPort spi) {
-  return STATUS_CODE_OK;
+  return GPIO_STATE_LOW;
 }
 
 StatusCode sd_spi_set_frequency(SdSpiPort spi, SdSpiBaudrate baudrate) {
+  if (spi >= NUM_SD_SPI_PORTS || !s_port[spi].initialized || baudrate >= NUM_SD_SPI_BAUDRATES) {
+    return STATUS_CODE_INVALID_ARGS;
+  }
+
+  s_card.spi_clock_hz = 312500U << baudrate;
+
   return STATUS_CODE_OK;
 }
@@ -20,6 +20,7 @@
 /* Intra-component Headers */
 #include "can_cache.h"
 #include "datagram.h"
+#include "sd_logger.h"
 #include "telemetry.h"
 #include "ws22_motor_can.h"
 #include "xb_transmit.h"
@@ -31,7 +32,7 @@ static TelemetryStorage *s_telemetry_storage = NULL;
 
 static size_t s_sched_idx[NUM_CAN_MSG_PRIORITIES];
 
-/* Written by Task A, snapshot+reset by Task B every second. */
+/* Written by Task A only; Task B diffs it against its previous snapshot every second. */
 static volatile uint32_t s_can_rx_count = 0U;
 
 /* Task B only — no cross-task sync needed. */
@@ -42,70 +43,146 @@ static uint32_t s_xbee_bytes_sent = 0U;
 #define TELEMETRY_STATS_INTERVAL_MS 1000U
 #define WS22_UPDATE_INTERVAL_MS 1000U
 #define XBEE_MAX_BYTES_PER_SEC (230400U / 10U) /* 8N1: 10 bits per byte */
+#define XBEE_TX_BUFFER_SIZE UART_MAX_BUFFER_LEN
+#define XBEE_TX_WAIT_MS 100U
+#define KEYFRAME_INTERVAL_MS 1000U
 
-/* Sends next pending entry from tier; returns bytes transmitted, 0 if none pending.
-   Entries with tx_cooldown_ticks > 0 are skipped until the cooldown has elapsed. */
-static size_t s_try_send_from_tier(CanMessageCache *cache, size_t size, size_t *start_idx) {
-  if (size == 0U) {
-    return 0U;
-  }
+/* Sustained byte rate handed to the XBee; lower it to stay under the RF link rate */
+#ifndef XBEE_TX_RATE_BYTES_PER_SEC
+#define XBEE_TX_RATE_BYTES_PER_SEC XBEE_MAX_BYTES_PER_SEC
+#endif
 
-  uint32_t now = (uint32_t)xTaskGetTickCount();
+/* Task B only — one buffer is packed while the other is on the wire. */
+static uint8_t s_tx_buffers[2U][XBEE_TX_BUFFER_SIZE];
+static uint32_t s_tx_token_millibytes = XBEE_TX_BUFFER_SIZE * 1000U;
+static uint32_t s_tx_token_tick = 0U;
+
+/* An unchanged delta datagram is only its metadata, the shortest datagram that can be packed */
+#define XBEE_TX_MAX_DATAGRAMS (XBEE_TX_BUFFER_SIZE / DATAGRAM_DELTA_METADATA_SIZE)
+
+/* Snapshot packed into the TX buffer, committed to its cache entry once the buffer is handed to the UART */
+typedef struct {
+  CanMessageCache *entry;
+  uint32_t sequence;
+  uint8_t data[8];
+  bool keyframe;
+} XbeePackedEntry;
+
+/* Task B only — entries packed into the buffer that is about to be sent. */
+static XbeePackedEntry s_packed_entries[XBEE_TX_MAX_DATAGRAMS];
+static size_t s_num_packed_entries = 0U;
+
+/* Packs pending entries of one tier round-robin into buffer; returns bytes packed.
+   Entries with tx_cooldown_ticks > 0 are skipped until the cooldown has elapsed.
+   Packing stops at the first pending entry that does not fit so it leads the next buffer.
+   Entries stay pending until s_commit_packed_entries() runs for the buffer. */
+static size_t s_pack_from_tier(CanMessageCache *cache, size_t size, size_t *start_idx, uint8_t *buffer, size_t space, uint32_t now) {
+  size_t packed = 0U;
 
   for (size_t checked = 0U; checked < size; checked++) {
     size_t i = (*start_idx + checked) % size;
 
-    bool was_pending = false;
-    uint32_t saved_id = 0U;
-    uint8_t saved_dlc = 0U;
-    uint8_t saved_data[8] = { 0 };
+    if (cache[i].tx_cooldown_ticks > 0U && (now - cache[i].last_tx_tick) < cache[i].tx_cooldown_ticks) {
+      continue; /* cooldown not elapsed — skip, leave pending */
+    }
 
-    taskENTER_CRITICAL();
-    if (cache[i].pending) {
-      if (cache[i].tx_cooldown_ticks > 0U && (now - cache[i].last_tx_tick) < cache[i].tx_cooldown_ticks) {
-        taskEXIT_CRITICAL();
-        continue; /* cooldown not elapsed — skip, leave pending */
-      }
-      was_pending = true;
-      saved_id = cache[i].can_id;
-      saved_dlc = cache[i].length;
-      memcpy(saved_data, cache[i].data, sizeof(saved_data));
-      cache[i].pending = false;
-      cache[i].last_tx_tick = now;
+    if (s_num_packed_entries >= XBEE_TX_MAX_DATAGRAMS) {
+      *start_idx = i;
+      return packed;
+    }
+
+    XbeePackedEntry *packed_entry = &s_packed_entries[s_num_packed_entries];
+
+    if (!can_cache_read_pending(&cache[i], packed_entry->data, &packed_entry->sequence)) {
+      continue;
     }
-    taskEXIT_CRITICAL();
 
-    if (was_pending) {
-      *start_idx = (i + 1U) % size;
+    /* A full datagram doubles as the keyframe the receiver resyncs its delta reference from */
+    bool keyframe_due = (cache[i].tx_sequence == 0U) || ((now - cache[i].last_keyframe_tick) >= pdMS_TO_TICKS(KEYFRAME_INTERVAL_MS));
+    packed_entry->keyframe = !s_telemetry_storage->config->compressed_stream || keyframe_due;
+
+    uint8_t datagram[sizeof(Datagram)];
+    size_t datagram_length = 0U;
+
+    if (!packed_entry->keyframe) {
+      if (encode_delta_datagram(datagram, &datagram_length, cache[i].can_id, cache[i].length, packed_entry->data, cache[i].tx_reference) != STATUS_CODE_OK) {
+        continue;
+      }
+    } else {
       Datagram tx_datagram = { 0 };
-      if (encode_datagram(&tx_datagram, saved_id, saved_dlc, saved_data) == STATUS_CODE_OK) {
-        size_t datagram_length = saved_dlc + DATAGRAM_METADATA_SIZE;
-        uart_tx(s_telemetry_storage->config->uart_port, (uint8_t *)&tx_datagram, datagram_length);
-        return datagram_length;
+      if (encode_datagram(&tx_datagram, cache[i].can_id, cache[i].length, packed_entry->data) != STATUS_CODE_OK) {
+        continue;
       }
+      datagram_length = cache[i].length + DATAGRAM_METADATA_SIZE;
+      memcpy(datagram, &tx_datagram, datagram_length);
+    }
+
+    if (packed + datagram_length > space) {
+      *start_idx = i;
+      return packed;
+    }
+
+    memcpy(&buffer[packed], datagram, datagram_length);
+    packed += datagram_length;
+
+    packed_entry->entry = &cache[i];
+    s_num_packed_entries++;
+    *start_idx = (i + 1U) % size;
+  }
+
+  return packed;
+}
+
+/* Marks the entries of a buffer the UART accepted as transmitted; a dropped buffer leaves them pending. */
+static void s_commit_packed_entries(uint32_t now) {
+  for (size_t i = 0U; i < s_num_packed_entries; i++) {
+    XbeePackedEntry *packed_entry = &s_packed_entries[i];
+    CanMessageCache *entry = packed_entry->entry;
+
+    memcpy(entry->tx_reference, packed_entry->data, entry->length);
+    if (packed_entry->keyframe) {
+      entry->last_keyframe_tick = now;
+    }
+    can_cache_mark_transmitted(entry, packed_entry->sequence, now);
+  }
+
+  s_xbee_tx_count += (uint32_t)s_num_packed_entries;
+}
+
+/* Fills buffer HIGH→MEDIUM→LOW with up to budget bytes of datagrams; returns bytes packed. */
+static size_t s_pack_datagrams(uint8_t *buffer, size_t budget, uint32_t now) {
+  size_t packed = 0U;
+  s_num_packed_entries = 0U;
+
+  for (int p = 0; p < NUM_CAN_MSG_PRIORITIES; p++) {
+    packed += s_pack_from_tier(g_can_cache_tiers[p], g_can_cache_tier_sizes[p], &s_sched_idx[p], &buffer[packed], budget - packed, now);
+  }
+
+  return packed;
+}
+
+/* Refills the byte budget at XBEE_TX_RATE_BYTES_PER_SEC, capped to one buffer of burst. */
+static void s_refill_tx_tokens(uint32_t now) {
+  uint32_t elapsed_ms = (now - s_tx_token_tick) * portTICK_PERIOD_MS;
+  s_tx_token_tick = now;
+
+  /* Bytes per second times milliseconds gives thousandths of a byte */
+  uint32_t max_millibytes = XBEE_TX_BUFFER_SIZE * 1000U;
+  if (elapsed_ms >= max_millibytes / XBEE_TX_RATE_BYTES_PER_SEC) {
+    s_tx_token_millibytes = max_millibytes;
+  } else {
+    s_tx_token_millibytes += elapsed_ms * XBEE_TX_RATE_BYTES_PER_SEC;
+    if (s_tx_token_millibytes > max_millibytes) {
+      s_tx_token_millibytes = max_millibytes;
     }
   }
-  return 0U;
 }
 
 #if TELEMETRY_ENABLE_WS22
 static void s_update_ws22_entry(uint32_t can_id, const uint8_t *data) {
-  uint32_t now = (uint32_t)xTaskGetTickCount();
-  for (size_t i = 0U; i < g_can_cache_low_size; i++) {
-    if (g_can_cache_low[i].can_id == can_id) {
-      taskENTER_CRITICAL();
-      bool data_changed = (memcmp(g_can_cache_low[i].data, data, WS22_TELEMETRY_DLC) != 0);
-      bool heartbeat_due = ((now - g_can_cache_low[i].last_tx_tick) >= CACHE_HEARTBEAT_MS);
-      if (data_changed) {
-        memcpy(g_can_cache_low[i].data, data, WS22_TELEMETRY_DLC);
-      }
-      if (data_changed || heartbeat_due) {
-        g_can_cache_low[i].pending = true;
-      }
-      g_can_cache_low[i].last_updated_tick = now;
-      taskEXIT_CRITICAL();
-      return;
-    }
+  CanMessageCache *entry = can_cache_lookup(can_id);
+  if (entry != NULL) {
+    can_cache_update(entry, data, (uint32_t)xTaskGetTickCount(), CACHE_HEARTBEAT_MS);
   }
 }
 
@@ -171,31 +248,26 @@ static void s_update_stats_cache(uint16_t can_rx_rate, uint16_t xbee_tx_rate, ui
   stats[4] = xbee_load_pct;
   stats[5] = 0U;
 
-  size_t low_size = g_can_cache_low_size;
-  for (size_t i = 0U; i < low_size; i++) {
-    if (g_can_cache_low[i].can_id == TELEMETRY_STATS_CAN_ID) {
-      taskENTER_CRITICAL();
-      memcpy(g_can_cache_low[i].data, stats, TELEMETRY_STATS_DLC);
-      g_can_cache_low[i].pending = true;
-      taskEXIT_CRITICAL();
-      break;
-    }
+  /* Stats are sent every interval, even when unchanged */
+  CanMessageCache *entry = can_cache_lookup(TELEMETRY_STATS_CAN_ID);
+  if (entry != NULL) {
+    can_cache_update(entry, stats, (uint32_t)xTaskGetTickCount(), 0U);
   }
 }
 
 /* Task A: drains CAN RX queue into the message cache. */
 TASK(can_cache_updater, TASK_STACK_512) {
-  CanMessageCache *caches[] = { g_can_cache_high, g_can_cache_medium, g_can_cache_low };
-  const size_t sizes[] = { g_can_cache_high_size, g_can_cache_medium_size, g_can_cache_low_size };
   CanMessage message = { 0 };
 
   while (true) {
     while (queue_receive(&s_telemetry_storage->can_storage->rx_queue.queue, &message, QUEUE_DELAY_BLOCKING) != STATUS_CODE_OK) {
     }
 
-    taskENTER_CRITICAL();
-    s_can_rx_count++;
-    taskEXIT_CRITICAL();
+    /* Single writer, the scheduler only reads the counter */
+    s_can_rx_count = s_can_rx_count + 1U;
+
+    /* Only copies into RAM, dropped frames are counted by the logger */
+    sd_logger_log_can(&message);
 
     bool is_ws22 = IS_WS22_CAN_ID(message.id.raw);
 
@@ -204,59 +276,51 @@ TASK(can_cache_updater, TASK_STACK_512) {
       ws22_motor_can_process_rx(message.data_u8, message.id.raw, 8U);
 #endif
     } else {
-      uint32_t now = (uint32_t)xTaskGetTickCount();
-      for (int p = 0; p < NUM_CAN_MSG_PRIORITIES; p++) {
-        bool matched = false;
-        for (size_t i = 0U; i < sizes[p]; i++) {
-          if (caches[p][i].can_id == message.id.raw) {
-            taskENTER_CRITICAL();
-            caches[p][i].last_updated_tick = now;
-            bool data_changed = (memcmp(caches[p][i].data, message.data_u8, caches[p][i].length) != 0);
-            bool heartbeat_due = ((now - caches[p][i].last_tx_tick) >= CACHE_HEARTBEAT_MS);
-            if (data_changed) {
-              memcpy(caches[p][i].data, message.data_u8, sizeof(caches[p][i].data));
-            }
-            if (data_changed || heartbeat_due) {
-              caches[p][i].pending = true;
-            }
-            taskEXIT_CRITICAL();
-            matched = true;
-            break;
-          }
-        }
-
-        if (matched) {
-          break;
-        }
+      CanMessageCache *entry = can_cache_lookup(message.id.raw);
+      if (entry != NULL) {
+        can_cache_update(entry, message.data_u8, (uint32_t)xTaskGetTickCount(), CACHE_HEARTBEAT_MS);
       }
     }
   }
 }
 
-/* Task B: round-robin HIGH→MEDIUM→LOW scheduler; updates bus-load stats cache every second. */
+/* Task B: packs HIGH→MEDIUM→LOW into alternating TX buffers; updates bus-load stats cache every second. */
 TASK(can_cache_scheduler, TASK_STACK_512) {
-  CanMessageCache *caches[] = { g_can_cache_high, g_can_cache_medium, g_can_cache_low };
-  const size_t sizes[] = { g_can_cache_high_size, g_can_cache_medium_size, g_can_cache_low_size };
+  uint32_t last_rx_count = s_can_rx_count;
   uint32_t last_stats_tick = (uint32_t)xTaskGetTickCount();
   uint32_t last_ws22_tick = (uint32_t)xTaskGetTickCount();
 
+  UartPort uart_port = s_telemetry_storage->config->uart_port;
+  size_t active_buffer = 0U;
+  s_tx_token_tick = (uint32_t)xTaskGetTickCount();
+
   while (true) {
-    for (int p = 0; p < NUM_CAN_MSG_PRIORITIES; p++) {
-      size_t bytes = s_try_send_from_tier(caches[p], sizes[p], &s_sched_idx[p]);
-      if (bytes > 0U) {
-        s_xbee_tx_count++;
-        s_xbee_bytes_sent += (uint32_t)bytes;
-        break;
+    s_refill_tx_tokens((uint32_t)xTaskGetTickCount());
+
+    size_t budget = s_tx_token_millibytes / 1000U;
+    uint32_t pack_tick = (uint32_t)xTaskGetTickCount();
+    size_t packed = s_pack_datagrams(s_tx_buffers[active_buffer], (budget < XBEE_TX_BUFFER_SIZE) ? budget : XBEE_TX_BUFFER_SIZE, pack_tick);
+
+    if (packed > 0U) {
+      /* The other buffer was packed last pass, wait for it to leave before handing over this one */
+      uart_tx_wait(uart_port, XBEE_TX_WAIT_MS);
+
+      if (uart_tx_async(uart_port, s_tx_buffers[active_buffer], packed) == STATUS_CODE_OK) {
+        s_commit_packed_entries(pack_tick);
+        s_xbee_bytes_sent += (uint32_t)packed;
+        s_tx_token_millibytes -= (uint32_t)packed * 1000U;
+        active_buffer ^= 1U;
+      } else {
+        /* The entries were never marked transmitted and used no tokens, so they are packed again on the next pass */
+        LOG_DEBUG("XBee TX failed, retrying %u bytes\r\n", (unsigned int)packed);
       }
     }
 
     uint32_t now = (uint32_t)xTaskGetTickCount();
     if ((now - last_stats_tick) >= TELEMETRY_STATS_INTERVAL_MS) {
-      uint32_t rx_snapshot;
-      taskENTER_CRITICAL();
-      rx_snapshot = s_can_rx_count;
-      s_can_rx_count = 0U;
-      taskEXIT_CRITICAL();
+      uint32_t rx_count = s_can_rx_count;
+      uint32_t rx_snapshot = rx_count - last_rx_count;
+      last_rx_count = rx_count;
 
       uint8_t load_pct = (uint8_t)((s_xbee_bytes_sent * 100U) / XBEE_MAX_BYTES_PER_SEC);
       s_update_stats_cache((uint16_t)rx_snapshot, (uint16_t)s_xbee_tx_count, load_pct);
@@ -272,16 +336,16 @@ TASK(can_cache_scheduler, TASK_STACK_512) {
     }
 #endif
 
-    /* 1ms gap prevents HAL semaphore desync at 230400 baud. */
-    vTaskDelay(pdMS_TO_TICKS(1));
+    /* Sleep only when nothing was pending or the byte budget ran out */
+    if (packed == 0U) {
+      vTaskDelay(pdMS_TO_TICKS(1));
+    }
   }
 }
 
 #if (LOG_DEBUG_SUMMARY == 1)
 /* Task C: logs all pending cache entries once per second (debug only). */
 TASK(can_cache_summary, TASK_STACK_512) {
-  CanMessageCache *caches[] = { g_can_cache_high, g_can_cache_medium, g_can_cache_low };
-  const size_t sizes[] = { g_can_cache_high_size, g_can_cache_medium_size, g_can_cache_low_size };
   static const char *prio_str[] = { "HIGH  ", "MEDIUM", "LOW   " };
 
   while (true) {
@@ -290,16 +354,13 @@ TASK(can_cache_summary, TASK_STACK_512) {
     LOG_DEBUG("=== CAN cache entries ===\r\n");
     uint32_t pending_count = 0U;
     for (int p = 0; p < NUM_CAN_MSG_PRIORITIES; p++) {
-      for (size_t i = 0U; i < sizes[p]; i++) {
-        bool is_pending;
-        uint32_t last_tick;
-        taskENTER_CRITICAL();
-        is_pending = caches[p][i].pending;
-        last_tick = caches[p][i].last_updated_tick;
-        taskEXIT_CRITICAL();
+      CanMessageCache *cache = g_can_cache_tiers[p];
+      for (size_t i = 0U; i < g_can_cache_tier_sizes[p]; i++) {
+        bool is_pending = can_cache_is_pending(&cache[i]);
+        uint32_t last_tick = cache[i].last_updated_tick;
         if (last_tick == 0U) continue;
         if (is_pending) pending_count++;
-        LOG_DEBUG("  ID=%-4u [%s] pending=%c last=%ums\r\n", caches[p][i].can_id, prio_str[p], is_pending ? 'Y' : 'N', now - last_tick);
+        LOG_DEBUG("  ID=%-4u [%s] pending=%c last=%ums\r\n", cache[i].can_id, prio_str[p], is_pending ? 'Y' : 'N', now - last_tick);
       }
     }
     LOG_DEBUG("  total pending: %u\r\n", pending_count);
@@ -0,0 +1,82 @@
+/************************************************************************************************
+ * @file   test_datagram.c
+ *
+ * @brief  Test file for the telemetry datagram encoders
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <stdint.h>
+#include <string.h>
+
+/* Inter-component Headers */
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "datagram.h"
+
+/* Same ID and payload as scripts/test_telemetry_decoder.py, so both ends are checked against one stream */
+#define TEST_CAN_ID 0x1C5U
+#define TEST_DLC 8U
+
+static const uint8_t s_test_data[TEST_DLC] = { 0x10U, 0x20U, 0x30U, 0x40U, 0x50U, 0x60U, 0x70U, 0x80U };
+
+void setup_test(void) {}
+
+void teardown_test(void) {}
+
+void test_full_datagram(void) {
+  const uint8_t expected[] = { 0xAAU, 0x01U, 0xC5U, 0x08U, 0x10U, 0x20U, 0x30U, 0x40U, 0x50U, 0x60U, 0x70U, 0x80U, 0xBBU };
+  Datagram datagram = { 0 };
+
+  TEST_ASSERT_OK(encode_datagram(&datagram, TEST_CAN_ID, TEST_DLC, s_test_data));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, (uint8_t *)&datagram, TEST_DLC + DATAGRAM_METADATA_SIZE);
+}
+
+void test_delta_datagram_sends_changed_bytes(void) {
+  const uint8_t changed[TEST_DLC] = { 0x10U, 0x21U, 0x30U, 0x40U, 0x50U, 0x60U, 0x70U, 0x00U };
+  /* DLC 8 and ID 0x1C5 give header 0x41C5, bytes 1 and 7 changed */
+  const uint8_t expected[] = { 0xADU, 0x41U, 0xC5U, 0x82U, 0x01U, 0x80U, 0xBBU };
+  uint8_t buffer[TEST_DLC + DATAGRAM_DELTA_METADATA_SIZE];
+  size_t length = 0U;
+
+  TEST_ASSERT_OK(encode_delta_datagram(buffer, &length, TEST_CAN_ID, TEST_DLC, changed, s_test_data));
+  TEST_ASSERT_EQUAL(sizeof(expected), length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, length);
+}
+
+void test_delta_datagram_unchanged_is_metadata_only(void) {
+  const uint8_t expected[] = { 0xADU, 0x41U, 0xC5U, 0x00U, 0xBBU };
+  uint8_t buffer[TEST_DLC + DATAGRAM_DELTA_METADATA_SIZE];
+  size_t length = 0U;
+
+  TEST_ASSERT_OK(encode_delta_datagram(buffer, &length, TEST_CAN_ID, TEST_DLC, s_test_data, s_test_data));
+  TEST_ASSERT_EQUAL(DATAGRAM_DELTA_METADATA_SIZE, length);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, length);
+}
+
+void test_delta_datagram_all_changed(void) {
+  const uint8_t reference[TEST_DLC] = { 0 };
+  uint8_t buffer[TEST_DLC + DATAGRAM_DELTA_METADATA_SIZE];
+  size_t length = 0U;
+
+  /* A delta against zeros carries the payload itself and is the same length as a full datagram */
+  TEST_ASSERT_OK(encode_delta_datagram(buffer, &length, TEST_CAN_ID, TEST_DLC, s_test_data, reference));
+  TEST_ASSERT_EQUAL(TEST_DLC + DATAGRAM_DELTA_METADATA_SIZE, length);
+  TEST_ASSERT_EQUAL_HEX8(0xFFU, buffer[3]);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_test_data, &buffer[4], TEST_DLC);
+  TEST_ASSERT_EQUAL_HEX8(DATAGRAM_END_FRAME, buffer[length - 1U]);
+}
+
+void test_delta_datagram_invalid_args(void) {
+  uint8_t buffer[TEST_DLC + DATAGRAM_DELTA_METADATA_SIZE];
+  size_t length = 0U;
+
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, encode_delta_datagram(buffer, &length, 0x800U, TEST_DLC, s_test_data, s_test_data));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, encode_delta_datagram(buffer, &length, TEST_CAN_ID, 9U, s_test_data, s_test_data));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, encode_delta_datagram(NULL, &length, TEST_CAN_ID, TEST_DLC, s_test_data, s_test_data));
+  TEST_ASSERT_EQUAL(STATUS_CODE_INVALID_ARGS, encode_delta_datagram(buffer, &length, TEST_CAN_ID, TEST_DLC, s_test_data, NULL));
+}
@@ -0,0 +1,148 @@
+/************************************************************************************************
+ * @file   test_sd_card_spi.c
+ *
+ * @brief  Test file for the x86 SDHC card emulator
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Inter-component Headers */
+#include "FreeRTOS.h"
+#include "diskio.h"
+#include "task.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "sd_card_interface.h"
+#include "sd_card_spi.h"
+
+/* Image file and size used by the x86 SD card emulator */
+#define TEST_SD_IMAGE_FILENAME "Midsun_x86_sd_card"
+#define TEST_SD_IMAGE_SECTORS 131072U
+
+#define TEST_SD_PORT SD_SPI_PORT_2
+#define TEST_SD_DRIVE 0U
+#define TEST_SD_SECTOR_SIZE 512U
+#define TEST_SD_NUM_SECTORS 16U
+#define TEST_SD_START_SECTOR 1000U
+
+/* Clocking the data alone at 2.5 MHz plus 250 us of programming per block, the driver's overhead comes on top */
+#define TEST_SD_MIN_WRITE_US (TEST_SD_NUM_SECTORS * ((TEST_SD_SECTOR_SIZE * 8U * 1000000U) / 2500000U + 250U))
+
+static SdSpiSettings s_settings = { .baudrate = SD_SPI_BAUDRATE_2_5MHZ, .mode = SD_SPI_MODE_0 };
+
+static uint8_t s_write_data[TEST_SD_NUM_SECTORS * TEST_SD_SECTOR_SIZE];
+static uint8_t s_read_data[TEST_SD_NUM_SECTORS * TEST_SD_SECTOR_SIZE];
+
+/* Sends a command frame and returns the first response byte that is not 0xFF */
+static uint8_t s_send_command(uint8_t index, uint32_t arg) {
+  uint8_t frame[6U] = { 0x40U | index, (uint8_t)(arg >> 24U), (uint8_t)(arg >> 16U), (uint8_t)(arg >> 8U), (uint8_t)arg, 0x95U };
+  uint8_t r1 = 0xFFU;
+
+  sd_spi_tx(TEST_SD_PORT, frame, sizeof(frame));
+  for (uint8_t i = 0U; i < 8U && r1 == 0xFFU; i++) {
+    sd_spi_rx(TEST_SD_PORT, &r1, 1U, 0xFFU);
+  }
+
+  return r1;
+}
+
+void setup_test(void) {
+  static bool s_linked = false;
+
+  if (!s_linked) {
+    /* Start every run from a blank card */
+    unlink(TEST_SD_IMAGE_FILENAME);
+    sd_card_link_driver(TEST_SD_PORT, &s_settings);
+    s_linked = true;
+  }
+
+  for (size_t i = 0U; i < sizeof(s_write_data); i++) {
+    s_write_data[i] = (uint8_t)((i * 7U) ^ (i / TEST_SD_SECTOR_SIZE));
+  }
+  memset(s_read_data, 0U, sizeof(s_read_data));
+}
+
+void teardown_test(void) {}
+
+TEST_IN_TASK
+void test_sd_card_spi_initializes_as_sdhc(void) {
+  uint8_t response[4U] = { 0U };
+
+  TEST_ASSERT_OK(sd_spi_init(TEST_SD_PORT, &s_settings));
+
+  TEST_ASSERT_EQUAL_HEX8(0x01U, s_send_command(0U, 0U));
+
+  /* CMD8 echoes the voltage range and check pattern */
+  TEST_ASSERT_EQUAL_HEX8(0x01U, s_send_command(8U, 0x1AAU));
+  TEST_ASSERT_OK(sd_spi_rx(TEST_SD_PORT, response, sizeof(response), 0xFFU));
+  TEST_ASSERT_EQUAL_HEX8(0x01U, response[2U]);
+  TEST_ASSERT_EQUAL_HEX8(0xAAU, response[3U]);
+
+  /* ACMD41 is only accepted after CMD55 */
+  TEST_ASSERT_EQUAL_HEX8(0x05U, s_send_command(41U, 0x40000000U));
+  TEST_ASSERT_EQUAL_HEX8(0x01U, s_send_command(55U, 0U));
+  TEST_ASSERT_EQUAL_HEX8(0x00U, s_send_command(41U, 0x40000000U));
+
+  /* The OCR reports power up complete and card capacity status, so the driver uses block addresses */
+  TEST_ASSERT_EQUAL_HEX8(0x00U, s_send_command(58U, 0U));
+  TEST_ASSERT_OK(sd_spi_rx(TEST_SD_PORT, response, sizeof(response), 0xFFU));
+  TEST_ASSERT_EQUAL_HEX8(0xC0U, response[0U] & 0xC0U);
+}
+
+TEST_IN_TASK
+void test_sd_card_spi_multi_block_write_reads_back(void) {
+  uint8_t image_data[TEST_SD_NUM_SECTORS * TEST_SD_SECTOR_SIZE];
+
+  TEST_ASSERT_EQUAL(0U, disk_initialize(TEST_SD_DRIVE));
+  TEST_ASSERT_EQUAL(RES_OK, disk_write(TEST_SD_DRIVE, s_write_data, TEST_SD_START_SECTOR, TEST_SD_NUM_SECTORS));
+  TEST_ASSERT_EQUAL(RES_OK, disk_read(TEST_SD_DRIVE, s_read_data, TEST_SD_START_SECTOR, TEST_SD_NUM_SECTORS));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_write_data, s_read_data, sizeof(s_write_data));
+
+  /* Blocks land at their sector in the image, not at a byte address */
+  int image_fd = open(TEST_SD_IMAGE_FILENAME, O_RDONLY);
+  TEST_ASSERT_TRUE(image_fd >= 0);
+  ssize_t image_read = pread(image_fd, image_data, sizeof(image_data), (off_t)TEST_SD_START_SECTOR * TEST_SD_SECTOR_SIZE);
+  close(image_fd);
+
+  TEST_ASSERT_EQUAL(sizeof(image_data), image_read);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_write_data, image_data, sizeof(image_data));
+}
+
+TEST_IN_TASK
+void test_sd_card_spi_capacity_and_address_range(void) {
+  DWORD sector_count = 0U;
+
+  TEST_ASSERT_EQUAL(0U, disk_initialize(TEST_SD_DRIVE));
+  TEST_ASSERT_EQUAL(RES_OK, disk_ioctl(TEST_SD_DRIVE, GET_SECTOR_COUNT, &sector_count));
+  TEST_ASSERT_EQUAL_UINT32(TEST_SD_IMAGE_SECTORS, sector_count);
+
+  TEST_ASSERT_EQUAL(RES_ERROR, disk_write(TEST_SD_DRIVE, s_write_data, TEST_SD_IMAGE_SECTORS, 1U));
+  TEST_ASSERT_EQUAL(RES_ERROR, disk_read(TEST_SD_DRIVE, s_read_data, TEST_SD_IMAGE_SECTORS, 1U));
+
+  /* The card keeps working after rejecting an address */
+  TEST_ASSERT_EQUAL(RES_OK, disk_write(TEST_SD_DRIVE, s_write_data, TEST_SD_IMAGE_SECTORS - 1U, 1U));
+  TEST_ASSERT_EQUAL(RES_OK, disk_read(TEST_SD_DRIVE, s_read_data, TEST_SD_IMAGE_SECTORS - 1U, 1U));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_write_data, s_read_data, TEST_SD_SECTOR_SIZE);
+}
+
+TEST_IN_TASK
+void test_sd_card_spi_write_takes_simulated_time(void) {
+  TEST_ASSERT_EQUAL(0U, disk_initialize(TEST_SD_DRIVE));
+
+  TickType_t start_tick = xTaskGetTickCount();
+  TEST_ASSERT_EQUAL(RES_OK, disk_write(TEST_SD_DRIVE, s_write_data, TEST_SD_START_SECTOR, TEST_SD_NUM_SECTORS));
+  TickType_t write_ticks = xTaskGetTickCount() - start_tick;
+
+  /* Simulated time is waited in whole ticks and the remainder carries over, so at most one tick is still pending */
+  TEST_ASSERT_GREATER_OR_EQUAL(pdMS_TO_TICKS(TEST_SD_MIN_WRITE_US / 1000U) - 1U, write_ticks);
+}
@@ -0,0 +1,231 @@
+/************************************************************************************************
+ * @file   test_sd_logger.c
+ *
+ * @brief  Test file for the SD card CAN logger, running against the x86 SDHC card emulator
+ *
+ * @date   2026-10-17
+ * @author Midnight Sun Team #24 - MSXVI
+ ************************************************************************************************/
+
+/* Standard library Headers */
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Inter-component Headers */
+#include "FreeRTOS.h"
+#include "ff.h"
+#include "log.h"
+#include "task.h"
+#include "test_helpers.h"
+#include "unity.h"
+
+/* Intra-component Headers */
+#include "sd_card_interface.h"
+#include "sd_card_spi.h"
+#include "sd_logger.h"
+#include "telemetry.h"
+
+/* Image file used by the x86 SD card emulator */
+#define TEST_SD_IMAGE_FILENAME "Midsun_x86_sd_card"
+
+#define TEST_LOGGER_TIMEOUT_MS 10000U
+#define TEST_LOGGER_POLL_PERIOD_MS 10U
+
+#define TEST_CAN_ID 0x1C5U
+
+/* A saturated 1 Mbit/s bus carries about 8 standard frames with 8 data bytes each millisecond */
+#define TEST_LOAD_FRAMES_PER_MS 8U
+#define TEST_LOAD_DURATION_MS 500U
+#define TEST_LOAD_FRAMES (TEST_LOAD_FRAMES_PER_MS * TEST_LOAD_DURATION_MS)
+
+/* Number of upcoming card writes that fail as if the card was pulled */
+static uint32_t s_failed_writes = 0U;
+
+FRESULT __real_f_write(FIL *fp, const void *buff, UINT btw, UINT *bw);
+
+FRESULT TEST_MOCK(f_write)(FIL *fp, const void *buff, UINT btw, UINT *bw) {
+  if (s_failed_writes > 0U) {
+    s_failed_writes--;
+    *bw = 0U;
+    return FR_DISK_ERR;
+  }
+  return __real_f_write(fp, buff, btw, bw);
+}
+
+static SdSpiSettings s_settings = { .baudrate = SD_SPI_BAUDRATE_2_5MHZ, .mode = SD_SPI_MODE_0 };
+static TelemetryStorage s_storage;
+
+static CanMessage s_message = {
+  .id = { .raw = TEST_CAN_ID },
+  .dlc = 8U,
+  .data_u8 = { 0x10U, 0x20U, 0x30U, 0x40U, 0x50U, 0x60U, 0x70U, 0x80U },
+};
+
+/* Starts the logger and logs the first message once the card is mounted */
+static void s_start_logger(void) {
+  static bool s_started = false;
+
+  if (!s_started) {
+    TEST_ASSERT_OK(sd_logger_init(&s_storage));
+    s_started = true;
+  }
+
+  StatusCode status = STATUS_CODE_UNINITIALIZED;
+  for (uint32_t waited_ms = 0U; status == STATUS_CODE_UNINITIALIZED && waited_ms < TEST_LOGGER_TIMEOUT_MS; waited_ms += TEST_LOGGER_POLL_PERIOD_MS) {
+    status = sd_logger_log_can(&s_message);
+    if (status == STATUS_CODE_UNINITIALIZED) {
+      vTaskDelay(pdMS_TO_TICKS(TEST_LOGGER_POLL_PERIOD_MS));
+    }
+  }
+
+  TEST_ASSERT_OK(status);
+}
+
+/* Waits until at least bytes_written bytes are on the card, returns false on timeout */
+static bool s_wait_for_bytes_written(uint32_t bytes_written) {
+  SdLoggerStats stats;
+
+  for (uint32_t waited_ms = 0U; waited_ms < TEST_LOGGER_TIMEOUT_MS; waited_ms += TEST_LOGGER_POLL_PERIOD_MS) {
+    sd_logger_get_stats(&stats);
+    if (stats.bytes_written >= bytes_written) {
+      return true;
+    }
+    vTaskDelay(pdMS_TO_TICKS(TEST_LOGGER_POLL_PERIOD_MS));
+  }
+
+  return false;
+}
+
+/* Finds the first record on the card image matching the test message, and checks it is followed by padding */
+static bool s_find_padded_record(uint8_t sequence) {
+  SdLogRecord record = { .id = TEST_CAN_ID, .dlc = s_message.dlc, .sequence = sequence };
+  memcpy(record.data, s_message.data_u8, sizeof(record.data));
+
+  int image_fd = open(TEST_SD_IMAGE_FILENAME, O_RDONLY);
+  struct stat image_stat;
+  if (image_fd < 0 || fstat(image_fd, &image_stat) != 0) {
+    return false;
+  }
+
+  uint8_t *image = mmap(NULL, (size_t)image_stat.st_size, PROT_READ, MAP_SHARED, image_fd, 0);
+  close(image_fd);
+  if (image == MAP_FAILED) {
+    return false;
+  }
+
+  /* The tick is not known exactly, so match everything after it */
+  size_t match_offset = offsetof(SdLogRecord, id);
+  uint8_t *match = memmem(image, (size_t)image_stat.st_size, (uint8_t *)&record + match_offset, sizeof(record) - match_offset);
+
+  uint8_t padding[sizeof(SdLogRecord)];
+  memset(padding, 0xFF, sizeof(padding));
+
+  bool found = (match != NULL) && (memcmp(match + sizeof(record) - match_offset, padding, sizeof(padding)) == 0);
+  munmap(image, (size_t)image_stat.st_size);
+
+  return found;
+}
+
+void setup_test(void) {
+  static bool s_linked = false;
+
+  if (!s_linked) {
+    /* Start every run from a blank card, the logger formats it on mount */
+    unlink(TEST_SD_IMAGE_FILENAME);
+    sd_card_link_driver(SD_SPI_PORT_2, &s_settings);
+    s_linked = true;
+  }
+}
+
+void teardown_test(void) {}
+
+TEST_IN_TASK
+void test_sd_logger_flushes_quiet_bus_within_period(void) {
+  SdLoggerStats stats;
+
+  s_start_logger();
+  TickType_t logged_tick = xTaskGetTickCount();
+
+  /* A single message is held back until its buffer is one flush period old */
+  vTaskDelay(pdMS_TO_TICKS(SD_LOGGER_FLUSH_PERIOD_MS / 2U));
+  sd_logger_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.bytes_written);
+
+  /* No further messages arrive, the flush task hands the buffer over by itself */
+  TEST_ASSERT_TRUE(s_wait_for_bytes_written(SD_LOGGER_BUFFER_SIZE));
+  TickType_t latency_ticks = xTaskGetTickCount() - logged_tick;
+  LOG_DEBUG("Quiet bus flush latency: %u ms\n", (unsigned int)(latency_ticks * portTICK_PERIOD_MS));
+
+  sd_logger_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(1U, stats.frames_logged);
+  TEST_ASSERT_EQUAL_UINT32(SD_LOGGER_BUFFER_SIZE, stats.bytes_written);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.write_errors);
+
+  /* The message reaches the card as the only record in its buffer */
+  TEST_ASSERT_TRUE(s_find_padded_record(0U));
+}
+
+TEST_IN_TASK
+void test_sd_logger_keeps_up_with_full_bus_load(void) {
+  SdLoggerStats start_stats;
+  SdLoggerStats stats;
+
+  s_start_logger();
+  sd_logger_get_stats(&start_stats);
+
+  /* The emulated card and the message load both run in simulated ticks, so this does not depend on the host speed */
+  for (uint32_t ms = 0U; ms < TEST_LOAD_DURATION_MS; ms++) {
+    for (uint32_t i = 0U; i < TEST_LOAD_FRAMES_PER_MS; i++) {
+      s_message.data_u8[0] = (uint8_t)i;
+      TEST_ASSERT_OK(sd_logger_log_can(&s_message));
+    }
+    vTaskDelay(1U);
+  }
+
+  /* Every buffer filled during the load, and the partial one after it goes stale, reaches the card. The
+     message logged on start opened the first of them */
+  uint32_t load_bytes = (TEST_LOAD_FRAMES + 1U) * sizeof(SdLogRecord);
+  uint32_t load_buffers = (load_bytes + SD_LOGGER_BUFFER_SIZE - 1U) / SD_LOGGER_BUFFER_SIZE;
+  TEST_ASSERT_TRUE(s_wait_for_bytes_written(start_stats.bytes_written + load_buffers * SD_LOGGER_BUFFER_SIZE));
+
+  sd_logger_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(start_stats.frames_logged + TEST_LOAD_FRAMES, stats.frames_logged);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.frames_dropped);
+  TEST_ASSERT_EQUAL_UINT32(0U, stats.write_errors);
+
+  uint32_t write_bytes = stats.bytes_written - start_stats.bytes_written;
+  uint32_t write_ticks = stats.total_write_ticks - start_stats.total_write_ticks;
+  LOG_DEBUG("Logged %u bytes in %u ms of card writes (%u KiB/s), worst buffer write %u ms\n", (unsigned int)write_bytes, (unsigned int)(write_ticks * portTICK_PERIOD_MS),
+         (unsigned int)((write_ticks > 0U) ? (write_bytes / write_ticks) * 1000U / 1024U : 0U), (unsigned int)(stats.max_write_ticks * portTICK_PERIOD_MS));
+}
+
+TEST_IN_TASK
+void test_sd_logger_rewrites_buffer_after_write_failure(void) {
+  SdLoggerStats start_stats;
+  SdLoggerStats stats;
+
+  s_start_logger();
+  sd_logger_get_stats(&start_stats);
+
+  /* The sequence of the next record is the low byte of the record count */
+  uint8_t sequence = (uint8_t)start_stats.frames_logged;
+  s_message.data_u8[0] = 0xA5U;
+  s_failed_writes = 1U;
+  TEST_ASSERT_OK(sd_logger_log_can(&s_message));
+
+  /* The stale buffer fails to write, the logger remounts the card and writes it to the next file */
+  TEST_ASSERT_TRUE(s_wait_for_bytes_written(start_stats.bytes_written + SD_LOGGER_BUFFER_SIZE));
+
+  sd_logger_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0U, s_failed_writes);
+  TEST_ASSERT_EQUAL_UINT32(start_stats.write_errors + 1U, stats.write_errors);
+  TEST_ASSERT_EQUAL_UINT32(start_stats.bytes_written + SD_LOGGER_BUFFER_SIZE, stats.bytes_written);
+  TEST_ASSERT_EQUAL_UINT32(start_stats.frames_dropped, stats.frames_dropped);
+  TEST_ASSERT_TRUE(s_find_padded_record(sequence));
+}